@@ -39,6 +39,9 @@ class Recipe(ConanFile):
         self.requires("dice-hash/0.4.11", transitive_headers=True)
         self.requires("dice-sparse-map/0.2.9", transitive_headers=True)
         self.requires("dice-template-library/1.9.1", transitive_headers=True)
+        self.requires("zlib/1.3.1")
+        self.requires("zstd/1.5.6")
+        self.requires("bzip2/1.0.8")
 
         if self.options.with_test_deps:
             self.test_requires("doctest/2.4.11")
@@ -30,7 +30,7 @@ void lexical_access() {
 void direct_value_access() {
     Literal lit = 1.1_xsd_float;
 
-    std::any rt_value = lit.value();
+    datatypes::registry::AnyValue rt_value = lit.value();
     assert(any_cast<float>(rt_value) == 1.1f);
 
     float ct_value = lit.value<datatypes::xsd::Float>();
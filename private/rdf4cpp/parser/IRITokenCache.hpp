@@ -0,0 +1,89 @@
+#ifndef RDF4CPP_PARSER_PRIVATE_IRITOKENCACHE_HPP
+#define RDF4CPP_PARSER_PRIVATE_IRITOKENCACHE_HPP
+
+#include <rdf4cpp/storage/identifier/NodeBackendID.hpp>
+
+#include <dice/hash.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rdf4cpp::parser {
+
+/**
+ * Small, bounded cache from raw IRI tokens (exactly as they appear in the input) to the ids of the IRIs they resolve to.
+ * A hit skips IRI resolution, validation and the node storage lookup.
+ *
+ * The cache is direct-mapped: every token has exactly one slot, colliding tokens replace each other.
+ * The resolution of a token depends on the base IRI and the prefixes of the parser,
+ * so the cache must be cleared whenever they change.
+ */
+struct IRITokenCache {
+    enum struct TokenType : uint8_t {
+        IRI,   //< possibly relative IRI reference
+        CURIE, //< prefixed name
+    };
+
+private:
+    static constexpr size_t num_slots = 1024;
+    static constexpr size_t max_token_size = 256; //< longer tokens are not cached to bound memory usage
+
+    struct Slot {
+        std::string token;
+        TokenType type;
+        uint64_t generation = 0; //< slot is only valid if this matches generation_
+        storage::identifier::NodeBackendID id;
+    };
+
+    std::vector<Slot> slots_;
+    uint64_t generation_ = 1;
+
+    [[nodiscard]] static size_t slot_index(TokenType const type, std::string_view const token) noexcept {
+        auto const h = dice::hash::dice_hash_templates<dice::hash::Policies::wyhash>::dice_hash(token);
+        return (h ^ static_cast<size_t>(type)) % num_slots;
+    }
+
+public:
+    IRITokenCache() : slots_(num_slots) {
+    }
+
+    /**
+     * @return the id of the IRI token resolved to, or the null id if it is not cached
+     */
+    [[nodiscard]] storage::identifier::NodeBackendID find(TokenType const type, std::string_view const token) const noexcept {
+        auto const &slot = slots_[slot_index(type, token)];
+        if (slot.generation == generation_ && slot.type == type && slot.token == token) {
+            return slot.id;
+        }
+
+        return storage::identifier::NodeBackendID{};
+    }
+
+    /**
+     * Remembers that token resolved to the IRI with the given id
+     */
+    void insert(TokenType const type, std::string_view const token, storage::identifier::NodeBackendID const id) {
+        if (token.size() > max_token_size) {
+            return;
+        }
+
+        auto &slot = slots_[slot_index(type, token)];
+        slot.token.assign(token);
+        slot.type = type;
+        slot.generation = generation_;
+        slot.id = id;
+    }
+
+    /**
+     * Invalidates all entries
+     */
+    void clear() noexcept {
+        ++generation_;
+    }
+};
+
+}  // namespace rdf4cpp::parser
+
+#endif  // RDF4CPP_PARSER_PRIVATE_IRITOKENCACHE_HPP
@@ -1,5 +1,6 @@
 #include "IStreamQuadIteratorSerdImpl.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 
@@ -54,8 +55,20 @@ nonstd::expected<Node, SerdStatus> IStreamQuadIterator::Impl::get_bnode(std::str
 }
 
 nonstd::expected<IRI, SerdStatus> IStreamQuadIterator::Impl::get_iri(SerdNode const *node) noexcept {
-    auto const iri = [this, node]() noexcept {
-        auto const s = node_into_string_view(node);
+    auto const s = node_into_string_view(node);
+
+    if (auto const id = this->iri_cache.find(IRITokenCache::TokenType::IRI, s); !id.null()) {
+        return IRI{storage::identifier::NodeBackendHandle{id, this->state->node_storage}};
+    }
+
+    auto const iri = [this, s]() noexcept -> nonstd::expected<IRI, IRIFactoryError> {
+        if (flags.contains(ParsingFlag::Trusted)) {
+            if (flags.syntax_allows_prefixes()) {
+                return this->state->iri_factory.from_relative_unchecked(s, this->state->node_storage);
+            } else {
+                return IRI::make_unchecked(s, this->state->node_storage);
+            }
+        }
 
         if (flags.syntax_allows_prefixes()) {
             return this->state->iri_factory.from_relative(s, this->state->node_storage);
@@ -74,6 +87,12 @@ nonstd::expected<IRI, SerdStatus> IStreamQuadIterator::Impl::get_iri(SerdNode co
         return nonstd::make_unexpected(SERD_ERR_BAD_SYNTAX);
     }
 
+    try {
+        this->iri_cache.insert(IRITokenCache::TokenType::IRI, s, iri->backend_handle().id());
+    } catch (...) {
+        // not caching is fine
+    }
+
     return *iri;
 }
 
@@ -89,6 +108,10 @@ nonstd::expected<IRI, SerdStatus> IStreamQuadIterator::Impl::get_prefixed_iri(Se
 
     auto const uri_node_view = node_into_string_view(node);
 
+    if (auto const id = this->iri_cache.find(IRITokenCache::TokenType::CURIE, uri_node_view); !id.null()) {
+        return IRI{storage::identifier::NodeBackendHandle{id, this->state->node_storage}};
+    }
+
     auto const sep_pos = uri_node_view.find(':');
     if (sep_pos == std::string_view::npos) {
         return nonstd::make_unexpected(SERD_ERR_BAD_CURIE);
@@ -97,7 +120,9 @@ nonstd::expected<IRI, SerdStatus> IStreamQuadIterator::Impl::get_prefixed_iri(Se
     auto const prefix = uri_node_view.substr(0, sep_pos);
     auto const suffix = uri_node_view.substr(sep_pos + 1);
 
-    auto iri = state->iri_factory.from_prefix(prefix, suffix, state->node_storage);
+    auto iri = flags.contains(ParsingFlag::Trusted)
+                       ? state->iri_factory.from_prefix_unchecked(prefix, suffix, state->node_storage)
+                       : state->iri_factory.from_prefix(prefix, suffix, state->node_storage);
     if (!iri.has_value()) {
         IRIFactoryError err = iri.error();
         if (err == IRIFactoryError::UnknownPrefix) {
@@ -118,11 +143,18 @@ nonstd::expected<IRI, SerdStatus> IStreamQuadIterator::Impl::get_prefixed_iri(Se
         }
     }
 
+    try {
+        this->iri_cache.insert(IRITokenCache::TokenType::CURIE, uri_node_view, iri->backend_handle().id());
+    } catch (...) {
+        // not caching is fine
+    }
+
     return *iri;
 }
 
 nonstd::expected<Literal, SerdStatus> IStreamQuadIterator::Impl::get_literal(SerdNode const *literal, SerdNode const *datatype, SerdNode const *lang) noexcept {
     auto const literal_value = node_into_string_view(literal);
+    auto const trusted = this->flags.contains(ParsingFlag::Trusted);
 
     auto const datatype_iri = [&]() -> std::optional<nonstd::expected<IRI, SerdStatus>> {
         if (datatype != nullptr) {
@@ -146,9 +178,22 @@ nonstd::expected<Literal, SerdStatus> IStreamQuadIterator::Impl::get_literal(Ser
                 return nonstd::make_unexpected(datatype_iri->error());
             }
 
+            if (trusted && datatypes::registry::DatatypeIDView{datatype_iri->value()} == datatypes::xsd::String::datatype_id) {
+                return Literal::make_simple_unchecked(literal_value, this->state->node_storage);
+            }
+
+            // typed literals always go through the datatype factory, so that they are still inlined or value-stored
             return Literal::make_typed(literal_value, datatype_iri->value(), this->state->node_storage);
         } else if (lang != nullptr) {
-            return Literal::make_lang_tagged(literal_value, node_into_string_view(lang), this->state->node_storage);
+            auto const lang_tag = node_into_string_view(lang);
+            if (trusted && std::ranges::none_of(lang_tag, [](char const c) { return c >= 'A' && c <= 'Z'; })) {
+                return Literal::make_lang_tagged_unchecked(literal_value, lang_tag, this->state->node_storage);
+            }
+
+            // non-lowercase language tags still need to be normalized
+            return Literal::make_lang_tagged(literal_value, lang_tag, this->state->node_storage);
+        } else if (trusted) {
+            return Literal::make_simple_unchecked(literal_value, this->state->node_storage);
         } else {
             return Literal::make_simple(literal_value, this->state->node_storage);
         }
@@ -184,6 +229,7 @@ SerdStatus IStreamQuadIterator::Impl::on_error(void *voided_self, SerdError cons
 
 SerdStatus IStreamQuadIterator::Impl::on_base(void *voided_self, const SerdNode *uri) noexcept {
     auto *self = static_cast<Impl *>(voided_self);
+    self->iri_cache.clear(); // relative IRIs may now resolve differently
 
     if (self->flags.contains(ParsingFlag::NoParsePrefix)) {
         self->last_error = ParsingError{.error_type = ParsingError::Type::BadSyntax,
@@ -202,6 +248,7 @@ SerdStatus IStreamQuadIterator::Impl::on_base(void *voided_self, const SerdNode
 
 SerdStatus IStreamQuadIterator::Impl::on_prefix(void *voided_self, SerdNode const *name, SerdNode const *uri) noexcept {
     auto *self = static_cast<Impl *>(voided_self);
+    self->iri_cache.clear(); // prefixed names may now resolve differently
 
     if (self->flags.contains(ParsingFlag::NoParsePrefix)) {
         self->last_error = ParsingError{.error_type = ParsingError::Type::BadSyntax,
@@ -339,15 +386,25 @@ SerdStatus IStreamQuadIterator::Impl::on_stmt(void *voided_self,
         return SERD_SUCCESS;
     }
 
-    self->quad_buffer.emplace_back(*graph_node, *subj_node, *pred_node, *obj_node);
+    if (self->sink != nullptr) {
+        try {
+            self->sink->on_quad(graph_node->backend_handle().id(),
+                                subj_node->backend_handle().id(),
+                                pred_node->backend_handle().id(),
+                                obj_node->backend_handle().id());
+        } catch (...) {
+            // cannot throw through serd, rethrown in next()
+            self->sink_exception = std::current_exception();
+            return SERD_ERR_INTERNAL;
+        }
+    } else {
+        self->quad_buffer.emplace_back(*graph_node, *subj_node, *pred_node, *obj_node);
+    }
+
     return SERD_SUCCESS;
 }
 
-IStreamQuadIterator::Impl::Impl(void *stream,
-                                ReadFunc read,
-                                ErrorFunc error,
-                                flags_type flags,
-                                state_type *initial_state) noexcept
+IStreamQuadIterator::Impl::Impl(flags_type flags, state_type *initial_state) noexcept
     : reader{serd_reader_new(extract_syntax_from_flags(flags), this, nullptr, &Impl::on_base, &Impl::on_prefix, &Impl::on_stmt, nullptr)},
       state{initial_state},
       state_is_owned{false},
@@ -360,9 +417,25 @@ IStreamQuadIterator::Impl::Impl(void *stream,
 
     serd_reader_set_strict(this->reader, !flags.contains(ParsingFlag::Lax));
     serd_reader_set_error_sink(this->reader, &Impl::on_error, this);
+}
+
+IStreamQuadIterator::Impl::Impl(void *stream,
+                                ReadFunc read,
+                                ErrorFunc error,
+                                flags_type flags,
+                                state_type *initial_state) noexcept
+    : Impl{flags, initial_state} {
     serd_reader_start_source_stream(this->reader, read, error, stream, nullptr, 4096);
 }
 
+IStreamQuadIterator::Impl::Impl(MMappedInput const &input,
+                                flags_type flags,
+                                state_type *initial_state) noexcept
+    : Impl{flags, initial_state} {
+    // serd reads null-terminated strings in place, MMappedInput guarantees the terminator
+    serd_reader_start_string(this->reader, reinterpret_cast<uint8_t const *>(input.data()), nullptr);
+}
+
 IStreamQuadIterator::Impl::~Impl() noexcept {
     serd_reader_end_stream(this->reader);
     serd_reader_free(this->reader);
@@ -390,6 +463,10 @@ std::optional<nonstd::expected<IStreamQuadIterator::ok_type, IStreamQuadIterator
 
         SerdStatus const st = serd_reader_read_chunk(this->reader);
 
+        if (this->sink_exception != nullptr) [[unlikely]] {
+            std::rethrow_exception(std::exchange(this->sink_exception, nullptr));
+        }
+
         if (st == SERD_SUCCESS) {
             // was able to parse something
             // not sure if triple or something else, continue loop
@@ -417,6 +494,19 @@ std::optional<nonstd::expected<IStreamQuadIterator::ok_type, IStreamQuadIterator
     return ret;
 }
 
+void IStreamQuadIterator::Impl::drain_into(QuadSink &quad_sink) {
+    this->sink = &quad_sink;
+    quad_sink.on_begin(this->state->node_storage);
+
+    // with a sink, quads never reach the buffer, so next() only returns errors
+    while (auto res = this->next()) {
+        assert(!res->has_value());
+        quad_sink.on_error(res->error());
+    }
+
+    quad_sink.on_end();
+}
+
 uint64_t IStreamQuadIterator::Impl::current_line() const noexcept {
     return serd_reader_get_current_line(this->reader);
 }
@@ -2,6 +2,7 @@
 #define RDF4CPP_PARSER_PRIVATE_IMPL_HPP
 
 #include <deque>
+#include <exception>
 #include <memory>
 #include <optional>
 #include <string>
@@ -11,6 +12,7 @@
 
 #include <rdf4cpp/Quad.hpp>
 #include <rdf4cpp/parser/IStreamQuadIterator.hpp>
+#include <rdf4cpp/parser/IRITokenCache.hpp>
 
 namespace rdf4cpp::parser {
 
@@ -27,12 +29,16 @@ private:
     bool state_is_owned;
 
     std::deque<Quad> quad_buffer;
+    QuadSink *sink = nullptr;                  //< if set, parsed quads are handed to the sink instead of being buffered
+    std::exception_ptr sink_exception = nullptr; //< exception thrown by the sink, rethrown by next()
     std::optional<ParsingError> last_error;
     bool last_error_requires_skip = false;
     bool end_flag = false;
 
     flags_type flags;
 
+    IRITokenCache iri_cache; //< cleared whenever the base or prefixes change
+
 private:
     static std::string_view node_into_string_view(SerdNode const *node) noexcept;
     static ParsingError::Type parsing_error_type_from_serd(SerdStatus st) noexcept;
@@ -62,6 +68,11 @@ private:
         }
     }
 
+    /**
+     * Creates the serd reader without any source
+     */
+    Impl(flags_type flags, state_type *state) noexcept;
+
 public:
     Impl(void *stream,
          ReadFunc read,
@@ -69,6 +80,13 @@ public:
          flags_type flags,
          state_type *state) noexcept;
 
+    /**
+     * Parses input in place, without copying it into a separate buffer
+     */
+    Impl(MMappedInput const &input,
+         flags_type flags,
+         state_type *state) noexcept;
+
     ~Impl() noexcept;
 
     /**
@@ -83,6 +101,11 @@ public:
      */
     [[nodiscard]] std::optional<nonstd::expected<ok_type, error_type>> next();
 
+    /**
+     * Parses the whole input and hands all quads and errors to sink, instead of returning them from next()
+     */
+    void drain_into(QuadSink &sink);
+
     [[nodiscard]] uint64_t current_line() const noexcept;
     [[nodiscard]] uint64_t current_column() const noexcept;
 };
@@ -0,0 +1,167 @@
+#ifndef RDF4CPP_PRIVATE_UTIL_RADIXSORT_HPP
+#define RDF4CPP_PRIVATE_UTIL_RADIXSORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rdf4cpp::util {
+
+namespace radix_sort_detail {
+
+static constexpr size_t digit_bits = 8;
+static constexpr size_t num_buckets = size_t{1} << digit_bits;
+static constexpr size_t digits_per_word = 64 / digit_bits;
+
+/**
+ * Minimum number of elements per thread, below that the overhead of starting threads dominates
+ */
+static constexpr size_t min_elements_per_thread = 1 << 16;
+
+/**
+ * Calls f(0), ..., f(num_threads - 1) concurrently, f(0) is called on the calling thread
+ */
+template<typename F>
+void parallel_for(size_t const num_threads, F const &f) {
+    std::vector<std::jthread> workers;
+    workers.reserve(num_threads - 1);
+
+    for (size_t t = 1; t < num_threads; ++t) {
+        workers.emplace_back([&f, t]() noexcept {
+            f(t);
+        });
+    }
+
+    f(0);
+}
+
+}  // namespace radix_sort_detail
+
+/**
+ * Sorts data stably by the keys returned by key, using a least significant digit first radix sort
+ * that is parallelized over num_threads threads.
+ * Digits that are equal for all elements are skipped, so keys with few distinct high bits (like NodeBackendIDs) only need a few passes.
+ *
+ * @param data elements to sort
+ * @param key returns the key of an element as std::array<uint64_t, N>, most significant word first. Must be thread-safe.
+ * @param num_threads maximum number of threads to use, 0 means std::thread::hardware_concurrency()
+ * @throws std::system_error if threads cannot be started
+ */
+template<typename T, typename KeyF>
+void parallel_radix_sort(std::vector<T> &data, KeyF const &key, size_t num_threads = 0)
+    requires std::is_nothrow_copy_assignable_v<T> {
+
+    using namespace radix_sort_detail;
+
+    using key_type = std::invoke_result_t<KeyF const &, T const &>;
+    static constexpr size_t num_words = std::tuple_size_v<key_type>;
+    static constexpr size_t num_digits = num_words * digits_per_word;
+
+    using histogram = std::array<size_t, num_buckets>;
+
+    if (data.size() < 2) {
+        return;
+    }
+
+    num_threads = num_threads != 0 ? num_threads : std::max(1u, std::thread::hardware_concurrency());
+    num_threads = std::clamp<size_t>(data.size() / min_elements_per_thread, 1, num_threads);
+
+    // digit 0 is the least significant digit of the last word
+    auto const key_digit = [](key_type const &k, size_t const d) noexcept {
+        return static_cast<size_t>((k[num_words - 1 - d / digits_per_word] >> (d % digits_per_word * digit_bits)) % num_buckets);
+    };
+
+    auto const digit = [&](T const &elem, size_t const d) noexcept {
+        return key_digit(key(elem), d);
+    };
+
+    auto const chunk_begin = [&](size_t const t) noexcept {
+        return data.size() * t / num_threads;
+    };
+
+    // global histograms of all digits, to find the digits that need to be sorted by
+    std::vector<std::array<histogram, num_digits>> all_counts(num_threads);
+    parallel_for(num_threads, [&](size_t const t) noexcept {
+        auto &counts = all_counts[t];
+        for (auto &c : counts) {
+            c.fill(0);
+        }
+
+        for (size_t ix = chunk_begin(t); ix < chunk_begin(t + 1); ++ix) {
+            auto const k = key(data[ix]);
+            for (size_t d = 0; d < num_digits; ++d) {
+                ++counts[d][key_digit(k, d)];
+            }
+        }
+    });
+
+    std::vector<size_t> digits_to_sort;
+    for (size_t d = 0; d < num_digits; ++d) {
+        for (size_t b = 0; b < num_buckets; ++b) {
+            size_t total = 0;
+            for (auto const &counts : all_counts) {
+                total += counts[d][b];
+            }
+
+            if (total == data.size()) {
+                break; // all elements have the same digit
+            }
+
+            if (total != 0) {
+                digits_to_sort.push_back(d);
+                break;
+            }
+        }
+    }
+
+    if (digits_to_sort.empty()) {
+        return;
+    }
+
+    std::vector<T> buffer(data.size());
+    auto *src = &data;
+    auto *dst = &buffer;
+
+    std::vector<histogram> offsets(num_threads);
+    for (auto const d : digits_to_sort) {
+        // the chunks of src changed since the last pass, so the counts per thread need to be recomputed
+        parallel_for(num_threads, [&](size_t const t) noexcept {
+            auto &counts = offsets[t];
+            counts.fill(0);
+            for (size_t ix = chunk_begin(t); ix < chunk_begin(t + 1); ++ix) {
+                ++counts[digit((*src)[ix], d)];
+            }
+        });
+
+        // elements of chunk t with digit b go after all elements with a smaller digit and those in earlier chunks with digit b
+        size_t offset = 0;
+        for (size_t b = 0; b < num_buckets; ++b) {
+            for (auto &counts : offsets) {
+                offset += std::exchange(counts[b], offset);
+            }
+        }
+
+        parallel_for(num_threads, [&](size_t const t) noexcept {
+            auto &next = offsets[t];
+            for (size_t ix = chunk_begin(t); ix < chunk_begin(t + 1); ++ix) {
+                auto const &elem = (*src)[ix];
+                (*dst)[next[digit(elem, d)]++] = elem;
+            }
+        });
+
+        std::swap(src, dst);
+    }
+
+    if (src != &data) {
+        data.swap(buffer);
+    }
+}
+
+}  // namespace rdf4cpp::util
+
+#endif  // RDF4CPP_PRIVATE_UTIL_RADIXSORT_HPP
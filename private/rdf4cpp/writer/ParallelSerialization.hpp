@@ -0,0 +1,139 @@
+#ifndef RDF4CPP_PRIVATE_PARALLELSERIALIZATION_HPP
+#define RDF4CPP_PRIVATE_PARALLELSERIALIZATION_HPP
+
+#include <rdf4cpp/writer/BufWriter.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rdf4cpp::writer {
+
+/**
+ * Number of statements serialized by a worker at once in serialize_chunks_parallel
+ */
+inline constexpr size_t parallel_serialization_chunk_size = 1 << 14;
+
+/**
+ * Maximum number of serialized chunks per worker that may wait to be written at any time.
+ * Bounds memory usage if the writer is slower than the workers.
+ */
+inline constexpr size_t parallel_serialization_chunks_in_flight = 4;
+
+/**
+ * Serializes num_chunks chunks on num_threads worker threads into separate buffers
+ * and writes the buffers to writer in chunk order, on the calling thread.
+ * The output is therefore identical to calling serialize_chunk for every chunk in order with writer itself.
+ *
+ * @param num_chunks number of chunks
+ * @param serialize_chunk called as serialize_chunk(chunk_index, BufWriterParts) on the worker threads, must be thread-safe
+ * @param num_threads number of worker threads, 0 means std::thread::hardware_concurrency()
+ * @param writer the writer to write the chunks to
+ * @return true if serialization was successful, false if a call to flush was not able to make room
+ * @throws std::system_error if the worker threads cannot be started
+ */
+template<typename F>
+bool serialize_chunks_parallel(size_t const num_chunks, F const &serialize_chunk, size_t num_threads, BufWriterParts const writer)
+    requires std::is_invocable_r_v<bool, F const &, size_t, BufWriterParts> {
+
+    num_threads = std::min(num_threads != 0 ? num_threads : std::max(1u, std::thread::hardware_concurrency()), num_chunks);
+    auto const max_in_flight = num_threads * parallel_serialization_chunks_in_flight;
+
+    std::vector<std::string> buffers(num_chunks);
+    std::vector<bool> ready(num_chunks, false);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t next_chunk = 0; //< next chunk to be picked up by a worker
+    size_t written = 0;    //< number of chunks written to writer
+    bool cancelled = false;
+
+    std::vector<std::jthread> workers;
+    workers.reserve(num_threads);
+
+    auto stop_workers = [&]() noexcept {
+        {
+            std::lock_guard lock{mutex};
+            cancelled = true;
+        }
+        cv.notify_all();
+    };
+
+    try {
+        for (size_t t = 0; t < num_threads; ++t) {
+            workers.emplace_back([&]() noexcept {
+                size_t size_hint = 4096; //< size of the previous chunk, to avoid regrowing the buffer for every chunk
+
+                while (true) {
+                    size_t ix;
+                    {
+                        std::unique_lock lock{mutex};
+                        cv.wait(lock, [&]() noexcept {
+                            return cancelled || next_chunk >= num_chunks || next_chunk < written + max_in_flight;
+                        });
+
+                        if (cancelled || next_chunk >= num_chunks) {
+                            return;
+                        }
+
+                        ix = next_chunk++;
+                    }
+
+                    std::string buf;
+                    buf.resize(size_hint);
+
+                    StringWriter w{buf};
+                    (void) serialize_chunk(ix, w); // cannot fail, StringWriter always makes room
+                    w.finalize();
+                    size_hint = std::max(buf.size(), size_hint);
+
+                    {
+                        std::lock_guard lock{mutex};
+                        buffers[ix] = std::move(buf);
+                        ready[ix] = true;
+                    }
+                    cv.notify_all();
+                }
+            });
+        }
+    } catch (...) {
+        stop_workers();
+        throw;
+    }
+
+    for (size_t ix = 0; ix < num_chunks; ++ix) {
+        std::string buf;
+        {
+            std::unique_lock lock{mutex};
+            cv.wait(lock, [&]() noexcept {
+                return ready[ix];
+            });
+
+            buf = std::move(buffers[ix]);
+        }
+
+        if (!write_str(buf, writer)) {
+            stop_workers();
+            return false;
+        }
+
+        {
+            std::lock_guard lock{mutex};
+            ++written;
+        }
+        cv.notify_all();
+    }
+
+    return true;
+}
+
+}  // namespace rdf4cpp::writer
+
+#endif  // RDF4CPP_PRIVATE_PARALLELSERIALIZATION_HPP
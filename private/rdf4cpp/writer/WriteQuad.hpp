@@ -8,8 +8,12 @@
 namespace rdf4cpp::writer {
 
 template<writer::OutputFormat F>
-bool write_node(Node const node, writer::BufWriterParts const writer) noexcept {
+bool write_node(Node const node, writer::BufWriterParts const writer, writer::SerializationState const *const state) noexcept {
     if constexpr (writer::format_has_prefix<F>) {
+        if (state->prefixes != nullptr && node.is_iri()) {
+            return state->prefixes->write_iri(node.as_iri().identifier(), writer);
+        }
+
         return node.serialize(writer, NodeSerializationOpts::prefixed_and_short_form());
     } else {
         return node.serialize(writer, NodeSerializationOpts::long_form());
@@ -17,7 +21,7 @@ bool write_node(Node const node, writer::BufWriterParts const writer) noexcept {
 }
 
 template<writer::OutputFormat F>
-bool write_pred(Node const pred, writer::BufWriterParts const writer) {
+bool write_pred(Node const pred, writer::BufWriterParts const writer, writer::SerializationState const *const state) {
     if constexpr (writer::format_has_prefix<F>) {
         static constexpr storage::identifier::LiteralType rdf_type = datatypes::registry::reserved_datatype_ids[datatypes::registry::rdf_type];
 
@@ -26,17 +30,17 @@ bool write_pred(Node const pred, writer::BufWriterParts const writer) {
         }
     }
 
-    return write_node<F>(pred, writer);
+    return write_node<F>(pred, writer, state);
 }
 
-#define RDF4CPP_DETAIL_TRY_WRITE_NODE(pred) \
-    if (!write_node<F>((pred), writer)) {   \
-        return false;                       \
+#define RDF4CPP_DETAIL_TRY_WRITE_NODE(pred)        \
+    if (!write_node<F>((pred), writer, state)) { \
+        return false;                              \
     }
 
-#define RDF4CPP_DETAIL_TRY_WRITE_PRED(pred) \
-    if (!write_pred<F>((pred), writer)) {   \
-        return false;                       \
+#define RDF4CPP_DETAIL_TRY_WRITE_PRED(pred)        \
+    if (!write_pred<F>((pred), writer, state)) { \
+        return false;                              \
     }
 
 [[nodiscard]] inline bool print_graph(Node const &graph) noexcept {
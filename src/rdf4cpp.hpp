@@ -9,10 +9,16 @@
 #include <rdf4cpp/Node.hpp>
 #include <rdf4cpp/namespaces.hpp>
 #include <rdf4cpp/bnode_mngt/NodeGenerator.hpp>
+#include <rdf4cpp/parser/BatchingQuadSink.hpp>
+#include <rdf4cpp/parser/DecompressingReader.hpp>
 #include <rdf4cpp/parser/IStreamQuadIterator.hpp>
+#include <rdf4cpp/parser/ParallelQuadLoader.hpp>
+#include <rdf4cpp/parser/PrefetchingReader.hpp>
 #include <rdf4cpp/parser/RDFFileParser.hpp>
 #include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
 #include <rdf4cpp/version.hpp>
+#include <rdf4cpp/writer/CompressingWriter.hpp>
+#include <rdf4cpp/writer/IRIPrefixMap.hpp>
 #include <rdf4cpp/writer/SerializationState.hpp>
 
 
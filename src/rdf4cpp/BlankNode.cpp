@@ -214,6 +214,10 @@ std::strong_ordering BlankNode::order(BlankNode const &other) const noexcept {
             return handle_.bnode_backend() <=> other_deinlined.view();
         }
 
+        if (handle_.storage() == other.handle_.storage() && handle_.storage().has_lexically_ordered_ids(storage::identifier::RDFNodeType::BNode)) {
+            return handle_.node_id() <=> other.handle_.node_id();
+        }
+
         return handle_.bnode_backend() <=> other.handle_.bnode_backend();
     }
 }
@@ -1,9 +1,11 @@
 #include "Dataset.hpp"
 #include <rdf4cpp/Graph.hpp>
+#include <rdf4cpp/writer/ParallelSerialization.hpp>
 #include <rdf4cpp/writer/TryWrite.hpp>
 #include <rdf4cpp/writer/SerializationState.hpp>
 
 #include <utility>
+#include <vector>
 
 namespace rdf4cpp {
 
@@ -15,17 +17,22 @@ Node Dataset::to_node(storage::identifier::NodeBackendID id) const noexcept {
     return Node{storage::identifier::NodeBackendHandle{id, node_storage_}};
 }
 
-Dataset::Dataset(storage::DynNodeStoragePtr node_storage) : node_storage_{node_storage} {}
-
-void Dataset::add(Quad const &quad) {
-    auto const g = quad.graph().null() ? IRI::default_graph(node_storage_) : quad.graph().to_node_storage(node_storage_);
+Dataset::Dataset(storage::DynNodeStoragePtr node_storage, bool const indexed_graphs) : node_storage_{node_storage},
+                                                                                       indexed_graphs_{indexed_graphs} {
+}
 
-    auto it = graphs_.find(to_node_id(g));
+Graph &Dataset::graph_by_id(storage::identifier::NodeBackendID const graph_id) {
+    auto it = graphs_.find(graph_id);
     if (it == graphs_.end()) {
-        it = graphs_.emplace(to_node_id(g), node_storage_).first;
+        it = graphs_.emplace(graph_id, Graph{node_storage_, indexed_graphs_}).first;
     }
 
-    it.value().add(quad.without_graph());
+    return it.value();
+}
+
+void Dataset::add(Quad const &quad) {
+    auto const g = quad.graph().null() ? IRI::default_graph(node_storage_) : quad.graph().to_node_storage(node_storage_);
+    graph_by_id(to_node_id(g)).add(quad.without_graph());
 }
 
 bool Dataset::contains(Quad const &quad) const noexcept {
@@ -92,13 +99,7 @@ Graph const *Dataset::find_graph() const {
 
 Graph &Dataset::graph(Node const &graph_) {
     auto const graph = graph_.to_node_storage(node_storage_);
-
-    auto it = graphs_.find(to_node_id(graph));
-    if (it == graphs_.end()) {
-        it = graphs_.emplace(to_node_id(graph), Graph{node_storage_}).first;
-    }
-
-    return it.value();
+    return graph_by_id(to_node_id(graph));
 }
 
 Graph &Dataset::graph() {
@@ -123,6 +124,56 @@ bool Dataset::serialize(writer::BufWriterParts const writer) const noexcept {
     return true;
 }
 
+bool Dataset::serialize_parallel(writer::BufWriterParts const writer, size_t const num_threads) const {
+    static constexpr size_t chunk_size = writer::parallel_serialization_chunk_size;
+
+    auto const total_size = size();
+    if (total_size <= chunk_size) {
+        return serialize(writer);
+    }
+
+    // position of the first quad of a chunk, chunks may span multiple graphs
+    struct ChunkBegin {
+        typename storage_type::const_iterator graph;
+        typename Graph::triple_storage_type::const_iterator triple;
+    };
+
+    std::vector<ChunkBegin> chunk_begins;
+    chunk_begins.reserve(total_size / chunk_size + 1);
+
+    size_t n = 0;
+    for (auto git = graphs_.begin(); git != graphs_.end(); ++git) {
+        auto const &triples = git->second.triples_;
+        for (auto it = triples.begin(); it != triples.end(); ++it, ++n) {
+            if (n % chunk_size == 0) {
+                chunk_begins.push_back(ChunkBegin{git, it});
+            }
+        }
+    }
+
+    auto const serialize_chunk = [&](size_t const ix, writer::BufWriterParts const chunk_writer) noexcept {
+        auto const num_quads = ix + 1 < chunk_begins.size() ? chunk_size : total_size - ix * chunk_size;
+        auto [git, it] = chunk_begins[ix];
+
+        for (size_t q = 0; q < num_quads; ++q, ++it) {
+            while (it == git->second.triples_.end()) {
+                ++git;
+                it = git->second.triples_.begin();
+            }
+
+            auto const &[s, p, o] = *it;
+            Quad quad{to_node(git->first), git->second.to_node(s), git->second.to_node(p), git->second.to_node(o)};
+            if (!quad.serialize_nquads(chunk_writer)) {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    return writer::serialize_chunks_parallel(chunk_begins.size(), serialize_chunk, num_threads, writer);
+}
+
 bool Dataset::serialize_trig(writer::SerializationState &state, writer::BufWriterParts const writer) const noexcept {
     for (Quad const &quad : *this) {
         if (!quad.serialize_trig(state, writer)) {
@@ -145,6 +196,75 @@ bool Dataset::serialize_trig(writer::BufWriterParts const writer) const noexcept
 
     return st.flush(writer);
 }
+
+bool Dataset::serialize_trig(writer::BufWriterParts const writer, writer::IRIPrefixMap const &prefixes) const noexcept {
+    writer::SerializationState st{.prefixes = &prefixes};
+    if (!writer::SerializationState::begin(writer, prefixes)) {
+        return false;
+    }
+
+    if (!serialize_trig(st, writer)) {
+        return false;
+    }
+
+    return st.flush(writer);
+}
+
+bool Dataset::serialize_trig_grouped(writer::SerializationState &state, writer::BufWriterParts const writer) const {
+    for (auto const &[graph_id, graph] : graphs_) {
+        auto const graph_name = to_node(graph_id);
+
+        for (auto const &[s, p, o] : graph.grouped_triples()) {
+            Quad quad{graph_name, graph.to_node(s), graph.to_node(p), graph.to_node(o)};
+            if (!quad.serialize_trig(state, writer)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool Dataset::serialize_trig_grouped(writer::BufWriterParts const writer) const {
+    writer::SerializationState st{};
+    if (!st.begin(writer)) {
+        return false;
+    }
+
+    if (!serialize_trig_grouped(st, writer)) {
+        return false;
+    }
+
+    return st.flush(writer);
+}
+
+bool Dataset::serialize_trig_grouped(writer::BufWriterParts const writer, writer::IRIPrefixMap const &prefixes) const {
+    writer::SerializationState st{.prefixes = &prefixes};
+    if (!writer::SerializationState::begin(writer, prefixes)) {
+        return false;
+    }
+
+    if (!serialize_trig_grouped(st, writer)) {
+        return false;
+    }
+
+    return st.flush(writer);
+}
+
+writer::IRIPrefixMap Dataset::discover_prefixes(size_t const max_prefixes, size_t const sample_size) const {
+    writer::PrefixDiscovery discovery;
+
+    size_t n = 0;
+    for (auto it = graphs_.begin(); it != graphs_.end() && n < sample_size; ++it) {
+        if (auto const graph_name = to_node(it->first); graph_name.is_iri() && !graph_name.as_iri().is_default_graph()) {
+            discovery.sample(graph_name.as_iri().identifier());
+        }
+
+        n += it->second.sample_namespaces(discovery, sample_size - n);
+    }
+
+    return discovery.finish(max_prefixes);
+}
 std::ostream &operator<<(std::ostream &os, Dataset const &ds) {
     writer::BufOStreamWriter w{os};
     ds.serialize(w);
@@ -3,6 +3,7 @@
 
 #include <rdf4cpp/Graph.hpp>
 #include <rdf4cpp/Quad.hpp>
+#include <rdf4cpp/parser/ParallelQuadLoader.hpp>
 #include <rdf4cpp/query/QuadPattern.hpp>
 #include <rdf4cpp/writer/BufWriter.hpp>
 
@@ -122,12 +123,24 @@ public:
 private:
     storage::DynNodeStoragePtr node_storage_;
     storage_type graphs_;
+    bool indexed_graphs_;
 
     static storage::identifier::NodeBackendID to_node_id(Node node) noexcept;
     Node to_node(storage::identifier::NodeBackendID id) const noexcept;
 
+    /**
+     * @return the graph with the given name, it is created if it does not exist yet
+     */
+    Graph &graph_by_id(storage::identifier::NodeBackendID graph_id);
+
 public:
-    explicit Dataset(storage::DynNodeStoragePtr node_storage = storage::default_node_storage);
+    /**
+     * Creates an empty dataset.
+     *
+     * @param node_storage node storage the nodes of this dataset are stored in
+     * @param indexed_graphs if true, all graphs of this dataset maintain permutation indices (see Graph::build_index())
+     */
+    explicit Dataset(storage::DynNodeStoragePtr node_storage = storage::default_node_storage, bool indexed_graphs = false);
 
     void add(Quad const &quad);
 
@@ -160,15 +173,72 @@ public:
             throw std::invalid_argument{"NodeStorage of the parsing state must be the same as NodeStorage of the Dataset"};
         }
 
-        parser::IStreamQuadIterator parser{rdf_file, flags, state};
-        for (; parser != std::default_sentinel; ++parser) {
-            auto const &quad = *parser;
-            if (quad.has_value()) {
-                add(*quad);
-            } else {
-                std::invoke(errf, quad.error());
+        // the parsed ids are inserted directly, the graph is only looked up if it differs from the previous quad's graph
+        struct Sink final : parser::QuadSink {
+            Dataset *self;
+            std::remove_reference_t<ErrF> *errf;
+            storage::identifier::NodeBackendID graph_id;
+            Graph *graph = nullptr; //< graph of the previous quad, stays valid because only graph_by_id modifies graphs_
+
+            Sink(Dataset *self, std::remove_reference_t<ErrF> *errf) noexcept : self{self}, errf{errf} {
             }
+
+            void on_quad(storage::identifier::NodeBackendID const graph_name,
+                         storage::identifier::NodeBackendID const subject,
+                         storage::identifier::NodeBackendID const predicate,
+                         storage::identifier::NodeBackendID const object) override {
+                if (graph == nullptr || graph_name != graph_id) {
+                    graph = &self->graph_by_id(graph_name);
+                    graph_id = graph_name;
+                }
+
+                graph->insert(Graph::triple{subject, predicate, object});
+            }
+
+            void on_error(parser::ParsingError const &error) override {
+                std::invoke(*errf, error);
+            }
+        };
+
+        parser::ParsingState default_state{.node_storage = node_storage_};
+        Sink sink{this, &errf};
+        parser::IStreamQuadIterator::parse_into(sink, rdf_file, flags, state != nullptr ? state : &default_state);
+    }
+
+    /**
+     * Loads a file in a line based syntax (N-Triples or N-Quads) into this dataset using multiple threads.
+     * See parser::ParallelQuadLoader for details.
+     *
+     * @param file_path path to the file to load
+     * @param flags parsing flags, the syntax must be either ParsingFlag::NTriples or ParsingFlag::NQuads
+     * @param state parsing state, if nullptr a default state with the node storage of this dataset is used
+     * @param num_threads number of worker threads, 0 means std::thread::hardware_concurrency()
+     * @param errf called for every parsing error (with line numbers relative to the beginning of the file), on the calling thread
+     * @warning the node storage of this dataset must be thread-safe
+     */
+    template<typename ErrF = decltype([](parser::ParsingError) noexcept {})>
+    void load_rdf_data_parallel(std::string const &file_path,
+                                parser::ParsingFlags flags = parser::ParsingFlag::NTriples,
+                                parser::ParsingState const *state = nullptr,
+                                size_t num_threads = 0,
+                                ErrF &&errf = {}) requires std::invocable<decltype(errf), parser::ParsingError> {
+
+        if (state != nullptr && state->node_storage != node_storage_) {
+            throw std::invalid_argument{"NodeStorage of the parsing state must be the same as NodeStorage of the Dataset"};
         }
+
+        parser::ParsingState default_state{.node_storage = node_storage_};
+        parser::ParallelQuadLoader loader{file_path, flags, state != nullptr ? state : &default_state, num_threads};
+
+        loader.load([&](parser::ParallelQuadLoader::Chunk &&chunk) {
+            for (auto const &quad : chunk.quads) {
+                add(quad);
+            }
+
+            for (auto &error : chunk.errors) {
+                std::invoke(errf, std::move(error));
+            }
+        });
     }
 
     /**
@@ -179,6 +249,20 @@ public:
      */
     bool serialize(writer::BufWriterParts writer) const noexcept;
 
+    /**
+     * Serialize this dataset as <a href="https://www.w3.org/TR/n-quads/">N-Quads</a> using multiple threads.
+     * The quads are split into chunks (possibly spanning multiple graphs) that are serialized into separate buffers by worker threads.
+     * The buffers are written to writer in order on the calling thread, so the output is identical to serialize(writer).
+     * Small datasets are serialized on the calling thread only.
+     *
+     * @param writer writer parts
+     * @param num_threads number of worker threads, 0 means std::thread::hardware_concurrency()
+     * @return true if serialization was successful, false if a call to flush was not able to make room
+     * @throws std::system_error if the worker threads cannot be started
+     * @warning the node storage of this dataset is read from multiple threads, it must not be modified during serialization unless it is thread-safe
+     */
+    bool serialize_parallel(writer::BufWriterParts writer, size_t num_threads = 0) const;
+
     /**
      * Serialize this dataset as <a href="https://www.w3.org/TR/rdf12-trig/">TriG</a>.
      * This function does not call `begin` or `flush` on the given state,
@@ -200,6 +284,49 @@ public:
      */
     bool serialize_trig(writer::BufWriterParts writer) const noexcept;
 
+    /**
+     * Serialize this dataset as <a href="https://www.w3.org/TR/rdf12-trig/">TriG</a>, abbreviating IRIs with the given prefixes.
+     * The prefixes are declared at the beginning of the output.
+     *
+     * @param writer writer parts
+     * @param prefixes prefixes to use, for example from an IRIFactory or discover_prefixes()
+     * @return true if serialization was successful, false if a call to W::flush was not able to make room
+     */
+    bool serialize_trig(writer::BufWriterParts writer, writer::IRIPrefixMap const &prefixes) const noexcept;
+
+    /**
+     * Serialize this dataset as <a href="https://www.w3.org/TR/rdf12-trig/">TriG</a> with the triples of each graph grouped by subject and then by predicate,
+     * see Graph::serialize_turtle_grouped.
+     * This function does not call `begin` or `flush` on the given state,
+     * it just serialized the contents of this Dataset using it.
+     *
+     * @param state serialization state
+     * @param writer writer parts
+     * @return true if serialization was successful, false if a call to W::flush was not able to make room
+     * @throws std::system_error if the sorting threads cannot be started
+     */
+    bool serialize_trig_grouped(writer::SerializationState &state, writer::BufWriterParts writer) const;
+
+    /**
+     * Same as serialize_trig_grouped(state, writer), but internally creates a SerializationState
+     * and calls `begin` and `flush` on it when appropriate.
+     */
+    bool serialize_trig_grouped(writer::BufWriterParts writer) const;
+
+    /**
+     * Same as serialize_trig_grouped(writer), but abbreviates IRIs with the given prefixes (see serialize_trig(writer, prefixes))
+     */
+    bool serialize_trig_grouped(writer::BufWriterParts writer, writer::IRIPrefixMap const &prefixes) const;
+
+    /**
+     * Finds the most frequent namespaces of the IRIs (including graph names) in (a sample of) this dataset, see writer::PrefixDiscovery.
+     *
+     * @param max_prefixes maximum number of prefixes to return
+     * @param sample_size number of quads to sample, the sample is the first sample_size quads in iteration order
+     * @return prefixes for the most frequent namespaces, to be used in serialize_trig
+     */
+    [[nodiscard]] writer::IRIPrefixMap discover_prefixes(size_t max_prefixes = Graph::default_max_prefixes, size_t sample_size = Graph::default_prefix_sample_size) const;
+
     friend std::ostream &operator<<(std::ostream &os, Dataset const &self);
 
     // TODO: support union (+) and difference (-)
@@ -1,9 +1,15 @@
 #include "Graph.hpp"
 #include <rdf4cpp/Dataset.hpp>
+#include <rdf4cpp/util/RadixSort.hpp>
+#include <rdf4cpp/writer/ParallelSerialization.hpp>
 #include <rdf4cpp/writer/TryWrite.hpp>
 #include <rdf4cpp/writer/SerializationState.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <utility>
+#include <vector>
 
 namespace rdf4cpp {
 
@@ -15,12 +21,103 @@ Node Graph::to_node(storage::identifier::NodeBackendID id) const noexcept {
     return Node{storage::identifier::NodeBackendHandle{id, node_storage_}};
 }
 
-Graph::Graph(storage::DynNodeStoragePtr node_storage) noexcept : node_storage_{node_storage} {
+/**
+ * Reorders the components of t according to perm
+ */
+static constexpr std::array<storage::identifier::NodeBackendID, 3> permute(std::array<storage::identifier::NodeBackendID, 3> const &t,
+                                                                          std::array<uint8_t, 3> const &perm) noexcept {
+    return {t[perm[0]], t[perm[1]], t[perm[2]]};
+}
+
+/**
+ * Reverts the reordering done by permute(t, perm)
+ */
+static constexpr std::array<storage::identifier::NodeBackendID, 3> unpermute(std::array<storage::identifier::NodeBackendID, 3> const &t,
+                                                                            std::array<uint8_t, 3> const &perm) noexcept {
+    std::array<storage::identifier::NodeBackendID, 3> ret;
+    ret[perm[0]] = t[0];
+    ret[perm[1]] = t[1];
+    ret[perm[2]] = t[2];
+    return ret;
+}
+
+void Graph::triple_index_type::insert(triple const &t) {
+    if (runs.empty() || runs.back().size() >= buffer_capacity) {
+        // merge runs of similar size, so that the number of runs stays logarithmic
+        while (runs.size() >= 2 && runs[runs.size() - 2].size() <= 2 * runs.back().size()) {
+            auto const &lhs = runs[runs.size() - 2];
+            auto const &rhs = runs.back();
+
+            std::vector<triple> merged;
+            merged.reserve(lhs.size() + rhs.size());
+            std::ranges::merge(lhs, rhs, std::back_inserter(merged));
+
+            runs.pop_back();
+            runs.back() = std::move(merged);
+        }
+
+        runs.emplace_back().reserve(buffer_capacity);
+    }
+
+    auto &buffer = runs.back();
+    buffer.insert(std::ranges::upper_bound(buffer, t), t);
+}
+
+void Graph::triple_index_type::assign(std::vector<triple> values) {
+    std::ranges::sort(values);
+
+    runs.clear();
+    if (!values.empty()) {
+        runs.push_back(std::move(values));
+    }
+}
+
+void Graph::triple_indices::insert(triple const &t) {
+    spo.insert(permute(t, spo_permutation));
+    pos.insert(permute(t, pos_permutation));
+    osp.insert(permute(t, osp_permutation));
+}
+
+Graph::Graph(storage::DynNodeStoragePtr node_storage, bool const indexed) noexcept : node_storage_{node_storage} {
+    if (indexed) {
+        indices_.emplace();
+    }
+}
+
+void Graph::insert(triple const &t) {
+    auto const [_, inserted] = triples_.insert(t);
+    if (inserted && indices_.has_value()) {
+        indices_->insert(t);
+    }
 }
 
 void Graph::add(Statement const &stmt_) {
     auto stmt = stmt_.to_node_storage(node_storage_);
-    triples_.insert(triple{to_node_id(stmt.subject()), to_node_id(stmt.predicate()), to_node_id(stmt.object())});
+    insert(triple{to_node_id(stmt.subject()), to_node_id(stmt.predicate()), to_node_id(stmt.object())});
+}
+
+void Graph::build_index() {
+    if (indices_.has_value()) {
+        return;
+    }
+
+    auto &indices = indices_.emplace();
+    auto const build = [&](triple_index_type &index, triple_permutation const &perm) {
+        std::vector<triple> values;
+        values.reserve(triples_.size());
+        for (auto const &t : triples_) {
+            values.push_back(permute(t, perm));
+        }
+        index.assign(std::move(values));
+    };
+
+    build(indices.spo, spo_permutation);
+    build(indices.pos, pos_permutation);
+    build(indices.osp, osp_permutation);
+}
+
+bool Graph::is_indexed() const noexcept {
+    return indices_.has_value();
 }
 
 bool Graph::contains(Statement const &stmt_) const noexcept {
@@ -37,7 +134,7 @@ Graph::sentinel Graph::end() const noexcept {
 }
 
 Graph::solution_sequence Graph::match(query::TriplePattern const &triple_pattern) const noexcept {
-    return solution_sequence{solution_iterator{begin(), triple_pattern}};
+    return solution_sequence{solution_iterator{this, triple_pattern}};
 }
 
 size_t Graph::size() const noexcept {
@@ -55,6 +152,41 @@ bool Graph::serialize(writer::BufWriterParts const writer) const noexcept {
     return true;
 }
 
+bool Graph::serialize_parallel(writer::BufWriterParts const writer, size_t const num_threads) const {
+    static constexpr size_t chunk_size = writer::parallel_serialization_chunk_size;
+
+    if (triples_.size() <= chunk_size) {
+        return serialize(writer);
+    }
+
+    // the iterators of the sparse set are forward iterators, the chunk boundaries are found in a single pass
+    std::vector<triple_storage_type::const_iterator> chunk_begins;
+    chunk_begins.reserve(triples_.size() / chunk_size + 1);
+
+    size_t n = 0;
+    for (auto it = triples_.begin(); it != triples_.end(); ++it, ++n) {
+        if (n % chunk_size == 0) {
+            chunk_begins.push_back(it);
+        }
+    }
+
+    auto const serialize_chunk = [&](size_t const ix, writer::BufWriterParts const chunk_writer) noexcept {
+        auto const end = ix + 1 < chunk_begins.size() ? chunk_begins[ix + 1] : triples_.end();
+
+        for (auto it = chunk_begins[ix]; it != end; ++it) {
+            auto const &[s, p, o] = *it;
+            Quad q{to_node(s), to_node(p), to_node(o)};
+            if (!q.serialize_ntriples(chunk_writer)) {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    return writer::serialize_chunks_parallel(chunk_begins.size(), serialize_chunk, num_threads, writer);
+}
+
 bool Graph::serialize_turtle(writer::SerializationState &state, writer::BufWriterParts const writer) const noexcept {
     for (auto const &[s, p, o] : triples_) {
         Quad q{to_node(s), to_node(p), to_node(o)};
@@ -79,6 +211,84 @@ bool Graph::serialize_turtle(writer::BufWriterParts const writer) const noexcept
     return st.flush(writer);
 }
 
+bool Graph::serialize_turtle(writer::BufWriterParts const writer, writer::IRIPrefixMap const &prefixes) const noexcept {
+    writer::SerializationState st{.prefixes = &prefixes};
+    if (!writer::SerializationState::begin(writer, prefixes)) {
+        return false;
+    }
+
+    if (!serialize_turtle(st, writer)) {
+        return false;
+    }
+
+    return st.flush(writer);
+}
+
+std::vector<Graph::triple> Graph::grouped_triples() const {
+    std::vector<triple> ret(triples_.begin(), triples_.end());
+    util::parallel_radix_sort(ret, [](triple const &t) noexcept {
+        return std::array<uint64_t, 2>{t[0].to_underlying(), t[1].to_underlying()};
+    });
+
+    return ret;
+}
+
+bool Graph::serialize_turtle_grouped(writer::SerializationState &state, writer::BufWriterParts const writer) const {
+    for (auto const &[s, p, o] : grouped_triples()) {
+        Quad q{to_node(s), to_node(p), to_node(o)};
+        if (!q.serialize_turtle(state, writer)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Graph::serialize_turtle_grouped(writer::BufWriterParts const writer) const {
+    writer::SerializationState st{};
+    if (!st.begin(writer)) {
+        return false;
+    }
+
+    if (!serialize_turtle_grouped(st, writer)) {
+        return false;
+    }
+
+    return st.flush(writer);
+}
+
+bool Graph::serialize_turtle_grouped(writer::BufWriterParts const writer, writer::IRIPrefixMap const &prefixes) const {
+    writer::SerializationState st{.prefixes = &prefixes};
+    if (!writer::SerializationState::begin(writer, prefixes)) {
+        return false;
+    }
+
+    if (!serialize_turtle_grouped(st, writer)) {
+        return false;
+    }
+
+    return st.flush(writer);
+}
+
+size_t Graph::sample_namespaces(writer::PrefixDiscovery &discovery, size_t const sample_size) const {
+    size_t n = 0;
+    for (auto it = triples_.begin(); it != triples_.end() && n < sample_size; ++it, ++n) {
+        for (auto const id : *it) {
+            if (id.is_iri()) {
+                discovery.sample(to_node(id).as_iri().identifier());
+            }
+        }
+    }
+
+    return n;
+}
+
+writer::IRIPrefixMap Graph::discover_prefixes(size_t const max_prefixes, size_t const sample_size) const {
+    writer::PrefixDiscovery discovery;
+    sample_namespaces(discovery, sample_size);
+    return discovery.finish(max_prefixes);
+}
+
 std::ostream &operator<<(std::ostream &os, Graph const &graph) {
     writer::BufOStreamWriter w{os};
     graph.serialize(w);
@@ -123,39 +333,128 @@ bool Graph::iterator::operator!=(Graph::sentinel) const noexcept {
     return !(*this == Graph::sentinel{});
 }
 
+bool Graph::solution_iterator::at_end() const noexcept {
+    if (use_index_) {
+        return run_ == index_->runs.size();
+    }
+
+    return scan_iter_ == scan_end_;
+}
+
+Graph::triple Graph::solution_iterator::current() const noexcept {
+    if (use_index_) {
+        return unpermute(*index_iter_, perm_);
+    }
+
+    return *scan_iter_;
+}
+
+void Graph::solution_iterator::advance() noexcept {
+    if (use_index_) {
+        if (++index_iter_ == index_end_) {
+            ++run_;
+            seek_run();
+        }
+    } else {
+        ++scan_iter_;
+    }
+}
+
+void Graph::solution_iterator::seek_run() noexcept {
+    for (; run_ < index_->runs.size(); ++run_) {
+        auto const &run = index_->runs[run_];
+        index_iter_ = std::ranges::lower_bound(run, lower_);
+        index_end_ = std::upper_bound(index_iter_, run.end(), upper_);
+
+        if (index_iter_ != index_end_) {
+            return;
+        }
+    }
+}
+
 bool Graph::solution_iterator::check_solution() noexcept {
-    auto pat_it = pat_.begin();
+    auto const t = current();
     auto out_it = cur_.begin();
 
-    for (auto const x : *iter_) {
-        if (pat_it->is_variable()) {
-            out_it->second = x;
+    for (size_t ix = 0; ix < t.size(); ++ix) {
+        if (bound_ & (1 << ix)) {
+            if (pat_[ix] != t[ix]) {
+                return false;
+            }
+        } else {
+            out_it->second = parent_->to_node(t[ix]);
             ++out_it;
-        } else if (*pat_it != x) {
-            return false;
         }
-
-        ++pat_it;
     }
 
     return true;
 }
 
 void Graph::solution_iterator::forward_to_solution() noexcept {
-    while (iter_ != std::default_sentinel && !check_solution()) {
-        ++iter_;
+    while (!at_end() && !check_solution()) {
+        advance();
     }
 }
 
-Graph::solution_iterator::solution_iterator(typename Graph::iterator beg,
-                                            query::TriplePattern const &pat) noexcept : iter_{beg},
-                                                                                        pat_{pat},
+Graph::solution_iterator::solution_iterator(Graph const *parent,
+                                            query::TriplePattern const &pat) noexcept : parent_{parent},
                                                                                         cur_{pat} {
+    for (size_t ix = 0; ix < pat.size(); ++ix) {
+        if (pat[ix].is_variable()) {
+            continue;
+        }
+
+        auto const id = to_node_id(pat[ix].try_get_in_node_storage(parent_->node_storage_));
+        if (id.null()) {
+            // node is not in the node storage of the graph, so it cannot be part of any triple
+            // iterators stay default constructed, i.e. this iterator is exhausted
+            return;
+        }
+
+        pat_[ix] = id;
+        bound_ |= 1 << ix;
+    }
+
+    if (bound_ == 0 || !parent_->indices_.has_value()) {
+        scan_iter_ = parent_->triples_.begin();
+        scan_end_ = parent_->triples_.end();
+        forward_to_solution();
+        return;
+    }
+
+    // select the index for which the bound positions form a prefix of its permutation
+    auto const &indices = *parent_->indices_;
+    triple_index_type const *index;
+    size_t prefix_len;
+
+    switch (bound_) {
+        case 0b001: index = &indices.spo; perm_ = spo_permutation; prefix_len = 1; break;
+        case 0b011: index = &indices.spo; perm_ = spo_permutation; prefix_len = 2; break;
+        case 0b111: index = &indices.spo; perm_ = spo_permutation; prefix_len = 3; break;
+        case 0b010: index = &indices.pos; perm_ = pos_permutation; prefix_len = 1; break;
+        case 0b110: index = &indices.pos; perm_ = pos_permutation; prefix_len = 2; break;
+        case 0b100: index = &indices.osp; perm_ = osp_permutation; prefix_len = 1; break;
+        case 0b101: index = &indices.osp; perm_ = osp_permutation; prefix_len = 2; break;
+        default: {
+            assert(false);
+            __builtin_unreachable();
+        }
+    }
+
+    auto const key = permute(pat_, perm_);
+    for (size_t ix = 0; ix < key.size(); ++ix) {
+        lower_[ix] = ix < prefix_len ? key[ix] : storage::identifier::NodeBackendID{std::numeric_limits<storage::identifier::NodeBackendID::underlying_type>::min()};
+        upper_[ix] = ix < prefix_len ? key[ix] : storage::identifier::NodeBackendID{std::numeric_limits<storage::identifier::NodeBackendID::underlying_type>::max()};
+    }
+
+    use_index_ = true;
+    index_ = index;
+    seek_run();
     forward_to_solution();
 }
 
 Graph::solution_iterator &Graph::solution_iterator::operator++() noexcept {
-    ++iter_;
+    advance();
     forward_to_solution();
     return *this;
 }
@@ -169,11 +468,11 @@ Graph::solution_iterator::pointer Graph::solution_iterator::operator->() const n
 }
 
 bool Graph::solution_iterator::operator==(Graph::sentinel) const noexcept {
-    return iter_ == Graph::sentinel{};
+    return at_end();
 }
 
 bool Graph::solution_iterator::operator!=(Graph::sentinel) const noexcept {
-    return iter_ != Graph::sentinel{};
+    return !at_end();
 }
 
 }  // namespace rdf4cpp
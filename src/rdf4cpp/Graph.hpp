@@ -5,11 +5,15 @@
 #include <rdf4cpp/query/TriplePattern.hpp>
 #include <rdf4cpp/query/Solution.hpp>
 #include <rdf4cpp/writer/BufWriter.hpp>
+#include <rdf4cpp/writer/IRIPrefixMap.hpp>
 #include <rdf4cpp/writer/SerializationState.hpp>
 #include <rdf4cpp/parser/RDFFileParser.hpp>
 
 #include <dice/sparse-map/sparse_set.hpp>
 
+#include <optional>
+#include <vector>
+
 
 namespace rdf4cpp {
 
@@ -33,6 +37,56 @@ private:
 
     using triple_storage_type = dice::sparse_map::sparse_set<triple, triple_hash>;
 
+    /**
+     * Triples whose components are permuted according to a triple_permutation, stored in a few sorted runs (a log-structured merge).
+     * Triples sharing a prefix (in permuted order) are adjacent within every run,
+     * so a prefix is looked up with a binary search and a range scan per run.
+     *
+     * New triples are inserted into the last run, which is kept small (at most buffer_capacity triples).
+     * When it is full, runs of similar size are merged, so there are only O(log n) runs
+     * and every triple is moved O(log n) times (amortized).
+     *
+     * Memory: 24 bytes per triple (plus the size of the merged runs while merging),
+     * i.e. 72 bytes per triple for the three indices of a Graph.
+     * A node based std::set would need about 24 + 32 bytes per triple and has poor locality.
+     *
+     * @note triples must not be inserted more than once, this is ensured by the triple storage of the Graph
+     */
+    struct triple_index_type {
+        static constexpr size_t buffer_capacity = 256;
+
+        std::vector<std::vector<triple>> runs; //< every run is sorted, the sizes are (roughly) decreasing
+
+        void insert(triple const &t);
+
+        /**
+         * Replaces the contents of this index with the (unsorted, duplicate free) triples in values
+         */
+        void assign(std::vector<triple> values);
+    };
+
+    /**
+     * A permutation of the positions (0 = subject, 1 = predicate, 2 = object) of a triple.
+     * The i-th component of a permuted triple is the component at position perm[i] of the original triple.
+     */
+    using triple_permutation = std::array<uint8_t, 3>;
+
+    static constexpr triple_permutation spo_permutation{0, 1, 2};
+    static constexpr triple_permutation pos_permutation{1, 2, 0};
+    static constexpr triple_permutation osp_permutation{2, 0, 1};
+
+    /**
+     * Permutation indices used by match() to avoid scanning the whole graph.
+     * Every combination of bound positions in a TriplePattern is a prefix of one of these permutations.
+     */
+    struct triple_indices {
+        triple_index_type spo;
+        triple_index_type pos;
+        triple_index_type osp;
+
+        void insert(triple const &t);
+    };
+
 public:
     using sentinel = std::default_sentinel_t;
 
@@ -74,16 +128,45 @@ public:
         using reference = value_type const &;
 
     private:
-        typename Graph::iterator iter_;
-        query::TriplePattern pat_;
+        Graph const *parent_ = nullptr;
+        triple pat_{};        //< ids of the bound positions of the pattern, in the node storage of parent_
+        uint8_t bound_ = 0;   //< bitmask of the bound positions of the pattern (bit i set = position i is bound)
+
+        bool use_index_ = false;
+        triple_permutation perm_ = spo_permutation;
+        typename triple_storage_type::const_iterator scan_iter_{};
+        typename triple_storage_type::const_iterator scan_end_{};
+
+        triple_index_type const *index_ = nullptr;
+        size_t run_ = 0;      //< run of index_ that is currently scanned
+        triple lower_{};      //< smallest permuted triple that matches the pattern
+        triple upper_{};      //< largest permuted triple that matches the pattern
+        typename std::vector<triple>::const_iterator index_iter_{};
+        typename std::vector<triple>::const_iterator index_end_{};
+
         value_type cur_;
 
+        [[nodiscard]] bool at_end() const noexcept;
+        [[nodiscard]] triple current() const noexcept;
+        void advance() noexcept;
+
+        /**
+         * Moves to the first run, starting at run_, that contains triples in [lower_, upper_]
+         */
+        void seek_run() noexcept;
+
         bool check_solution() noexcept;
         void forward_to_solution() noexcept;
 
     public:
         solution_iterator() noexcept = default;
-        solution_iterator(typename Graph::iterator beg,
+
+        /**
+         * Creates an iterator over all solutions for pat in parent.
+         * If parent is indexed and pat has at least one bound position,
+         * only the matching range of the corresponding permutation index is scanned.
+         */
+        solution_iterator(Graph const *parent,
                           query::TriplePattern const &pat) noexcept;
 
         solution_iterator &operator++() noexcept;
@@ -125,18 +208,67 @@ public:
 private:
     storage::DynNodeStoragePtr node_storage_;
     triple_storage_type triples_;
+    std::optional<triple_indices> indices_;
 
     static storage::identifier::NodeBackendID to_node_id(Node node) noexcept;
     Node to_node(storage::identifier::NodeBackendID id) const noexcept;
 
+    /**
+     * Samples the IRIs of up to sample_size triples into discovery
+     * @return the number of sampled triples
+     */
+    size_t sample_namespaces(writer::PrefixDiscovery &discovery, size_t sample_size) const;
+
+    /**
+     * @return a copy of the triples of this graph, ordered by subject id and then by predicate id
+     */
+    std::vector<triple> grouped_triples() const;
+
+    /**
+     * Inserts a triple whose ids already belong to the node storage of this graph
+     */
+    void insert(triple const &t);
+
+    friend struct Dataset;
+
 public:
-    explicit Graph(storage::DynNodeStoragePtr node_storage = storage::default_node_storage) noexcept;
+    static constexpr size_t default_max_prefixes = 32;
+    static constexpr size_t default_prefix_sample_size = 1 << 16;
+
+    /**
+     * Creates an empty graph.
+     *
+     * @param node_storage node storage the nodes of this graph are stored in
+     * @param indexed if true, SPO, POS and OSP permutation indices are maintained for this graph (see build_index())
+     */
+    explicit Graph(storage::DynNodeStoragePtr node_storage = storage::default_node_storage, bool indexed = false) noexcept;
 
     void add(Statement const &statement);
 
     [[nodiscard]] size_t size() const noexcept;
     [[nodiscard]] bool contains(Statement const &statement) const noexcept;
 
+    /**
+     * Builds the SPO, POS and OSP permutation indices for this graph (if it does not have them already)
+     * and keeps them up to date on subsequent calls to add().
+     * With the indices in place, match() only scans the triples that agree with the bound positions of the given pattern
+     * instead of the whole graph, at the cost of storing every triple three more times (72 additional bytes per triple).
+     */
+    void build_index();
+
+    /**
+     * @return true if this graph maintains permutation indices
+     */
+    [[nodiscard]] bool is_indexed() const noexcept;
+
+    /**
+     * Finds all solutions for the given pattern in this graph.
+     * If this graph is indexed (see build_index()) and the pattern has at least one bound position,
+     * the lookup is a range scan over the matching index, otherwise the whole graph is scanned.
+     *
+     * @param triple_pattern pattern to match
+     * @return sequence of all solutions
+     */
     [[nodiscard]] solution_sequence match(query::TriplePattern const &triple_pattern) const noexcept;
 
     [[nodiscard]] iterator begin() const noexcept;
@@ -152,15 +284,29 @@ public:
             throw std::invalid_argument{"NodeStorage of the parsing state must be the same as NodeStorage of the Dataset"};
         }
 
-        parser::IStreamQuadIterator parser{rdf_file, flags, state};
-        for (; parser != std::default_sentinel; ++parser) {
-            auto const &quad = *parser;
-            if (quad.has_value()) {
-                add(Statement{quad->subject(), quad->predicate(), quad->object()});
-            } else {
-                std::invoke(errf, quad.error());
+        // the parsed ids are inserted directly, graph names are ignored
+        struct Sink final : parser::QuadSink {
+            Graph *self;
+            std::remove_reference_t<ErrF> *errf;
+
+            Sink(Graph *self, std::remove_reference_t<ErrF> *errf) noexcept : self{self}, errf{errf} {
             }
-        }
+
+            void on_quad(storage::identifier::NodeBackendID,
+                         storage::identifier::NodeBackendID const subject,
+                         storage::identifier::NodeBackendID const predicate,
+                         storage::identifier::NodeBackendID const object) override {
+                self->insert(triple{subject, predicate, object});
+            }
+
+            void on_error(parser::ParsingError const &error) override {
+                std::invoke(*errf, error);
+            }
+        };
+
+        parser::ParsingState default_state{.node_storage = node_storage_};
+        Sink sink{this, &errf};
+        parser::IStreamQuadIterator::parse_into(sink, rdf_file, flags, state != nullptr ? state : &default_state);
     }
 
     /**
@@ -171,6 +317,20 @@ public:
      */
     bool serialize(writer::BufWriterParts writer) const noexcept;
 
+    /**
+     * Serialize this graph as <a href="https://www.w3.org/TR/n-triples/">N-Triples</a> using multiple threads.
+     * The triples are split into chunks that are serialized into separate buffers by worker threads.
+     * The buffers are written to writer in order on the calling thread, so the output is identical to serialize(writer).
+     * Small graphs are serialized on the calling thread only.
+     *
+     * @param writer writer parts
+     * @param num_threads number of worker threads, 0 means std::thread::hardware_concurrency()
+     * @return true if serialization was successful, false if a call to W::flush was not able to make room
+     * @throws std::system_error if the worker threads cannot be started
+     * @warning the node storage of this graph is read from multiple threads, it must not be modified during serialization unless it is thread-safe
+     */
+    bool serialize_parallel(writer::BufWriterParts writer, size_t num_threads = 0) const;
+
     /**
      * Serialize this graph as <a href="https://www.w3.org/TR/rdf12-turtle/">Turtle</a>
      * This function does not call `begin` or `flush` on the given state,
@@ -191,6 +351,50 @@ public:
      */
     bool serialize_turtle(writer::BufWriterParts writer) const noexcept;
 
+    /**
+     * Serialize this graph as <a href="https://www.w3.org/TR/rdf12-turtle/">Turtle</a>, abbreviating IRIs with the given prefixes.
+     * The prefixes are declared at the beginning of the output.
+     *
+     * @param writer writer parts
+     * @param prefixes prefixes to use, for example from an IRIFactory or discover_prefixes()
+     * @return true if serialization was successful, false if a call to W::flush was not able to make room
+     */
+    bool serialize_turtle(writer::BufWriterParts writer, writer::IRIPrefixMap const &prefixes) const noexcept;
+
+    /**
+     * Serialize this graph as <a href="https://www.w3.org/TR/rdf12-turtle/">Turtle</a> with the triples grouped by subject and then by predicate,
+     * so that every subject (and every predicate per subject) is written only once, using predicate-object (;) and object (,) lists.
+     * The triples are ordered by the ids of their nodes (not lexicographically) using a parallel radix sort on a copy of the triples,
+     * no node is resolved for sorting.
+     * This function does not call `begin` or `flush` on the given state,
+     * it just serialized the contents of this Graph using it.
+     *
+     * @param writer writer parts
+     * @return true if serialization was successful, false if a call to W::flush was not able to make room
+     * @throws std::system_error if the sorting threads cannot be started
+     */
+    bool serialize_turtle_grouped(writer::SerializationState &state, writer::BufWriterParts writer) const;
+
+    /**
+     * Same as serialize_turtle_grouped(state, writer), but internally creates a SerializationState
+     * and calls `begin` and `flush` on it when appropriate.
+     */
+    bool serialize_turtle_grouped(writer::BufWriterParts writer) const;
+
+    /**
+     * Same as serialize_turtle_grouped(writer), but abbreviates IRIs with the given prefixes (see serialize_turtle(writer, prefixes))
+     */
+    bool serialize_turtle_grouped(writer::BufWriterParts writer, writer::IRIPrefixMap const &prefixes) const;
+
+    /**
+     * Finds the most frequent namespaces of the IRIs in (a sample of) this graph, see writer::PrefixDiscovery.
+     *
+     * @param max_prefixes maximum number of prefixes to return
+     * @param sample_size number of triples to sample, the sample is the first sample_size triples in iteration order
+     * @return prefixes for the most frequent namespaces, to be used in serialize_turtle
+     */
+    [[nodiscard]] writer::IRIPrefixMap discover_prefixes(size_t max_prefixes = default_max_prefixes, size_t sample_size = default_prefix_sample_size) const;
+
     /**
      * Serialize this graph as <a href="https://www.w3.org/TR/n-triples/">N-Triples</a>.
      */
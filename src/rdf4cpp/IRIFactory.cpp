@@ -201,7 +201,7 @@ nonstd::expected<IRI, IRIFactoryError> IRIFactory::from_relative(std::string_vie
     return create_and_validate(to_absolute(base_parts_cache, rel), node_storage);
 }
 
-nonstd::expected<IRI, IRIFactoryError> IRIFactory::from_prefix(std::string_view prefix, std::string_view local, storage::DynNodeStoragePtr node_storage) const {
+nonstd::expected<std::string_view, IRIFactoryError> IRIFactory::expand_prefix(std::string_view prefix, std::string_view local) const {
     auto i = prefixes.find(prefix);
     if (i == prefixes.end()) {
         return nonstd::make_unexpected(IRIFactoryError::UnknownPrefix);
@@ -212,12 +212,37 @@ nonstd::expected<IRI, IRIFactoryError> IRIFactory::from_prefix(std::string_view
     deref.reserve(i->second.size() + local.size());
     deref.append(i->second);
     deref.append(local);
+    return deref;
+}
+
+nonstd::expected<IRI, IRIFactoryError> IRIFactory::from_prefix(std::string_view prefix, std::string_view local, storage::DynNodeStoragePtr node_storage) const {
+    auto const deref = expand_prefix(prefix, local);
+    if (!deref.has_value()) {
+        return nonstd::make_unexpected(deref.error());
+    }
+
+    if (IRIView{*deref}.is_relative()) {
+        return from_relative(*deref, node_storage);
+    }
+
+    return create_and_validate(*deref, node_storage);
+}
+
+IRI IRIFactory::from_relative_unchecked(std::string_view rel, storage::DynNodeStoragePtr node_storage) const {
+    return IRI::make_unchecked(to_absolute(base_parts_cache, rel), node_storage);
+}
+
+nonstd::expected<IRI, IRIFactoryError> IRIFactory::from_prefix_unchecked(std::string_view prefix, std::string_view local, storage::DynNodeStoragePtr node_storage) const {
+    auto const deref = expand_prefix(prefix, local);
+    if (!deref.has_value()) {
+        return nonstd::make_unexpected(deref.error());
+    }
 
-    if (IRIView{deref}.is_relative()) {
-        return from_relative(deref, node_storage);
+    if (IRIView{*deref}.is_relative()) {
+        return from_relative_unchecked(*deref, node_storage);
     }
 
-    return create_and_validate(deref, node_storage);
+    return IRI::make_unchecked(*deref, node_storage);
 }
 
 nonstd::expected<IRI, IRIFactoryError> IRIFactory::create_and_validate(std::string_view iri, storage::DynNodeStoragePtr node_storage) noexcept {
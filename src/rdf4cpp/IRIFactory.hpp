@@ -22,6 +22,12 @@ private:
     std::string base;
     IRIView::AllParts base_parts_cache;
 
+    /**
+     * Looks up prefix and appends local to its expansion.
+     * @return a view into a thread local buffer that is valid until the next call
+     */
+    [[nodiscard]] nonstd::expected<std::string_view, IRIFactoryError> expand_prefix(std::string_view prefix, std::string_view local) const;
+
 public:
     constexpr static std::string_view default_base = "http://example.org/";
     /**
@@ -65,6 +71,24 @@ public:
      */
     [[nodiscard]] nonstd::expected<IRI, IRIFactoryError> from_prefix(std::string_view prefix, std::string_view local, storage::DynNodeStoragePtr node_storage = storage::default_node_storage) const;
 
+    /**
+     * Same as from_relative, but does not validate the resulting IRI.
+     * expects rel to be a valid (relative) IRI, otherwise the result is unspecified.
+     * @param rel
+     * @param storage
+     * @return
+     */
+    [[nodiscard]] IRI from_relative_unchecked(std::string_view rel, storage::DynNodeStoragePtr node_storage = storage::default_node_storage) const;
+    /**
+     * Same as from_prefix, but does not validate the resulting IRI.
+     * expects local to be valid, otherwise the result is unspecified. The only possible error is IRIFactoryError::UnknownPrefix.
+     * @param prefix
+     * @param local
+     * @param storage
+     * @return
+     */
+    [[nodiscard]] nonstd::expected<IRI, IRIFactoryError> from_prefix_unchecked(std::string_view prefix, std::string_view local, storage::DynNodeStoragePtr node_storage = storage::default_node_storage) const;
+
     /**
      * Creates or changes a prefix.
      * @param prefix
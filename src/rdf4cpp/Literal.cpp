@@ -55,6 +55,10 @@ Literal Literal::make_simple_unchecked(std::string_view lexical_form, bool needs
                                                           node_storage}};
 }
 
+Literal Literal::make_simple_unchecked(std::string_view lexical_form, storage::DynNodeStoragePtr node_storage) {
+    return Literal::make_simple_unchecked(lexical_form, lexical_form_needs_escape(lexical_form), node_storage);
+}
+
 Literal Literal::make_noninlined_typed_unchecked(std::string_view lexical_form, bool needs_escape, IRI const &datatype, storage::DynNodeStoragePtr node_storage) {
     return Literal{storage::identifier::NodeBackendHandle{node_storage.find_or_make_id(storage::view::LexicalFormLiteralBackendView{
                                                                 .datatype_id = datatype.to_node_storage(node_storage).backend_handle().id(),
@@ -64,7 +68,7 @@ Literal Literal::make_noninlined_typed_unchecked(std::string_view lexical_form,
                                                           node_storage}};
 }
 
-Literal Literal::make_noninlined_special_unchecked(std::any &&value, storage::identifier::LiteralType fixed_id, storage::DynNodeStoragePtr node_storage) {
+Literal Literal::make_noninlined_special_unchecked(datatypes::registry::AnyValue &&value, storage::identifier::LiteralType fixed_id, storage::DynNodeStoragePtr node_storage) {
     return Literal{storage::identifier::NodeBackendHandle{node_storage.find_or_make_id(storage::view::ValueLiteralBackendView{
                                                                 .datatype = fixed_id,
                                                                 .value = std::move(value)}),
@@ -80,6 +84,11 @@ Literal Literal::make_lang_tagged_unchecked(std::string_view lexical_form, bool
 
     return make_lang_tagged_unchecked_from_node_id(lang, node_storage, node_id);
 }
+
+Literal Literal::make_lang_tagged_unchecked(std::string_view lexical_form, std::string_view lang, storage::DynNodeStoragePtr node_storage) {
+    return Literal::make_lang_tagged_unchecked(lexical_form, lexical_form_needs_escape(lexical_form), lang, node_storage);
+}
+
 Literal Literal::make_lang_tagged_unchecked_from_node_id(std::string_view lang, storage::DynNodeStoragePtr node_storage, storage::identifier::NodeBackendID node_id) noexcept {
     using namespace storage::identifier;
 
@@ -111,7 +120,7 @@ Literal Literal::make_inlined_typed_unchecked(storage::identifier::LiteralID inl
                                      true}};
 }
 
-Literal Literal::make_typed_unchecked(std::any &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, storage::DynNodeStoragePtr node_storage) {
+Literal Literal::make_typed_unchecked(datatypes::registry::AnyValue &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, storage::DynNodeStoragePtr node_storage) {
     if (entry.inlining_ops.has_value()) {
         if (auto const maybe_inlined = entry.inlining_ops->try_into_inlined_fptr(value); maybe_inlined.has_value()) {
             return Literal::make_inlined_typed_unchecked(*maybe_inlined, datatype.get_fixed(), node_storage);
@@ -536,7 +545,7 @@ struct ConsumeSafe {
         return CowString{CowString::borrowed, lexical};
     }
 
-    [[nodiscard]] CowString operator()(std::any const &value, datatypes::registry::DatatypeRegistry::serialize_fptr_t serialize) const noexcept {
+    [[nodiscard]] CowString operator()(datatypes::registry::AnyValue const &value, datatypes::registry::DatatypeRegistry::serialize_fptr_t serialize) const noexcept {
         auto s = writer::StringWriter::oneshot([&value, serialize](writer::StringWriter &w) noexcept {
             return serialize(value, w);
         });
@@ -554,7 +563,7 @@ struct ConsumeMaybeSerialize {
         return FetchOrSerializeResult::Fetched;
     }
 
-    [[nodiscard]] FetchOrSerializeResult operator()(std::any const &value, datatypes::registry::DatatypeRegistry::serialize_fptr_t const serialize) const noexcept {
+    [[nodiscard]] FetchOrSerializeResult operator()(datatypes::registry::AnyValue const &value, datatypes::registry::DatatypeRegistry::serialize_fptr_t const serialize) const noexcept {
         if (!serialize(value, writer)) {
             return FetchOrSerializeResult::SerializationFailed;
         }
@@ -569,7 +578,7 @@ struct ConsumeSerialize {
         return writer::write_str(lexical_form, writer);
     }
 
-    bool operator()(std::any const &value, datatypes::registry::DatatypeRegistry::serialize_fptr_t const serialize) const noexcept {
+    bool operator()(datatypes::registry::AnyValue const &value, datatypes::registry::DatatypeRegistry::serialize_fptr_t const serialize) const noexcept {
         return serialize(value, writer);
     }
 };
@@ -836,7 +845,7 @@ std::ostream &operator<<(std::ostream &os, Literal const &literal) {
     return os;
 }
 
-std::any Literal::value() const noexcept {
+datatypes::registry::AnyValue Literal::value() const noexcept {
     using namespace datatypes;
 
     auto const datatype = this->datatype_id();
@@ -858,14 +867,14 @@ std::any Literal::value() const noexcept {
     if (datatype == rdf::LangString::datatype_id) {
         auto const &lex = backend.get_lexical();
 
-        return std::any{registry::LangStringRepr{
+        return registry::AnyValue{registry::LangStringRepr{
                 .lexical_form = lex.lexical_form,
                 .language_tag = lex.language_tag}};
     }
 
     if (datatype == xsd::String::datatype_id) {
         auto const &lex = backend.get_lexical();
-        return std::any{lex.lexical_form};
+        return registry::AnyValue{lex.lexical_form};
     }
 
     return backend.visit(
@@ -874,7 +883,7 @@ std::any Literal::value() const noexcept {
                     return factory(lexical_backend.lexical_form);
                 }
 
-                return std::any{};
+                return registry::AnyValue{};
             },
             [&datatype](storage::view::ValueLiteralBackendView const &value_backend) noexcept {
                 assert(value_backend.datatype == datatype);
@@ -963,7 +972,7 @@ Literal Literal::cast(IRI const &target, storage::DynNodeStoragePtr node_storage
 
     if (auto const common_conversion = DatatypeRegistry::get_common_type_conversion(this_e->conversion_table, target_e->conversion_table); common_conversion.has_value()) {
         // general cast
-        // TODO: if performance is bad split into separate cases for up-, down- and cross-casting to avoid one set of std::any wrapping and unwrapping for the former 2
+        // TODO: if performance is bad split into separate cases for up-, down- and cross-casting to avoid one set of AnyValue wrapping and unwrapping for the former 2
 
         auto const common_type_value = common_conversion->convert_lhs(this->value()); // upcast to common
         auto target_value = common_conversion->inverted_convert_rhs(common_type_value); // downcast to target
@@ -978,7 +987,324 @@ Literal Literal::cast(IRI const &target, storage::DynNodeStoragePtr node_storage
     return Literal{};
 }
 
-template<typename OpSelect>
+namespace inlined_ops_detail {
+
+using storage::identifier::LiteralID;
+using storage::identifier::LiteralType;
+
+template<typename... Ts>
+struct TypeList {};
+
+/**
+ * The integer datatypes, they are all numeric-stubs of xsd:integer (or xsd:integer itself)
+ * and all of their inlined values fit into an int64_t
+ */
+using integer_types = TypeList<datatypes::xsd::Integer, datatypes::xsd::NonPositiveInteger, datatypes::xsd::NegativeInteger,
+                               datatypes::xsd::Long, datatypes::xsd::Int, datatypes::xsd::Short, datatypes::xsd::Byte,
+                               datatypes::xsd::NonNegativeInteger, datatypes::xsd::PositiveInteger, datatypes::xsd::UnsignedLong,
+                               datatypes::xsd::UnsignedInt, datatypes::xsd::UnsignedShort, datatypes::xsd::UnsignedByte>;
+
+/**
+ * The non-integer inlineable datatypes that implement their numeric operations themselves
+ */
+using numeric_impl_types = TypeList<datatypes::xsd::Float, datatypes::xsd::Double, datatypes::xsd::Decimal>;
+
+/**
+ * All fixed-id datatypes that might be comparable and inlineable (rdf:langString is excluded, its inlined form also contains the language tag)
+ */
+using comparable_types = TypeList<datatypes::xsd::Boolean, datatypes::xsd::Float, datatypes::xsd::Double, datatypes::xsd::Decimal,
+                                  datatypes::xsd::Integer, datatypes::xsd::NonPositiveInteger, datatypes::xsd::NegativeInteger,
+                                  datatypes::xsd::Long, datatypes::xsd::Int, datatypes::xsd::Short, datatypes::xsd::Byte,
+                                  datatypes::xsd::NonNegativeInteger, datatypes::xsd::PositiveInteger, datatypes::xsd::UnsignedLong,
+                                  datatypes::xsd::UnsignedInt, datatypes::xsd::UnsignedShort, datatypes::xsd::UnsignedByte,
+                                  datatypes::xsd::GYear, datatypes::xsd::GMonth, datatypes::xsd::GDay, datatypes::xsd::GYearMonth,
+                                  datatypes::xsd::GMonthDay, datatypes::xsd::Date, datatypes::xsd::Time, datatypes::xsd::DateTime,
+                                  datatypes::xsd::DateTimeStamp, datatypes::xsd::Duration, datatypes::xsd::DayTimeDuration,
+                                  datatypes::xsd::YearMonthDuration>;
+
+/**
+ * The datatypes whose inlined values compare like the values themselves when the LiteralIDs are compared as integers
+ * (see util::try_pack_integral_ordered) and where equal values always have the same LiteralID.
+ * xsd:float and xsd:double are excluded because of NaN and signed zeros, xsd:gYear because its comparison can overflow.
+ */
+using raw_ordered_types = TypeList<datatypes::xsd::Boolean,
+                                   datatypes::xsd::Integer, datatypes::xsd::NonPositiveInteger, datatypes::xsd::NegativeInteger,
+                                   datatypes::xsd::Long, datatypes::xsd::Int, datatypes::xsd::Short, datatypes::xsd::Byte,
+                                   datatypes::xsd::NonNegativeInteger, datatypes::xsd::PositiveInteger, datatypes::xsd::UnsignedLong,
+                                   datatypes::xsd::UnsignedInt, datatypes::xsd::UnsignedShort, datatypes::xsd::UnsignedByte,
+                                   datatypes::xsd::Date, datatypes::xsd::DateTime, datatypes::xsd::DateTimeStamp,
+                                   datatypes::xsd::DayTimeDuration, datatypes::xsd::YearMonthDuration>;
+
+/**
+ * Tables indexed by LiteralType::to_underlying()
+ */
+template<typename Fptr>
+using literal_type_table = std::array<Fptr, size_t{1} << LiteralType::width>;
+
+using unpack_integer_fptr_t = int64_t (*)(LiteralID) noexcept;
+using compare_fptr_t = std::partial_ordering (*)(LiteralID, LiteralID) noexcept;
+using binop_fptr_t = Literal (*)(LiteralID, LiteralID, storage::DynNodeStoragePtr);
+
+template<typename... Ts>
+consteval literal_type_table<unpack_integer_fptr_t> make_unpack_integer_table(TypeList<Ts...>) noexcept {
+    literal_type_table<unpack_integer_fptr_t> table{};
+    ((table[Ts::fixed_id.to_underlying()] = [](LiteralID const inlined) noexcept {
+          return static_cast<int64_t>(Ts::from_inlined(inlined));
+      }), ...);
+    return table;
+}
+
+template<typename... Ts>
+consteval literal_type_table<compare_fptr_t> make_compare_table(TypeList<Ts...>) noexcept {
+    literal_type_table<compare_fptr_t> table{};
+    ([&table]() noexcept {
+        if constexpr (datatypes::ComparableLiteralDatatype<Ts> && datatypes::IsInlineable<Ts>) {
+            table[Ts::fixed_id.to_underlying()] = [](LiteralID const lhs, LiteralID const rhs) noexcept {
+                return Ts::compare(Ts::from_inlined(lhs), Ts::from_inlined(rhs));
+            };
+        }
+    }(), ...);
+    return table;
+}
+
+template<typename... Ts>
+consteval literal_type_table<bool> make_raw_ordered_table(TypeList<Ts...>) noexcept {
+    literal_type_table<bool> table{};
+    ((table[Ts::fixed_id.to_underlying()] = true), ...);
+    return table;
+}
+
+template<typename Op, typename... Ts>
+consteval literal_type_table<binop_fptr_t> make_binop_table(TypeList<Ts...>) noexcept {
+    literal_type_table<binop_fptr_t> table{};
+    ((table[Ts::fixed_id.to_underlying()] = [](LiteralID const lhs, LiteralID const rhs, storage::DynNodeStoragePtr const node_storage) {
+          using result_type = typename Op::template result_type<Ts>;
+
+          auto const res = Op::template apply<Ts>(Ts::from_inlined(lhs), Ts::from_inlined(rhs));
+          if (!res.has_value()) {
+              return Literal{};
+          }
+          return Literal::make_typed_from_value<result_type>(*res, node_storage);
+      }), ...);
+    return table;
+}
+
+constexpr literal_type_table<unpack_integer_fptr_t> unpack_integer_table = make_unpack_integer_table(integer_types{});
+constexpr literal_type_table<compare_fptr_t> compare_table = make_compare_table(comparable_types{});
+constexpr literal_type_table<bool> raw_ordered_table = make_raw_ordered_table(raw_ordered_types{});
+
+/**
+ * @return true if lhs and rhs are inlined literals of the same type and their LiteralIDs can be compared directly (see raw_ordered_types)
+ */
+inline bool is_raw_ordered(storage::identifier::NodeBackendHandle const &lhs, storage::identifier::NodeBackendHandle const &rhs) noexcept {
+    return lhs.is_inlined() && rhs.is_inlined()
+           && lhs.node_id().literal_type() == rhs.node_id().literal_type()
+           && raw_ordered_table[lhs.node_id().literal_type().to_underlying()];
+}
+
+template<typename Op>
+constexpr literal_type_table<binop_fptr_t> binop_table = make_binop_table<Op>(numeric_impl_types{});
+
+template<typename T, typename OpRes>
+using select_op_res = typename datatypes::registry::detail::SelectOpRes<OpRes, T>::type;
+
+/*
+ * The operations for the fast path of numeric_binop_impl.
+ * integer is the operation on (unpacked) inlined integers of any integer datatype, its result has the datatype xsd:integer.
+ * It returns std::nullopt if the result cannot be calculated on int64_t, in that case the general path is taken.
+ * apply is the operation on values of one of numeric_impl_types.
+ */
+
+struct Add {
+    template<typename T>
+    using result_type = select_op_res<T, typename T::add_result>;
+
+    static std::optional<int64_t> integer(int64_t const lhs, int64_t const rhs) noexcept {
+        int64_t res;
+        if (__builtin_add_overflow(lhs, rhs, &res)) {
+            return std::nullopt;
+        }
+        return res;
+    }
+
+    template<typename T>
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::add(lhs, rhs);
+    }
+};
+
+struct Sub {
+    template<typename T>
+    using result_type = select_op_res<T, typename T::sub_result>;
+
+    static std::optional<int64_t> integer(int64_t const lhs, int64_t const rhs) noexcept {
+        int64_t res;
+        if (__builtin_sub_overflow(lhs, rhs, &res)) {
+            return std::nullopt;
+        }
+        return res;
+    }
+
+    template<typename T>
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::sub(lhs, rhs);
+    }
+};
+
+struct Mul {
+    template<typename T>
+    using result_type = select_op_res<T, typename T::mul_result>;
+
+    static std::optional<int64_t> integer(int64_t const lhs, int64_t const rhs) noexcept {
+        int64_t res;
+        if (__builtin_mul_overflow(lhs, rhs, &res)) {
+            return std::nullopt;
+        }
+        return res;
+    }
+
+    template<typename T>
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::mul(lhs, rhs);
+    }
+};
+
+struct Div {
+    template<typename T>
+    using result_type = select_op_res<T, typename T::div_result>;
+
+    static std::optional<int64_t> integer(int64_t, int64_t) noexcept {
+        return std::nullopt; // the result of integer division is an xsd:decimal
+    }
+
+    template<typename T>
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::div(lhs, rhs);
+    }
+};
+
+/**
+ * Applies Op directly to the values of two inlined literals, without going through the DatatypeRegistry.
+ *
+ * @return the result, or std::nullopt if the fast path is not applicable
+ */
+template<typename Op>
+std::optional<Literal> numeric_binop(storage::identifier::NodeID const lhs, storage::identifier::NodeID const rhs, storage::DynNodeStoragePtr const node_storage) {
+    auto const lhs_type = lhs.literal_type().to_underlying();
+    auto const rhs_type = rhs.literal_type().to_underlying();
+
+    auto const unpack_lhs = unpack_integer_table[lhs_type];
+    auto const unpack_rhs = unpack_integer_table[rhs_type];
+    if (unpack_lhs != nullptr && unpack_rhs != nullptr) {
+        if (auto const res = Op::integer(unpack_lhs(lhs.literal_id()), unpack_rhs(rhs.literal_id())); res.has_value()) {
+            return Literal::make_typed_from_value<datatypes::xsd::Integer>(datatypes::xsd::Integer::cpp_type{*res}, node_storage);
+        }
+        return std::nullopt;
+    }
+
+    if (lhs_type == rhs_type) {
+        if (auto const binop = binop_table<Op>[lhs_type]; binop != nullptr) {
+            return binop(lhs.literal_id(), rhs.literal_id(), node_storage);
+        }
+    }
+
+    return std::nullopt;
+}
+
+} // namespace inlined_ops_detail
+
+namespace numeric_promotion_detail {
+
+using inlined_ops_detail::TypeList;
+using storage::identifier::LiteralType;
+using convert_fptr_t = datatypes::registry::RuntimeConversionEntry::convert_fptr_t;
+
+/**
+ * The fixed-id numeric datatypes, for these the promotion to a common type is known at compile time
+ */
+using numeric_types = TypeList<datatypes::xsd::Float, datatypes::xsd::Double, datatypes::xsd::Decimal,
+                               datatypes::xsd::Integer, datatypes::xsd::NonPositiveInteger, datatypes::xsd::NegativeInteger,
+                               datatypes::xsd::Long, datatypes::xsd::Int, datatypes::xsd::Short, datatypes::xsd::Byte,
+                               datatypes::xsd::NonNegativeInteger, datatypes::xsd::PositiveInteger, datatypes::xsd::UnsignedLong,
+                               datatypes::xsd::UnsignedInt, datatypes::xsd::UnsignedShort, datatypes::xsd::UnsignedByte>;
+
+/**
+ * The result of DatatypeRegistry::get_common_numeric_op_type_conversion for a pair of fixed-id numeric datatypes
+ */
+struct NumericPromotion {
+    LiteralType common_type;
+    convert_fptr_t convert_lhs;
+    convert_fptr_t convert_rhs;
+};
+
+/**
+ * The part of DatatypeRegistry::DatatypeConverter that is needed to apply a numeric operation to two values of different datatypes
+ */
+struct Equalizer {
+    datatypes::registry::DatatypeIDView target_type_id;
+    convert_fptr_t convert_lhs;
+    convert_fptr_t convert_rhs;
+};
+
+static constexpr uint8_t invalid_index = 0xFF;
+
+/**
+ * Maps LiteralType::to_underlying() to the position of the datatype in Ts, or invalid_index if it is not one of Ts
+ */
+template<typename... Ts>
+consteval inlined_ops_detail::literal_type_table<uint8_t> make_index_table(TypeList<Ts...>) noexcept {
+    inlined_ops_detail::literal_type_table<uint8_t> table{};
+    table.fill(invalid_index);
+
+    uint8_t ix = 0;
+    ((table[Ts::fixed_id.to_underlying()] = ix++), ...);
+    return table;
+}
+
+template<typename Lhs, typename Rhs>
+consteval NumericPromotion make_promotion() noexcept {
+    using conversion = datatypes::registry::CommonNumericOpConversion<Lhs, Rhs>;
+    using datatypes::registry::RuntimeConversionEntry;
+
+    return NumericPromotion{.common_type = conversion::common_type::fixed_id,
+                            .convert_lhs = &RuntimeConversionEntry::erased_convert<typename conversion::lhs_conversion>,
+                            .convert_rhs = &RuntimeConversionEntry::erased_convert<typename conversion::rhs_conversion>};
+}
+
+template<typename Lhs, typename... Rhs>
+consteval std::array<NumericPromotion, sizeof...(Rhs)> make_promotion_row() noexcept {
+    return {make_promotion<Lhs, Rhs>()...};
+}
+
+template<typename... Ts>
+consteval std::array<std::array<NumericPromotion, sizeof...(Ts)>, sizeof...(Ts)> make_promotion_table(TypeList<Ts...>) noexcept {
+    return {make_promotion_row<Ts, Ts...>()...};
+}
+
+static constexpr auto index_table = make_index_table(numeric_types{});
+
+/**
+ * promotion_table[index_table[lhs]][index_table[rhs]] is the promotion of lhs and rhs to their common type
+ */
+static constexpr auto promotion_table = make_promotion_table(numeric_types{});
+
+/**
+ * @return the promotion of lhs and rhs to their common type, or nullptr if one of them is not a fixed-id numeric datatype
+ */
+inline NumericPromotion const *find(LiteralType const lhs, LiteralType const rhs) noexcept {
+    auto const lhs_ix = index_table[lhs.to_underlying()];
+    auto const rhs_ix = index_table[rhs.to_underlying()];
+
+    if (lhs_ix == invalid_index || rhs_ix == invalid_index) {
+        return nullptr;
+    }
+
+    return &promotion_table[lhs_ix][rhs_ix];
+}
+
+} // namespace numeric_promotion_detail
+
+template<typename InlinedOp, typename OpSelect>
     requires std::is_nothrow_invocable_r_v<datatypes::registry::DatatypeRegistry::binop_fptr_t, OpSelect, datatypes::registry::DatatypeRegistry::NumericOpsImpl const &>
 Literal Literal::numeric_binop_impl(OpSelect op_select, Literal const &other, storage::DynNodeStoragePtr node_storage) const {
     using namespace datatypes::registry;
@@ -989,6 +1315,13 @@ Literal Literal::numeric_binop_impl(OpSelect op_select, Literal const &other, st
         return Literal{};
     }
 
+    if (this->handle_.is_inlined() && other.handle_.is_inlined()) {
+        // fast path: no registry lookups and no boxing of the values
+        if (auto res = inlined_ops_detail::numeric_binop<InlinedOp>(this->handle_.node_id(), other.handle_.node_id(), node_storage); res.has_value()) {
+            return *res;
+        }
+    }
+
     auto const this_datatype = this->datatype_id();
     auto const *this_entry = DatatypeRegistry::get_entry(this_datatype);
     assert(this_entry != nullptr);
@@ -1025,8 +1358,25 @@ Literal Literal::numeric_binop_impl(OpSelect op_select, Literal const &other, st
             return Literal{};  // not numeric
         }
 
-        auto const equalizer = DatatypeRegistry::get_common_numeric_op_type_conversion(*this_entry,
-                                                                                       *other_entry);
+        auto const equalizer = [&]() noexcept -> std::optional<numeric_promotion_detail::Equalizer> {
+            if (this_datatype.is_fixed() && other_datatype.is_fixed()) {
+                // the common type of two builtin numeric datatypes is known at compile time
+                if (auto const *promotion = numeric_promotion_detail::find(this_datatype.get_fixed(), other_datatype.get_fixed()); promotion != nullptr) {
+                    return numeric_promotion_detail::Equalizer{.target_type_id = DatatypeIDView{promotion->common_type},
+                                                               .convert_lhs = promotion->convert_lhs,
+                                                               .convert_rhs = promotion->convert_rhs};
+                }
+            }
+
+            auto const conversion = DatatypeRegistry::get_common_numeric_op_type_conversion(*this_entry, *other_entry);
+            if (!conversion.has_value()) {
+                return std::nullopt;
+            }
+
+            return numeric_promotion_detail::Equalizer{.target_type_id = conversion->target_type_id,
+                                                       .convert_lhs = conversion->convert_lhs,
+                                                       .convert_rhs = conversion->convert_rhs};
+        }();
 
         if (!equalizer.has_value()) {
             return Literal{};  // not convertible
@@ -1141,6 +1491,11 @@ std::partial_ordering Literal::compare_impl(Literal const &other, std::strong_or
         return std::partial_ordering::equivalent;
     }
 
+    if (inlined_ops_detail::is_raw_ordered(this->handle_, other.handle_)) {
+        // equal values have equal ids and therefore equal lexical forms, so the alternative ordering is never needed
+        return this->handle_.node_id().literal_id() <=> other.handle_.node_id().literal_id();
+    }
+
     auto const this_datatype = this->datatype_id();
     auto const other_datatype = other.datatype_id();
 
@@ -1154,6 +1509,13 @@ std::partial_ordering Literal::compare_impl(Literal const &other, std::strong_or
             *out_alternative_ordering = this->lexical_form() <=> other.lexical_form();
         }
 
+        if (this->handle_.is_inlined() && other.handle_.is_inlined()) {
+            // fast path: compare the inlined values directly, without boxing them
+            if (auto const compare = inlined_ops_detail::compare_table[this->handle_.node_id().literal_type().to_underlying()]; compare != nullptr) {
+                return compare(this->handle_.node_id().literal_id(), other.handle_.node_id().literal_id());
+            }
+        }
+
         if (this_entry == nullptr || this_entry->compare_fptr == nullptr) {
             return std::partial_ordering::unordered;
         }
@@ -1200,6 +1562,21 @@ std::partial_ordering Literal::compare(Literal const &other) const noexcept {
 }
 
 std::strong_ordering Literal::order(Literal const &other) const noexcept {
+    // xsd:string literals are ordered by their lexical form,
+    // which is the order of their ids if the node storage assigns them in lexical order
+    if (!this->handle_.null() && !other.handle_.null()
+        && !this->is_inlined() && !other.is_inlined()
+        && this->datatype_eq<datatypes::xsd::String>() && other.datatype_eq<datatypes::xsd::String>()
+        && this->handle_.storage() == other.handle_.storage()
+        && this->handle_.storage().has_lexically_ordered_ids(storage::identifier::RDFNodeType::Literal)) {
+        return this->handle_.node_id().literal_id() <=> other.handle_.node_id().literal_id();
+    }
+
+    // inlined literals of some types are ordered by their ids (see inlined_ops_detail::raw_ordered_types)
+    if (inlined_ops_detail::is_raw_ordered(this->handle_, other.handle_)) {
+        return this->handle_.node_id().literal_id() <=> other.handle_.node_id().literal_id();
+    }
+
     // default to equivalent; as required by compare_impl
     // see doc for compare_impl
     std::strong_ordering alternative_cmp_res = std::strong_ordering::equivalent;
@@ -1486,14 +1863,14 @@ std::optional<Literal> Literal::chrono_add_impl(Literal const &other, storage::D
 
     if (this_entry->timepoint_ops.has_value()) {
         return run_binop_cast_rhs(other, *other_entry, this_entry->timepoint_ops->timepoint_duration_type, node_storage,
-            [this_entry](std::any const &lhs, std::any const &rhs) noexcept {
+            [this_entry](AnyValue const &lhs, AnyValue const &rhs) noexcept {
                 return this_entry->timepoint_ops->timepoint_duration_add(lhs, rhs);
             });
     }
 
     if (this_entry->duration_ops.has_value()) {
         return run_binop(other, this_datatype, *this_entry, other_datatype, *other_entry, node_storage,
-            [](DatatypeRegistry::DatatypeEntry const &entry, std::any const &lhs, std::any const &rhs) noexcept {
+            [](DatatypeRegistry::DatatypeEntry const &entry, AnyValue const &lhs, AnyValue const &rhs) noexcept {
                 assert(entry.duration_ops.has_value());
                 return entry.duration_ops->duration_add(lhs, rhs);
             });
@@ -1513,7 +1890,7 @@ Literal Literal::add(Literal const &other, storage::DynNodeStoragePtr node_stora
         return *res;
     }
 
-    return this->numeric_binop_impl(
+    return this->numeric_binop_impl<inlined_ops_detail::Add>(
             [](auto const &num_ops) noexcept {
                 return num_ops.add_fptr;
             },
@@ -1559,7 +1936,7 @@ std::optional<Literal> Literal::chrono_sub_impl(Literal const &other, storage::D
         if (other_entry->timepoint_ops.has_value()) {
             // timepoint - timepoint
             return run_binop(other, this_datatype, *this_entry, other_datatype, *other_entry, node_storage,
-                [](DatatypeRegistry::DatatypeEntry const &entry, std::any const &lhs, std::any const &rhs) noexcept {
+                [](DatatypeRegistry::DatatypeEntry const &entry, AnyValue const &lhs, AnyValue const &rhs) noexcept {
                     assert(entry.timepoint_ops.has_value());
                     return entry.timepoint_ops->timepoint_sub(lhs, rhs);
                 });
@@ -1568,7 +1945,7 @@ std::optional<Literal> Literal::chrono_sub_impl(Literal const &other, storage::D
         if (other_entry->duration_ops.has_value()) {
             // timepoint - duration
             return run_binop_cast_rhs(other, *other_entry, this_entry->timepoint_ops->timepoint_duration_type, node_storage,
-                [this_entry](std::any const &lhs, std::any const &rhs) noexcept {
+                [this_entry](AnyValue const &lhs, AnyValue const &rhs) noexcept {
                     return this_entry->timepoint_ops->timepoint_duration_sub(lhs, rhs);
                 });
         }
@@ -1577,7 +1954,7 @@ std::optional<Literal> Literal::chrono_sub_impl(Literal const &other, storage::D
     if (this_entry->duration_ops.has_value() && other_entry->duration_ops.has_value()) {
         // duration  - duration
         return run_binop(other, this_datatype, *this_entry, other_datatype, *other_entry, node_storage,
-            [](DatatypeRegistry::DatatypeEntry const &entry, std::any const &lhs, std::any const &rhs) noexcept {
+            [](DatatypeRegistry::DatatypeEntry const &entry, AnyValue const &lhs, AnyValue const &rhs) noexcept {
                 assert(entry.duration_ops.has_value());
                 return entry.duration_ops->duration_sub(lhs, rhs);
             });
@@ -1597,7 +1974,7 @@ Literal Literal::sub(Literal const &other, storage::DynNodeStoragePtr node_stora
         return *res;
     }
 
-    return this->numeric_binop_impl(
+    return this->numeric_binop_impl<inlined_ops_detail::Sub>(
             [](auto const &num_ops) noexcept {
                 return num_ops.sub_fptr;
             },
@@ -1647,7 +2024,7 @@ std::optional<Literal> Literal::chrono_mul_impl(Literal const &other, storage::D
 
     // duration * scalar
     return run_binop_cast_rhs(other, *other_entry, this_entry->duration_ops->duration_scalar_type, node_storage,
-        [this_entry](std::any const &lhs, std::any const &rhs) noexcept {
+        [this_entry](AnyValue const &lhs, AnyValue const &rhs) noexcept {
             return this_entry->duration_ops->duration_scalar_mul(lhs, rhs);
         });
 }
@@ -1663,7 +2040,7 @@ Literal Literal::mul(Literal const &other, storage::DynNodeStoragePtr node_stora
         return *res;
     }
 
-    return this->numeric_binop_impl(
+    return this->numeric_binop_impl<inlined_ops_detail::Mul>(
             [](auto const &num_ops) noexcept {
                 return num_ops.mul_fptr;
             },
@@ -1714,7 +2091,7 @@ std::optional<Literal> Literal::chrono_div_impl(Literal const &other, storage::D
         // this & other are durations
 
         auto const binop_res = run_binop(other, this_datatype, *this_entry, other_datatype, *other_entry, node_storage,
-            [](DatatypeRegistry::DatatypeEntry const &entry, std::any const &lhs, std::any const &rhs) noexcept {
+            [](DatatypeRegistry::DatatypeEntry const &entry, AnyValue const &lhs, AnyValue const &rhs) noexcept {
                 assert(entry.duration_ops.has_value());
                 return entry.duration_ops->duration_div(lhs, rhs);
             });
@@ -1726,7 +2103,7 @@ std::optional<Literal> Literal::chrono_div_impl(Literal const &other, storage::D
     if (other_entry->numeric_ops.has_value()) {
         // this is duration & other is scalar
         return run_binop_cast_rhs(other, *other_entry, this_entry->duration_ops->duration_scalar_type, node_storage,
-            [this_entry](std::any const &lhs, std::any const &rhs) noexcept {
+            [this_entry](AnyValue const &lhs, AnyValue const &rhs) noexcept {
                 return this_entry->duration_ops->duration_scalar_div(lhs, rhs);
             });
     }
@@ -1745,7 +2122,7 @@ Literal Literal::div(Literal const &other, storage::DynNodeStoragePtr node_stora
         return *res;
     }
 
-    return this->numeric_binop_impl(
+    return this->numeric_binop_impl<inlined_ops_detail::Div>(
             [](auto const &num_ops) noexcept {
                 return num_ops.div_fptr;
             },
@@ -2,7 +2,6 @@
 #define RDF4CPP_LITERAL_HPP
 
 
-#include <any>
 #include <optional>
 #include <ostream>
 #include <random>
@@ -34,6 +33,7 @@ private:
     /**
      * the implementation for all numeric, binary operations
      *
+     * @tparam InlinedOp the operation used directly on the values if both operands are inlined (see inlined_ops_detail in Literal.cpp)
      * @tparam OpSelect a function NumericOps -> binop_fptr_t
      * @param op_select is used to select the specific operation to be carried out
      * @param other rhs of the operation
@@ -41,7 +41,7 @@ private:
      * @return the literal resulting from the selected binop or Literal{} if the types are not
      *      convertible to a common type or the common type is not numeric
      */
-    template<typename OpSelect>
+    template<typename InlinedOp, typename OpSelect>
         requires std::is_nothrow_invocable_r_v<datatypes::registry::DatatypeRegistry::binop_fptr_t, OpSelect, datatypes::registry::DatatypeRegistry::NumericOpsImpl const &>
     [[nodiscard]] Literal numeric_binop_impl(OpSelect op_select, Literal const &other, storage::DynNodeStoragePtr node_storage) const;
 
@@ -66,7 +66,7 @@ private:
      * @param other_datatype `other.datatype_id()`
      * @param other_entry datatype entry of other
      * @param node_storage the node storage the resulting value will be placed in
-     * @param op function with signature `DatatypeRegistry::OpResult(DatatypeEntry const &equalized_entry, std::any const &equalized_lhs, std::any const &equalized_rhs)` to perform the operation
+     * @param op function with signature `DatatypeRegistry::OpResult(DatatypeEntry const &equalized_entry, AnyValue const &equalized_lhs, AnyValue const &equalized_rhs)` to perform the operation
      * @return
      *  - nullopt if there is no conversion for *this and other
      *  - null-literal if there was a conversion but some operation failed
@@ -88,7 +88,7 @@ private:
      * @param other_entry datatype entry of other
      * @param other_target the target type other is supposed to be cast to
      * @param node_storage node storage the resulting value will be placed in
-     * @param op function with signature `DatatypeRegistry::OpResult(std::any const &lhs_original, std::any const &rhs_casted)`
+     * @param op function with signature `DatatypeRegistry::OpResult(AnyValue const &lhs_original, AnyValue const &rhs_casted)`
      * @return
      *  - nullopt if other could not be cast
      *  - null-literal if other could be cast but the binary operation failed
@@ -215,7 +215,7 @@ private:
      */
     [[nodiscard]] static Literal make_noninlined_typed_unchecked(std::string_view lexical_form, bool needs_escape, IRI const &datatype, storage::DynNodeStoragePtr node_storage);
 
-    [[nodiscard]] static Literal make_noninlined_special_unchecked(std::any &&value, storage::identifier::LiteralType fixed_id, storage::DynNodeStoragePtr node_storage);
+    [[nodiscard]] static Literal make_noninlined_special_unchecked(datatypes::registry::AnyValue &&value, storage::identifier::LiteralType fixed_id, storage::DynNodeStoragePtr node_storage);
 
     /**
      * Creates an inlined Literal without any safety checks
@@ -228,7 +228,7 @@ private:
     /**
      * Creates an inlined or non-inlined typed Literal without any safety checks
      */
-    [[nodiscard]] static Literal make_typed_unchecked(std::any &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, storage::DynNodeStoragePtr node_storage);
+    [[nodiscard]] static Literal make_typed_unchecked(datatypes::registry::AnyValue &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, storage::DynNodeStoragePtr node_storage);
 
     /**
      * Creates a language-tagged Literal directly without any safety checks
@@ -285,10 +285,10 @@ private:
      * Serializes the lexical form into consume.
      *
      * @tparam simplified whether to serialize the simplified or canonical lexical_form
-     * @param consume a function-like object that is invocable with a std::string_view or (std::any, datatypes::registry::DatatypeRegistry::serialize_fptr_t)
+     * @param consume a function-like object that is invocable with a std::string_view or (AnyValue, datatypes::registry::DatatypeRegistry::serialize_fptr_t)
      *      In case it is invoked with a std::string_view, that view will come from the node storage and can be considered to be of static lifetime.
      *      In case it is invoked with the other parameters, the lexical form is not yet materialized and consume is responsible for materializing it
-     *          using the value (std::any) and serialization function (datatypes::registry::DatatypeRegistry::serialize_fptr_t) provided.
+     *          using the value (AnyValue) and serialization function (datatypes::registry::DatatypeRegistry::serialize_fptr_t) provided.
      *
      * @return whatever consume returned
      */
@@ -325,6 +325,16 @@ public:
      */
     [[nodiscard]] static Literal make_simple_normalize(std::string_view lexical_form, storage::DynNodeStoragePtr node_storage = storage::default_node_storage);
 
+    /**
+     * Constructs a simple Literal from a lexical form without validating it. Datatype is `xsd:string`.
+     * Intended for input that is known to be valid, e.g. when parsing trusted data.
+     * Whether the lexical form needs escaping is determined from lexical_form.
+     * @pre lexical_form is valid UTF-8
+     * @param lexical_form the lexical form
+     * @param node_storage node_storage used to store the literal
+     */
+    [[nodiscard]] static Literal make_simple_unchecked(std::string_view lexical_form, storage::DynNodeStoragePtr node_storage);
+
     /**
      * Constructs a Literal from a lexical form and a language tag. The datatype is `rdf:langString`.
      * @param lexical_form the lexical form
@@ -344,6 +354,18 @@ public:
      */
     [[nodiscard]] static Literal make_lang_tagged_normalize(std::string_view lexical_form, std::string_view lang_tag,
                                                             storage::DynNodeStoragePtr node_storage = storage::default_node_storage);
+
+    /**
+     * Constructs a Literal from a lexical form and a language tag without validating them. The datatype is `rdf:langString`.
+     * Intended for input that is known to be valid, e.g. when parsing trusted data.
+     * Whether the lexical form needs escaping is determined from lexical_form.
+     * @pre lexical_form is valid UTF-8 and lang_tag is already lowercase
+     * @param lexical_form the lexical form
+     * @param lang_tag the language tag
+     * @param node_storage node_storage used to store the literal
+     */
+    [[nodiscard]] static Literal make_lang_tagged_unchecked(std::string_view lexical_form, std::string_view lang_tag, storage::DynNodeStoragePtr node_storage);
+
     /**
      * Constructs a Literal from a lexical form and a datatype.
      * @param lexical_form the lexical form
@@ -382,7 +404,7 @@ public:
 
         if constexpr (datatypes::HasFixedId<T>) {
             if (node_storage.has_specialized_storage_for(T::fixed_id)) {
-                return Literal::make_noninlined_special_unchecked(std::any{std::move(value)}, T::fixed_id, node_storage);
+                return Literal::make_noninlined_special_unchecked(datatypes::registry::AnyValue{std::move(value)}, T::fixed_id, node_storage);
             }
         }
 
@@ -431,7 +453,7 @@ public:
             if (node_storage.has_specialized_storage_for(T::fixed_id)) {
                 return Literal{storage::identifier::NodeBackendHandle{node_storage.find_or_make_id(storage::view::ValueLiteralBackendView{
                                                                                                         .datatype = T::fixed_id,
-                                                                                                        .value = std::any{compatible_value}}),
+                                                                                                        .value = datatypes::registry::AnyValue{compatible_value}}),
                                                                       node_storage}};
             }
         }
@@ -547,7 +569,7 @@ public:
             if (node_storage.has_specialized_storage_for(T::fixed_id)) {
                 auto nid = node_storage.find_id(storage::view::ValueLiteralBackendView{
                         .datatype = T::fixed_id,
-                        .value = std::any{compatible_value}});
+                        .value = datatypes::registry::AnyValue{compatible_value}});
                 if (nid.null())
                     return Literal{};
                 return Literal{storage::identifier::NodeBackendHandle{nid, node_storage}};
@@ -604,7 +626,7 @@ public:
             if (node_storage.has_specialized_storage_for(T::fixed_id)) {
                 auto nid = node_storage.find_id(storage::view::ValueLiteralBackendView{
                         .datatype = T::fixed_id,
-                        .value = std::any{value}});
+                        .value = datatypes::registry::AnyValue{value}});
                 if (nid.null())
                     return Literal{};
                 return Literal{storage::identifier::NodeBackendHandle{nid, node_storage}};
@@ -771,7 +793,7 @@ public:
                 auto value = this->template value<Boolean>() ? target_e->numeric_ops->get_impl().one_value_fptr()
                                                              : target_e->numeric_ops->get_impl().zero_value_fptr();
 
-                return std::any_cast<typename T::cpp_type>(value);
+                return datatypes::registry::any_cast<typename T::cpp_type>(value);
             } else {
                 auto const &impl_converter = DatatypeRegistry::get_numeric_op_impl_conversion(*target_e);
                 auto const *target_num_impl = DatatypeRegistry::get_numerical_ops(impl_converter.target_type_id);
@@ -789,7 +811,7 @@ public:
                     return std::nullopt;
                 }
 
-                return std::any_cast<typename T::cpp_type>(*target_value);
+                return datatypes::registry::any_cast<typename T::cpp_type>(*target_value);
             }
         }
 
@@ -801,7 +823,7 @@ public:
 
         if (auto const common_conversion = DatatypeRegistry::get_common_type_conversion(this_e->conversion_table, target_e->conversion_table); common_conversion.has_value()) {
             // general cast
-            // TODO: if performance is bad split into separate cases for up-, down- and cross-casting to avoid one set of std::any wrapping and unwrapping for the former 2
+            // TODO: if performance is bad split into separate cases for up-, down- and cross-casting to avoid one set of AnyValue wrapping and unwrapping for the former 2
 
             auto const common_type_value = common_conversion->convert_lhs(this->value()); // upcast to common
             auto target_value = common_conversion->inverted_convert_rhs(common_type_value); // downcast to target
@@ -809,7 +831,7 @@ public:
                 // downcast failed
                 return std::nullopt;
             }
-            return std::any_cast<typename T::cpp_type>(*target_value);
+            return datatypes::registry::any_cast<typename T::cpp_type>(*target_value);
         }
 
         // no conversion found
@@ -938,9 +960,9 @@ public:
 
     /**
      * Constructs a datatype specific container from Literal.
-     * @return std::any wrapped value. will be empty if type is not registered.
+     * @return AnyValue wrapped value. will be empty if type is not registered.
      */
-    [[nodiscard]] std::any value() const noexcept;
+    [[nodiscard]] datatypes::registry::AnyValue value() const noexcept;
 
     /**
      * Get the value of an literal. T must be the registered datatype for the datatype iri.
@@ -986,7 +1008,7 @@ public:
                 },
                 [](storage::view::ValueLiteralBackendView const &any) noexcept {
                     assert(any.datatype == T::datatype_id);
-                    return std::any_cast<typename T::cpp_type>(any.value);
+                    return datatypes::registry::any_cast<typename T::cpp_type>(any.value);
                 });
     }
 
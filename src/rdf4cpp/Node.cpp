@@ -199,8 +199,17 @@ std::strong_ordering Node::order(Node const &other) const noexcept {
     }
 
     switch (this->handle_.type()) {
-        case storage::identifier::RDFNodeType::IRI:
+        case storage::identifier::RDFNodeType::IRI: {
+            // reserved datatype IRIs are not part of the lexical order of ids
+            if (this->handle_.storage() == other.handle_.storage()
+                && this->handle_.node_id() >= storage::identifier::NodeID::min_iri_id
+                && other.handle_.node_id() >= storage::identifier::NodeID::min_iri_id
+                && this->handle_.storage().has_lexically_ordered_ids(storage::identifier::RDFNodeType::IRI)) {
+                return this->handle_.node_id() <=> other.handle_.node_id();
+            }
+
             return this->handle_.iri_backend() <=> other.handle_.iri_backend();
+        }
         case storage::identifier::RDFNodeType::BNode:
             return BlankNode{handle_}.order(BlankNode{other.handle_});
         case storage::identifier::RDFNodeType::Literal:
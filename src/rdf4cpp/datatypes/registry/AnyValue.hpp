@@ -0,0 +1,263 @@
+#ifndef RDF4CPP_REGISTRY_ANYVALUE_HPP
+#define RDF4CPP_REGISTRY_ANYVALUE_HPP
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace rdf4cpp::datatypes::registry {
+
+/**
+ * Type-erased value of a literal datatype (the cpp_type), used by the DatatypeRegistry to pass values between datatypes.
+ * Behaves like std::any, but values of up to inline_capacity bytes are stored in place instead of on the heap.
+ * The cpp_types of all fixed-id datatypes are guaranteed to be stored in place (see DatatypeRegistry::add),
+ * so values of these datatypes are never heap allocated. Only values of large dynamic datatypes are stored on the heap.
+ *
+ * The type of the contained value is identified by a pointer to a per-type table of operations.
+ */
+struct AnyValue {
+    static constexpr size_t inline_capacity = 64;
+    static constexpr size_t inline_alignment = alignof(std::max_align_t);
+
+    /**
+     * true if values of type T are stored in place
+     */
+    template<typename T>
+    static constexpr bool stores_inline = sizeof(T) <= inline_capacity
+                                          && inline_alignment % alignof(T) == 0
+                                          && std::is_nothrow_move_constructible_v<T>;
+
+private:
+    union Storage {
+        alignas(inline_alignment) std::byte buffer[inline_capacity];
+        void *heap;
+    };
+
+    struct VTable {
+        std::type_info const *type;
+        void (*destroy)(Storage &storage) noexcept;
+        void (*copy)(Storage const &src, Storage &dst);
+        void (*move)(Storage &src, Storage &dst) noexcept; //< move-constructs dst from src and destroys src
+    };
+
+    template<typename T>
+    struct InlineOps {
+        static T *get(Storage &storage) noexcept {
+            return std::launder(reinterpret_cast<T *>(storage.buffer));
+        }
+
+        static T const *get(Storage const &storage) noexcept {
+            return std::launder(reinterpret_cast<T const *>(storage.buffer));
+        }
+
+        template<typename... Args>
+        static void construct(Storage &storage, Args &&...args) {
+            ::new (storage.buffer) T(std::forward<Args>(args)...);
+        }
+
+        static void destroy(Storage &storage) noexcept {
+            std::destroy_at(get(storage));
+        }
+
+        static void copy(Storage const &src, Storage &dst) {
+            construct(dst, *get(src));
+        }
+
+        static void move(Storage &src, Storage &dst) noexcept {
+            construct(dst, std::move(*get(src)));
+            destroy(src);
+        }
+    };
+
+    template<typename T>
+    struct HeapOps {
+        static T *get(Storage &storage) noexcept {
+            return static_cast<T *>(storage.heap);
+        }
+
+        static T const *get(Storage const &storage) noexcept {
+            return static_cast<T const *>(storage.heap);
+        }
+
+        template<typename... Args>
+        static void construct(Storage &storage, Args &&...args) {
+            storage.heap = new T(std::forward<Args>(args)...);
+        }
+
+        static void destroy(Storage &storage) noexcept {
+            delete get(storage);
+        }
+
+        static void copy(Storage const &src, Storage &dst) {
+            construct(dst, *get(src));
+        }
+
+        static void move(Storage &src, Storage &dst) noexcept {
+            dst.heap = std::exchange(src.heap, nullptr);
+        }
+    };
+
+    template<typename T>
+    using ops_for = std::conditional_t<stores_inline<T>, InlineOps<T>, HeapOps<T>>;
+
+    template<typename T>
+    static constexpr VTable vtable_for{
+            .type = &typeid(T),
+            .destroy = &ops_for<T>::destroy,
+            .copy = &ops_for<T>::copy,
+            .move = &ops_for<T>::move};
+
+    Storage storage_;
+    VTable const *vtable_ = nullptr; //< nullptr if empty
+
+    template<typename T>
+    [[nodiscard]] bool holds() const noexcept {
+        // the table might not be unique if T is used in multiple shared libraries, fall back to comparing the type
+        return vtable_ == &vtable_for<T> || (vtable_ != nullptr && *vtable_->type == typeid(T));
+    }
+
+    template<typename T>
+    friend T const *any_cast(AnyValue const *value) noexcept;
+
+    template<typename T>
+    friend T *any_cast(AnyValue *value) noexcept;
+
+public:
+    AnyValue() noexcept = default;
+
+    // std::any is excluded, otherwise it would silently be wrapped instead of its contained value
+    template<typename T>
+        requires (!std::is_same_v<std::decay_t<T>, AnyValue> && !std::is_same_v<std::decay_t<T>, std::any>
+                  && std::is_copy_constructible_v<std::decay_t<T>>)
+    AnyValue(T &&value) {
+        emplace<std::decay_t<T>>(std::forward<T>(value));
+    }
+
+    template<typename T, typename... Args>
+        requires std::is_copy_constructible_v<T>
+    explicit AnyValue(std::in_place_type_t<T>, Args &&...args) {
+        emplace<T>(std::forward<Args>(args)...);
+    }
+
+    AnyValue(AnyValue const &other) {
+        if (other.vtable_ != nullptr) {
+            other.vtable_->copy(other.storage_, storage_);
+            vtable_ = other.vtable_;
+        }
+    }
+
+    AnyValue(AnyValue &&other) noexcept {
+        if (other.vtable_ != nullptr) {
+            other.vtable_->move(other.storage_, storage_);
+            vtable_ = std::exchange(other.vtable_, nullptr);
+        }
+    }
+
+    AnyValue &operator=(AnyValue const &other) {
+        if (this != &other) {
+            *this = AnyValue{other};
+        }
+        return *this;
+    }
+
+    AnyValue &operator=(AnyValue &&other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.vtable_ != nullptr) {
+                other.vtable_->move(other.storage_, storage_);
+                vtable_ = std::exchange(other.vtable_, nullptr);
+            }
+        }
+        return *this;
+    }
+
+    ~AnyValue() {
+        reset();
+    }
+
+    /**
+     * Destroys the contained value (if any) and constructs a T from args in its place
+     */
+    template<typename T, typename... Args>
+        requires std::is_copy_constructible_v<T>
+    T &emplace(Args &&...args) {
+        reset();
+        ops_for<T>::construct(storage_, std::forward<Args>(args)...);
+        vtable_ = &vtable_for<T>;
+        return *ops_for<T>::get(storage_);
+    }
+
+    void reset() noexcept {
+        if (vtable_ != nullptr) {
+            vtable_->destroy(storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+    [[nodiscard]] bool has_value() const noexcept {
+        return vtable_ != nullptr;
+    }
+
+    /**
+     * @return the type of the contained value, typeid(void) if empty
+     */
+    [[nodiscard]] std::type_info const &type() const noexcept {
+        return vtable_ != nullptr ? *vtable_->type : typeid(void);
+    }
+};
+
+/**
+ * @return pointer to the contained value if value contains a T, nullptr otherwise
+ */
+template<typename T>
+T const *any_cast(AnyValue const *value) noexcept {
+    if (value == nullptr || !value->template holds<T>()) {
+        return nullptr;
+    }
+    return AnyValue::ops_for<T>::get(value->storage_);
+}
+
+template<typename T>
+T *any_cast(AnyValue *value) noexcept {
+    if (value == nullptr || !value->template holds<T>()) {
+        return nullptr;
+    }
+    return AnyValue::ops_for<T>::get(value->storage_);
+}
+
+/**
+ * Accesses the contained value, analogous to std::any_cast
+ *
+ * @throws std::bad_any_cast if value does not contain a std::remove_cvref_t<T>
+ */
+template<typename T>
+T any_cast(AnyValue const &value) {
+    if (auto const *v = any_cast<std::remove_cvref_t<T>>(&value); v != nullptr) {
+        return static_cast<T>(*v);
+    }
+    throw std::bad_any_cast{};
+}
+
+template<typename T>
+T any_cast(AnyValue &value) {
+    if (auto *v = any_cast<std::remove_cvref_t<T>>(&value); v != nullptr) {
+        return static_cast<T>(*v);
+    }
+    throw std::bad_any_cast{};
+}
+
+template<typename T>
+T any_cast(AnyValue &&value) {
+    if (auto *v = any_cast<std::remove_cvref_t<T>>(&value); v != nullptr) {
+        return static_cast<T>(std::move(*v));
+    }
+    throw std::bad_any_cast{};
+}
+
+}  // namespace rdf4cpp::datatypes::registry
+
+#endif  // RDF4CPP_REGISTRY_ANYVALUE_HPP
@@ -1,8 +1,12 @@
 #ifndef RDF4CPP_DATATYPECONVERSION_HPP
 #define RDF4CPP_DATATYPECONVERSION_HPP
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <functional>
+#include <optional>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -408,8 +412,133 @@ consteval std::optional<size_t> calculate_subtype_offset() {
     });
 }
 
+template<size_t max_p_rank, ConversionEntry... Entries>
+consteval std::array<std::string_view, max_p_rank> layer_target_identifiers(mz::type_list<Entries...>) noexcept {
+    return {std::string_view{Entries::target_type::identifier}...};
+}
+
+/**
+ * The shape of a ConversionTable, i.e. its ranks and the identifiers of the target types of its conversions.
+ * This is the compile-time equivalent of the data that DatatypeRegistry::get_common_type_conversion searches at runtime.
+ */
+template<ConversionTable Table>
+struct ConversionTableShape;
+
+template<ConversionLayer... Layers>
+struct ConversionTableShape<mz::type_list<Layers...>> {
+    static constexpr size_t s_rank = sizeof...(Layers);
+    static constexpr size_t max_p_rank = std::max({size_t{0}, Layers::length...});
+    static constexpr std::array<size_t, s_rank> p_ranks{Layers::length...};
+    static constexpr std::array<std::array<std::string_view, max_p_rank>, s_rank> targets{layer_target_identifiers<max_p_rank>(Layers{})...};
+};
+
+/**
+ * Position of a conversion in a ConversionTable, see RuntimeConversionTable::conversion_at_index
+ */
+struct ConversionIndex {
+    size_t s_off;
+    size_t p_off;
+};
+
+struct CommonConversionIndices {
+    ConversionIndex lhs;
+    ConversionIndex rhs;
+};
+
+/**
+ * The search of DatatypeRegistry::get_common_type_conversion on ConversionTableShapes,
+ * with the table with the lesser (effective) subtype rank as the first argument.
+ */
+template<typename LesserShape, typename GreaterShape>
+consteval std::optional<CommonConversionIndices> find_common_conversion_impl(size_t const lesser_init_soff, size_t const greater_init_soff) noexcept {
+    auto const lesser_s_rank = LesserShape::s_rank - lesser_init_soff;
+    auto const greater_s_rank = GreaterShape::s_rank - greater_init_soff;
+
+    size_t lesser_s_off = lesser_init_soff;
+    size_t greater_s_off = greater_init_soff + greater_s_rank - lesser_s_rank;
+
+    while (lesser_s_off < LesserShape::s_rank && greater_s_off < GreaterShape::s_rank) {
+        auto const lesser_p_rank = LesserShape::p_ranks[lesser_s_off];
+        auto const greater_p_rank = GreaterShape::p_ranks[greater_s_off];
+
+        auto const [lesser_p_off, greater_p_off] = lesser_p_rank == greater_p_rank ? std::make_pair(0ul, 0ul)
+                                                   : lesser_p_rank < greater_p_rank ? std::make_pair(0ul, greater_p_rank - lesser_p_rank)
+                                                                                    : std::make_pair(lesser_p_rank - greater_p_rank, 0ul);
+
+        if (lesser_p_off < lesser_p_rank && greater_p_off < greater_p_rank
+            && LesserShape::targets[lesser_s_off][lesser_p_off] == GreaterShape::targets[greater_s_off][greater_p_off]) {
+            return CommonConversionIndices{.lhs = {lesser_s_off, lesser_p_off}, .rhs = {greater_s_off, greater_p_off}};
+        }
+
+        lesser_s_off += 1;
+        greater_s_off += 1;
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * Compile-time version of DatatypeRegistry::get_common_type_conversion
+ *
+ * @return the positions of the conversions to the common type in the conversion tables of lhs and rhs, or nullopt if there is no common type
+ */
+template<ConversionTable LhsTable, ConversionTable RhsTable>
+consteval std::optional<CommonConversionIndices> find_common_conversion(size_t const lhs_init_soff = 0, size_t const rhs_init_soff = 0) noexcept {
+    using lhs_shape = ConversionTableShape<LhsTable>;
+    using rhs_shape = ConversionTableShape<RhsTable>;
+
+    if (lhs_shape::s_rank - lhs_init_soff < rhs_shape::s_rank - rhs_init_soff) {
+        return find_common_conversion_impl<lhs_shape, rhs_shape>(lhs_init_soff, rhs_init_soff);
+    }
+
+    auto const res = find_common_conversion_impl<rhs_shape, lhs_shape>(rhs_init_soff, lhs_init_soff);
+    if (!res.has_value()) {
+        return std::nullopt;
+    }
+
+    return CommonConversionIndices{.lhs = res->rhs, .rhs = res->lhs};
+}
+
+/**
+ * @return the subtype offset at which the search for numeric conversions starts for T (see DatatypeRegistry::NumericOpsStub::start_s_off)
+ */
+template<NumericLiteralDatatype T>
+consteval size_t numeric_op_start_subtype_offset() noexcept {
+    if constexpr (NumericStub<T>) {
+        return *calculate_subtype_offset<typename T::numeric_impl_type, decltype(make_conversion_table<T>())>();
+    } else {
+        return 0;
+    }
+}
+
 }  // namespace conversion_detail
 
+/**
+ * The conversions of two numeric datatypes into their common type for numeric operations,
+ * selected from their compile-time conversion tables.
+ * This is the compile-time equivalent of DatatypeRegistry::get_common_numeric_op_type_conversion.
+ *
+ * @note common_type is the numeric-impl both operands are converted to
+ */
+template<NumericLiteralDatatype Lhs, NumericLiteralDatatype Rhs>
+struct CommonNumericOpConversion {
+private:
+    using lhs_table = decltype(conversion_detail::make_conversion_table<Lhs>());
+    using rhs_table = decltype(conversion_detail::make_conversion_table<Rhs>());
+
+    static constexpr auto indices = conversion_detail::find_common_conversion<lhs_table, rhs_table>(conversion_detail::numeric_op_start_subtype_offset<Lhs>(),
+                                                                                                    conversion_detail::numeric_op_start_subtype_offset<Rhs>());
+    static_assert(indices.has_value(), "numeric datatypes without a common type");
+
+public:
+    using lhs_conversion = typename lhs_table::template select<indices->lhs.s_off>::template select<indices->lhs.p_off>;
+    using rhs_conversion = typename rhs_table::template select<indices->rhs.s_off>::template select<indices->rhs.p_off>;
+    using common_type = typename lhs_conversion::target_type;
+
+    static_assert(std::is_same_v<common_type, typename rhs_conversion::target_type>);
+    static_assert(NumericImplLiteralDatatype<common_type>, "the common type of a numeric operation must be a numeric-impl");
+};
+
 /**
  * Generate a compile-time conversion table for the given type
  * this will include all conversions that are reachable from T.
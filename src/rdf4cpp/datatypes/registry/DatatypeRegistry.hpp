@@ -3,12 +3,12 @@
 
 #include <rdf4cpp/storage/identifier/LiteralID.hpp>
 #include <rdf4cpp/datatypes/LiteralDatatype.hpp>
+#include <rdf4cpp/datatypes/registry/AnyValue.hpp>
 #include <rdf4cpp/datatypes/registry/DatatypeConversion.hpp>
 #include <rdf4cpp/datatypes/registry/FixedIdMappings.hpp>
 #include <rdf4cpp/writer/BufWriter.hpp>
 
 #include <algorithm>
-#include <any>
 #include <functional>
 #include <optional>
 #include <string>
@@ -38,22 +38,22 @@ struct DatatypeRegistry {
     /**
      * Constructs an instance of a type from a string.
      */
-    using factory_fptr_t = std::any (*)(std::string_view);
-    using ebv_fptr_t = bool (*)(std::any const &) noexcept;
-    using try_into_inlined_fptr_t = std::optional<storage::identifier::LiteralID> (*)(std::any const &) noexcept;
-    using from_inlined_fptr_t = std::any (*)(storage::identifier::LiteralID) noexcept;
-    using serialize_fptr_t = bool (*)(std::any const &, writer::BufWriterParts writer) noexcept;
+    using factory_fptr_t = AnyValue (*)(std::string_view);
+    using ebv_fptr_t = bool (*)(AnyValue const &) noexcept;
+    using try_into_inlined_fptr_t = std::optional<storage::identifier::LiteralID> (*)(AnyValue const &) noexcept;
+    using from_inlined_fptr_t = AnyValue (*)(storage::identifier::LiteralID) noexcept;
+    using serialize_fptr_t = bool (*)(AnyValue const &, writer::BufWriterParts writer) noexcept;
 
     struct OpResult {
         DatatypeID result_type_id;
-        nonstd::expected<std::any, DynamicError> result_value;
+        nonstd::expected<AnyValue, DynamicError> result_value;
     };
 
-    using nullop_fptr_t = std::any (*)() noexcept;
-    using unop_fptr_t = OpResult (*)(std::any const &) noexcept;
-    using binop_fptr_t = OpResult (*)(std::any const &, std::any const &) noexcept;
+    using nullop_fptr_t = AnyValue (*)() noexcept;
+    using unop_fptr_t = OpResult (*)(AnyValue const &) noexcept;
+    using binop_fptr_t = OpResult (*)(AnyValue const &, AnyValue const &) noexcept;
 
-    using compare_fptr_t = std::partial_ordering (*)(std::any const &, std::any const &) noexcept;
+    using compare_fptr_t = std::partial_ordering (*)(AnyValue const &, AnyValue const &) noexcept;
 
     struct NumericOpsImpl {
         nullop_fptr_t zero_value_fptr; // 0
@@ -263,7 +263,7 @@ public:
     [[nodiscard]] static std::optional<std::string_view> get_iri(DatatypeIDView datatype_id) noexcept;
 
     /**
-     * Get a factory_fptr_t for a datatype. The factory_fptr_t can be used like `std::any type_instance = factory_fptr("types string representation")`.
+     * Get a factory_fptr_t for a datatype. The factory_fptr_t can be used like `AnyValue type_instance = factory_fptr("types string representation")`.
      * @param datatype_id datatype id for the corresponding datatype
      * @return function pointer or nullptr
      */
@@ -559,6 +559,9 @@ std::optional<std::invoke_result_t<Map, DatatypeRegistry::DatatypeEntry const &>
 
 template<datatypes::LiteralDatatype LiteralDatatype_t>
 inline void DatatypeRegistry::add() noexcept {
+    static_assert(!FixedIdLiteralDatatype<LiteralDatatype_t> || AnyValue::stores_inline<typename LiteralDatatype_t::cpp_type>,
+                  "values of fixed-id datatypes must fit into the inline storage of AnyValue, increase AnyValue::inline_capacity");
+
     using conversion_table_t = decltype(make_conversion_table_for<LiteralDatatype_t>());
 
     auto const num_ops = []() -> std::optional<NumericOps> {
@@ -592,8 +595,8 @@ inline void DatatypeRegistry::add() noexcept {
 
     auto const ebv_fptr = []() -> ebv_fptr_t {
         if constexpr (datatypes::LogicalLiteralDatatype<LiteralDatatype_t>) {
-            return [](std::any const &operand) noexcept -> bool {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            return [](AnyValue const &operand) noexcept -> bool {
+                auto const &operand_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(operand);
                 return LiteralDatatype_t::effective_boolean_value(operand_val);
             };
         } else {
@@ -603,9 +606,9 @@ inline void DatatypeRegistry::add() noexcept {
 
     auto const compare_fptr = []() -> compare_fptr_t {
         if constexpr (datatypes::ComparableLiteralDatatype<LiteralDatatype_t>) {
-            return [](std::any const &lhs, std::any const &rhs) noexcept -> std::partial_ordering {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            return [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> std::partial_ordering {
+                auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+                auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
                 return LiteralDatatype_t::compare(lhs_val, rhs_val);
             };
@@ -624,14 +627,14 @@ inline void DatatypeRegistry::add() noexcept {
 
     DatatypeEntry entry{
             .datatype_iri = std::string{LiteralDatatype_t::identifier},
-            .factory_fptr = [](std::string_view string_repr) -> std::any {
+            .factory_fptr = [](std::string_view string_repr) -> AnyValue {
                 return LiteralDatatype_t::from_string(string_repr);
             },
-            .serialize_canonical_string_fptr = [](std::any const &value, writer::BufWriterParts writer) noexcept -> bool {
-                return LiteralDatatype_t::serialize_canonical_string(std::any_cast<typename LiteralDatatype_t::cpp_type>(value), writer);
+            .serialize_canonical_string_fptr = [](AnyValue const &value, writer::BufWriterParts writer) noexcept -> bool {
+                return LiteralDatatype_t::serialize_canonical_string(any_cast<typename LiteralDatatype_t::cpp_type const &>(value), writer);
             },
-            .serialize_simplified_string_fptr = [](std::any const &value, writer::BufWriterParts writer) noexcept -> bool {
-                return LiteralDatatype_t::serialize_simplified_string(std::any_cast<typename LiteralDatatype_t::cpp_type>(value), writer);
+            .serialize_simplified_string_fptr = [](AnyValue const &value, writer::BufWriterParts writer) noexcept -> bool {
+                return LiteralDatatype_t::serialize_simplified_string(any_cast<typename LiteralDatatype_t::cpp_type const &>(value), writer);
             },
             .ebv_fptr = ebv_fptr,
             .numeric_ops = num_ops,
@@ -674,7 +677,7 @@ struct SelectOpResIRI {
 };
 
 template<typename T>
-[[nodiscard]] nonstd::expected<std::any, DynamicError> map_expected(nonstd::expected<T, DynamicError> const &e) noexcept {
+[[nodiscard]] nonstd::expected<AnyValue, DynamicError> map_expected(nonstd::expected<T, DynamicError> const &e) noexcept {
     if (e.has_value()) {
         return *e;
     } else {
@@ -687,92 +690,92 @@ template<datatypes::NumericImplLiteralDatatype LiteralDatatype_t>
 DatatypeRegistry::NumericOpsImpl DatatypeRegistry::make_numeric_ops_impl() noexcept {
     return NumericOpsImpl{
             // 0
-            .zero_value_fptr = []() noexcept -> std::any {
+            .zero_value_fptr = []() noexcept -> AnyValue {
                 return LiteralDatatype_t::zero_value();
             },
             // 1
-            .one_value_fptr = []() noexcept -> std::any {
+            .one_value_fptr = []() noexcept -> AnyValue {
                 return LiteralDatatype_t::one_value();
             },
             // a + b
-            .add_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .add_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+                auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+                auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::add_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::add(lhs_val, rhs_val))};
             },
             // a - b
-            .sub_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .sub_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+                auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+                auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::sub_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::sub(lhs_val, rhs_val))};
             },
             // a * b
-            .mul_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .mul_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+                auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+                auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::mul_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::mul(lhs_val, rhs_val))};
             },
             // a / b
-            .div_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .div_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+                auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+                auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::div_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::div(lhs_val, rhs_val))};
             },
             // +a
-            .pos_fptr = [](std::any const &operand) noexcept -> OpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .pos_fptr = [](AnyValue const &operand) noexcept -> OpResult {
+                auto const &operand_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(operand);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::pos_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::pos(operand_val))};
             },
             // -a
-            .neg_fptr = [](std::any const &operand) noexcept -> OpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .neg_fptr = [](AnyValue const &operand) noexcept -> OpResult {
+                auto const &operand_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(operand);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::neg_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::neg(operand_val))};
             },
             // abs(a)
-            .abs_fptr = [](std::any const &operand) noexcept -> OpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .abs_fptr = [](AnyValue const &operand) noexcept -> OpResult {
+                auto const &operand_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(operand);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::abs_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::abs(operand_val))};
             },
             // round(a)
-            .round_fptr = [](std::any const &operand) noexcept -> OpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .round_fptr = [](AnyValue const &operand) noexcept -> OpResult {
+                auto const &operand_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(operand);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::round_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::round(operand_val))};
             },
             // floor(a)
-            .floor_fptr = [](std::any const &operand) noexcept -> OpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .floor_fptr = [](AnyValue const &operand) noexcept -> OpResult {
+                auto const &operand_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(operand);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::floor_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::floor(operand_val))};
             },
             // ceil(a)
-            .ceil_fptr = [](std::any const &operand) noexcept -> OpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .ceil_fptr = [](AnyValue const &operand) noexcept -> OpResult {
+                auto const &operand_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(operand);
 
                 return OpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::ceil_result, LiteralDatatype_t>::select(),
@@ -790,25 +793,25 @@ DatatypeRegistry::TimepointOps DatatypeRegistry::make_timepoint_ops() noexcept {
                 return DatatypeIDView{LiteralDatatype_t::timepoint_duration_operand_type::identifier};
             }
         }(),
-        .timepoint_sub = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-            auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-            auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+        .timepoint_sub = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+            auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+            auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::timepoint_sub_result, LiteralDatatype_t>::select(),
                 .result_value = detail::map_expected(LiteralDatatype_t::timepoint_sub(lhs_val, rhs_val))};
         },
-        .timepoint_duration_add = [](std::any const &tp, std::any const &dur) noexcept -> OpResult {
-            auto const &tp_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(tp);
-            auto const &dur_val = std::any_cast<typename LiteralDatatype_t::timepoint_duration_operand_cpp_type>(dur);
+        .timepoint_duration_add = [](AnyValue const &tp, AnyValue const &dur) noexcept -> OpResult {
+            auto const &tp_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(tp);
+            auto const &dur_val = any_cast<typename LiteralDatatype_t::timepoint_duration_operand_cpp_type const &>(dur);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<LiteralDatatype_t, LiteralDatatype_t>::select(),
                 .result_value = detail::map_expected(LiteralDatatype_t::timepoint_duration_add(tp_val, dur_val))};
         },
-        .timepoint_duration_sub = [](std::any const &tp, std::any const &dur) noexcept -> OpResult {
-            auto const &tp_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(tp);
-            auto const &dur_val = std::any_cast<typename LiteralDatatype_t::timepoint_duration_operand_cpp_type>(dur);
+        .timepoint_duration_sub = [](AnyValue const &tp, AnyValue const &dur) noexcept -> OpResult {
+            auto const &tp_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(tp);
+            auto const &dur_val = any_cast<typename LiteralDatatype_t::timepoint_duration_operand_cpp_type const &>(dur);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<LiteralDatatype_t, LiteralDatatype_t>::select(),
@@ -826,41 +829,41 @@ DatatypeRegistry::DurationOps DatatypeRegistry::make_duration_ops() noexcept {
                 return DatatypeIDView{LiteralDatatype_t::duration_scalar_type::identifier};
             }
         }(),
-        .duration_add = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-            auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-            auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+        .duration_add = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+            auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+            auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<LiteralDatatype_t, LiteralDatatype_t>::select(),
                 .result_value = detail::map_expected(LiteralDatatype_t::duration_add(lhs_val, rhs_val))};
         },
-        .duration_sub = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-            auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-            auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+        .duration_sub = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+            auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+            auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<LiteralDatatype_t, LiteralDatatype_t>::select(),
                 .result_value = detail::map_expected(LiteralDatatype_t::duration_sub(lhs_val, rhs_val))};
         },
-        .duration_div = [](std::any const &lhs, std::any const &rhs) noexcept -> OpResult {
-            auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-            auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+        .duration_div = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> OpResult {
+            auto const &lhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(lhs);
+            auto const &rhs_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(rhs);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::duration_div_result_type, LiteralDatatype_t>::select(),
                 .result_value = detail::map_expected(LiteralDatatype_t::duration_div(lhs_val, rhs_val))};
         },
-        .duration_scalar_mul = [](std::any const &dur, std::any const &scalar) noexcept -> OpResult {
-            auto const &dur_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(dur);
-            auto const &scalar_val = std::any_cast<typename LiteralDatatype_t::duration_scalar_cpp_type>(scalar);
+        .duration_scalar_mul = [](AnyValue const &dur, AnyValue const &scalar) noexcept -> OpResult {
+            auto const &dur_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(dur);
+            auto const &scalar_val = any_cast<typename LiteralDatatype_t::duration_scalar_cpp_type const &>(scalar);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<LiteralDatatype_t, LiteralDatatype_t>::select(),
                 .result_value = detail::map_expected(LiteralDatatype_t::duration_scalar_mul(dur_val, scalar_val))};
         },
-        .duration_scalar_div = [](std::any const &dur, std::any const &scalar) noexcept -> OpResult {
-            auto const &dur_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(dur);
-            auto const &scalar_val = std::any_cast<typename LiteralDatatype_t::duration_scalar_cpp_type>(scalar);
+        .duration_scalar_div = [](AnyValue const &dur, AnyValue const &scalar) noexcept -> OpResult {
+            auto const &dur_val = any_cast<typename LiteralDatatype_t::cpp_type const &>(dur);
+            auto const &scalar_val = any_cast<typename LiteralDatatype_t::duration_scalar_cpp_type const &>(scalar);
 
             return OpResult{
                 .result_type_id = detail::SelectOpResIRI<LiteralDatatype_t, LiteralDatatype_t>::select(),
@@ -872,11 +875,11 @@ DatatypeRegistry::DurationOps DatatypeRegistry::make_duration_ops() noexcept {
 template<datatypes::InlineableLiteralDatatype LiteralDatatype_t>
 DatatypeRegistry::InliningOps DatatypeRegistry::make_inlining_ops() noexcept {
     return InliningOps {
-            .try_into_inlined_fptr = [](std::any const &value) noexcept -> std::optional<storage::identifier::LiteralID> {
-                auto const &val = std::any_cast<typename LiteralDatatype_t::cpp_type>(value);
+            .try_into_inlined_fptr = [](AnyValue const &value) noexcept -> std::optional<storage::identifier::LiteralID> {
+                auto const &val = any_cast<typename LiteralDatatype_t::cpp_type const &>(value);
                 return LiteralDatatype_t::try_into_inlined(val);
             },
-            .from_inlined_fptr = [](storage::identifier::LiteralID inlined_value) noexcept -> std::any {
+            .from_inlined_fptr = [](storage::identifier::LiteralID inlined_value) noexcept -> AnyValue {
                 return LiteralDatatype_t::from_inlined(inlined_value);
             }};
 }
@@ -414,7 +414,7 @@ struct Inlineable {
 
     static std::optional<storage::identifier::LiteralID> try_into_inlined([[maybe_unused]] cpp_type const &value) noexcept {
         if constexpr (std::integral<cpp_type>) {
-            return util::try_pack_integral<storage::identifier::LiteralID>(value);
+            return util::try_pack_integral_ordered<storage::identifier::LiteralID>(value);
         } else {
             static_assert(detail::always_false_v<cpp_type>, "to_inlined not implemented for inlineable type");
             return std::nullopt; // silence gcc no-return warning
@@ -423,7 +423,7 @@ struct Inlineable {
 
     static cpp_type from_inlined([[maybe_unused]] storage::identifier::LiteralID inlined) noexcept {
         if constexpr (std::integral<cpp_type>) {
-            return util::unpack_integral<cpp_type>(inlined);
+            return util::unpack_integral_ordered<cpp_type>(inlined);
         } else {
             static_assert(detail::always_false_v<cpp_type>, "from_inlined not implemented for inlineable type");
             return {}; // silence gcc no-return warning
@@ -4,7 +4,10 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 
 namespace rdf4cpp::datatypes::registry::util {
 
@@ -183,6 +186,91 @@ constexpr T unpack_integral(P packed_value) noexcept {
     return unpack_integral<T, P::width>(packed_value);
 }
 
+/**
+ * @brief tries to pack any integral value into the lower `bits` bits of a value of type P,
+ *      such that comparing the packed values as unsigned integers gives the same result as comparing the values.
+ *      Signed values are biased by 2^(bits - 1) (i.e. their sign bit is flipped), unsigned values are packed as is.
+ * @tparam P type to pack into
+ * @tparam bits bits available in P for packing
+ * @tparam T to be packed type
+ * @param value to be packed value
+ * @return the packed value if there was enough space to pack it, otherwise nullopt
+ */
+template<typename P, size_t bits, std::integral T>
+constexpr std::optional<P> try_pack_integral_ordered(T value) noexcept {
+    static_assert(bits < 64);
+
+    if constexpr (std::unsigned_integral<T>) {
+        return try_pack_integral<P, bits>(value);
+    } else {
+        if constexpr (sizeof(T) * 8 > bits) {
+            constexpr auto boundary = T{1} << (bits - 1);
+
+            if (value >= boundary || value < -boundary) [[unlikely]] {
+                return std::nullopt;
+            }
+        }
+
+        // wraps around for negative values, which yields exactly the values below the bias
+        auto const biased = static_cast<uint64_t>(static_cast<int64_t>(value)) + (uint64_t{1} << (bits - 1));
+        return pack<P>(biased);
+    }
+}
+
+template<typename P, std::integral T>
+constexpr std::optional<P> try_pack_integral_ordered(T value) noexcept {
+    return try_pack_integral_ordered<P, P::width>(value);
+}
+
+/**
+ * @brief reverse operation of try_pack_integral_ordered
+ */
+template<std::integral T, size_t bits, typename P>
+constexpr T unpack_integral_ordered(P packed_value) noexcept {
+    static_assert(bits < 64);
+
+    if constexpr (std::unsigned_integral<T>) {
+        return unpack_integral<T, bits>(packed_value);
+    } else {
+        auto const biased = unpack<uint64_t>(packed_value);
+        return static_cast<T>(static_cast<int64_t>(biased - (uint64_t{1} << (bits - 1))));
+    }
+}
+
+template<std::integral T, typename P>
+constexpr T unpack_integral_ordered(P packed_value) noexcept {
+    return unpack_integral_ordered<T, P::width>(packed_value);
+}
+
+/**
+ * @brief maps a sign-magnitude number (like the bits of an IEEE 754 floating point number)
+ *      of `bits` bits to an unsigned number of the same width that has the same order.
+ *      Positive numbers get their sign bit set, negative numbers are inverted.
+ * @note positive and negative zero are mapped to different (adjacent) values
+ */
+template<size_t bits>
+constexpr uint64_t sign_magnitude_to_ordered(uint64_t value) noexcept {
+    static_assert(bits > 0 && bits <= 64);
+
+    constexpr uint64_t sign = uint64_t{1} << (bits - 1);
+    constexpr uint64_t mask = sign | (sign - 1);
+
+    return (value & sign) != 0 ? (~value & mask) : (value | sign);
+}
+
+/**
+ * @brief reverse operation of sign_magnitude_to_ordered
+ */
+template<size_t bits>
+constexpr uint64_t ordered_to_sign_magnitude(uint64_t value) noexcept {
+    static_assert(bits > 0 && bits <= 64);
+
+    constexpr uint64_t sign = uint64_t{1} << (bits - 1);
+    constexpr uint64_t mask = sign | (sign - 1);
+
+    return (value & sign) != 0 ? (value & ~sign) : (~value & mask);
+}
+
 } // namespace rdf4cpp::datatypes::registry::util
 
 #endif  //RDF4CPP_REGISTRY_UTIL_INLINING_HPP
@@ -58,12 +58,14 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_doubl
         return std::nullopt;
     }
 
-    return storage::identifier::LiteralID{shortened};
+    // the order of the inlined values is the order of the values (NaNs aside)
+    return storage::identifier::LiteralID{util::sign_magnitude_to_ordered<storage::identifier::LiteralID::width>(shortened)};
 }
 
 template<>
 capabilities::Inlineable<xsd_double>::cpp_type capabilities::Inlineable<xsd_double>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    return util::unpack<cpp_type>(inlined.to_underlying() << (64 - storage::identifier::LiteralID::width));
+    auto const shortened = util::ordered_to_sign_magnitude<storage::identifier::LiteralID::width>(inlined.to_underlying());
+    return util::unpack<cpp_type>(shortened << (64 - storage::identifier::LiteralID::width));
 }
 #endif
 
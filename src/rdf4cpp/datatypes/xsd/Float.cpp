@@ -48,12 +48,15 @@ nonstd::expected<capabilities::Numeric<xsd_float>::ceil_result_cpp_type, Dynamic
 
 template<>
 std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_float>::try_into_inlined(cpp_type const &value) noexcept {
-    return util::pack<storage::identifier::LiteralID>(value);
+    // the order of the inlined values is the order of the values (NaNs aside)
+    auto const bits = util::pack<uint32_t>(value);
+    return storage::identifier::LiteralID{util::sign_magnitude_to_ordered<32>(bits)};
 }
 
 template<>
 capabilities::Inlineable<xsd_float>::cpp_type capabilities::Inlineable<xsd_float>::from_inlined(storage::identifier::LiteralID const inlined) noexcept {
-    return util::unpack<cpp_type>(inlined);
+    auto const bits = static_cast<uint32_t>(util::ordered_to_sign_magnitude<32>(inlined.to_underlying()));
+    return util::unpack<cpp_type>(bits);
 }
 #endif
 
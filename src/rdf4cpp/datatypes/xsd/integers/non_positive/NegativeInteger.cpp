@@ -52,8 +52,9 @@ nonstd::expected<capabilities::Default<xsd_negative_integer>::cpp_type, DynamicE
 
 template<>
 std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_negative_integer>::try_into_inlined(cpp_type const &value) noexcept {
-    auto const to_pack_value = -value - 1;
-    if (to_pack_value >= (uint64_t{1} << storage::identifier::LiteralID::width)) {
+    // offset so that the order of the inlined values is the order of the values, -2^width is mapped to 0 and -1 to 2^width - 1
+    cpp_type const to_pack_value = value + (uint64_t{1} << storage::identifier::LiteralID::width);
+    if (to_pack_value < 0) {
         return std::nullopt;
     }
 
@@ -62,7 +63,7 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_negat
 
 template<>
 capabilities::Inlineable<xsd_negative_integer>::cpp_type capabilities::Inlineable<xsd_negative_integer>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    return -cpp_type{util::unpack_integral<uint64_t>(inlined) + 1};
+    return cpp_type{util::unpack_integral<uint64_t>(inlined)} - (uint64_t{1} << storage::identifier::LiteralID::width);
 }
 #endif
 
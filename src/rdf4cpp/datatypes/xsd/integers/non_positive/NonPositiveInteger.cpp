@@ -52,8 +52,9 @@ nonstd::expected<capabilities::Default<xsd_non_positive_integer>::cpp_type, Dyna
 
 template<>
 std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_non_positive_integer>::try_into_inlined(cpp_type const &value) noexcept {
-    auto const to_pack_value = -value;
-    if (to_pack_value >= (uint64_t{1} << storage::identifier::LiteralID::width)) {
+    // offset so that the order of the inlined values is the order of the values, -(2^width - 1) is mapped to 0 and 0 to 2^width - 1
+    cpp_type const to_pack_value = value + ((uint64_t{1} << storage::identifier::LiteralID::width) - 1);
+    if (to_pack_value < 0) {
         return std::nullopt;
     }
 
@@ -62,7 +63,7 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_non_p
 
 template<>
 capabilities::Inlineable<xsd_non_positive_integer>::cpp_type capabilities::Inlineable<xsd_non_positive_integer>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    return -cpp_type{util::unpack_integral<uint64_t>(inlined)};
+    return cpp_type{util::unpack_integral<uint64_t>(inlined)} - ((uint64_t{1} << storage::identifier::LiteralID::width) - 1);
 }
 #endif
 
@@ -73,12 +73,12 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_integ
         return std::nullopt;
     }
 
-    return util::try_pack_integral<storage::identifier::LiteralID>(static_cast<int64_t>(value));
+    return util::try_pack_integral_ordered<storage::identifier::LiteralID>(static_cast<int64_t>(value));
 }
 
 template<>
 capabilities::Inlineable<xsd_integer>::cpp_type capabilities::Inlineable<xsd_integer>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    return cpp_type{util::unpack_integral<int64_t>(inlined)};
+    return cpp_type{util::unpack_integral_ordered<int64_t>(inlined)};
 }
 #endif
 
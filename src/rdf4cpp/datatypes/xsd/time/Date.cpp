@@ -54,12 +54,12 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_date>
     if (!util::fits_into<int64_t>(i)) [[unlikely]] {
         return std::nullopt;
     }
-    return util::try_pack_integral<storage::identifier::LiteralID>(static_cast<int64_t>(i));
+    return util::try_pack_integral_ordered<storage::identifier::LiteralID>(static_cast<int64_t>(i));
 }
 
 template<>
 capabilities::Inlineable<xsd_date>::cpp_type capabilities::Inlineable<xsd_date>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    auto const i = util::unpack_integral<int64_t>(inlined);
+    auto const i = util::unpack_integral_ordered<int64_t>(inlined);
     return capabilities::Inlineable<xsd_date>::cpp_type{YearMonthDay::time_point<int64_t>{YearMonthDay::time_point<int64_t>::duration{i}}, std::nullopt};
 }
 
@@ -81,12 +81,12 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_dateT
         return std::nullopt;
     }
     auto s = static_cast<int64_t>(tp_sec.time_since_epoch().count());
-    return util::try_pack_integral<storage::identifier::LiteralID>(s);
+    return util::try_pack_integral_ordered<storage::identifier::LiteralID>(s);
 }
 
 template<>
 capabilities::Inlineable<xsd_dateTime>::cpp_type capabilities::Inlineable<xsd_dateTime>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    return std::make_pair(rdf4cpp::TimePoint{std::chrono::seconds{util::unpack_integral<int64_t>(inlined)}}, std::nullopt);
+    return std::make_pair(rdf4cpp::TimePoint{std::chrono::seconds{util::unpack_integral_ordered<int64_t>(inlined)}}, std::nullopt);
 }
 
 template<>
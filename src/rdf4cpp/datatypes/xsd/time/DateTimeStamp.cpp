@@ -85,12 +85,12 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_dateT
     if (!util::fits_into<int64_t>(tp_sec.time_since_epoch().count()))
         return std::nullopt;
     auto s = static_cast<int64_t>(tp_sec.time_since_epoch().count());
-    return util::try_pack_integral<storage::identifier::LiteralID>(s);
+    return util::try_pack_integral_ordered<storage::identifier::LiteralID>(s);
 }
 
 template<>
 capabilities::Inlineable<xsd_dateTimeStamp>::cpp_type capabilities::Inlineable<xsd_dateTimeStamp>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    return rdf4cpp::ZonedTime{xsd::DateTimeStamp::inlining_default_timezone, rdf4cpp::TimePointSys{std::chrono::seconds{util::unpack_integral<int64_t>(inlined)}}};
+    return rdf4cpp::ZonedTime{xsd::DateTimeStamp::inlining_default_timezone, rdf4cpp::TimePointSys{std::chrono::seconds{util::unpack_integral_ordered<int64_t>(inlined)}}};
 }
 
 template<>
@@ -116,12 +116,12 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_dayTi
         return std::nullopt;
     }
     int64_t v = ms.count();
-    return util::try_pack_integral<storage::identifier::LiteralID>(v);
+    return util::try_pack_integral_ordered<storage::identifier::LiteralID>(v);
 }
 
 template<>
 capabilities::Inlineable<xsd_dayTimeDuration>::cpp_type capabilities::Inlineable<xsd_dayTimeDuration>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    return std::chrono::milliseconds{util::unpack_integral<int64_t>(inlined)};
+    return std::chrono::milliseconds{util::unpack_integral_ordered<int64_t>(inlined)};
 }
 
 template<>
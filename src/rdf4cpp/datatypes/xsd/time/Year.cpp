@@ -41,12 +41,12 @@ std::optional<storage::identifier::LiteralID> capabilities::Inlineable<xsd_gYear
     if (value.second.has_value()) [[unlikely]] {
         return std::nullopt;
     }
-    return util::try_pack_integral<storage::identifier::LiteralID>(static_cast<int64_t>(value.first));
+    return util::try_pack_integral_ordered<storage::identifier::LiteralID>(static_cast<int64_t>(value.first));
 }
 
 template<>
 capabilities::Inlineable<xsd_gYear>::cpp_type capabilities::Inlineable<xsd_gYear>::from_inlined(storage::identifier::LiteralID inlined) noexcept {
-    auto i = util::unpack_integral<int64_t>(inlined);
+    auto i = util::unpack_integral_ordered<int64_t>(inlined);
     return {Year{i}, std::nullopt};
 }
 
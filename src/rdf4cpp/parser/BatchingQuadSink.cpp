@@ -0,0 +1,41 @@
+#include "BatchingQuadSink.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace rdf4cpp::parser {
+
+BatchingQuadSink::BatchingQuadSink(batch_func_type on_batch, error_func_type on_error, size_t const batch_size)
+    : on_batch_{std::move(on_batch)},
+      on_error_{std::move(on_error)},
+      batch_size_{batch_size} {
+    if (batch_size_ == 0) {
+        throw std::invalid_argument{"batch size must be greater than 0"};
+    }
+
+    batch_.reserve(batch_size_);
+}
+
+void BatchingQuadSink::on_begin(storage::DynNodeStoragePtr node_storage) {
+    node_storage_ = node_storage;
+}
+
+void BatchingQuadSink::on_error(ParsingError const &error) {
+    flush(); // keep input order
+    on_error_(error);
+}
+
+void BatchingQuadSink::on_end() {
+    flush();
+}
+
+void BatchingQuadSink::flush() {
+    if (batch_.empty()) {
+        return;
+    }
+
+    on_batch_(std::span<id_quad const>{batch_});
+    batch_.clear();
+}
+
+}  // namespace rdf4cpp::parser
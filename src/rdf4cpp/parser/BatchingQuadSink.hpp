@@ -0,0 +1,90 @@
+#ifndef RDF4CPP_PARSER_BATCHINGQUADSINK_HPP
+#define RDF4CPP_PARSER_BATCHINGQUADSINK_HPP
+
+#include <rdf4cpp/parser/QuadSink.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace rdf4cpp::parser {
+
+/**
+ * QuadSink that collects the ids of parsed quads and hands them to a callback in batches,
+ * for consumers that only need NodeBackendIDs (e.g. to feed their own indices).
+ * Compared to iterating an IStreamQuadIterator this avoids materializing a Quad (i.e. four NodeBackendHandles) per statement.
+ *
+ * The node storage all ids belong to is available via node_storage() once parsing started.
+ *
+ * @example
+ * @code
+ * BatchingQuadSink sink{[&](std::span<BatchingQuadSink::id_quad const> batch) {
+ *     for (auto const &[g, s, p, o] : batch) {
+ *         index.insert(g, s, p, o);
+ *     }
+ * }};
+ * IStreamQuadIterator::parse_into(sink, ifs, ParsingFlag::NQuads);
+ * @endcode
+ */
+struct BatchingQuadSink final : QuadSink {
+    /**
+     * ids of graph, subject, predicate and object (in that order)
+     */
+    using id_quad = std::array<storage::identifier::NodeBackendID, 4>;
+    using batch_func_type = std::function<void(std::span<id_quad const>)>;
+    using error_func_type = std::function<void(ParsingError const &)>;
+
+    static constexpr size_t default_batch_size = 4096;
+
+private:
+    batch_func_type on_batch_;
+    error_func_type on_error_;
+    size_t batch_size_;
+    std::vector<id_quad> batch_;
+    storage::DynNodeStoragePtr node_storage_;
+
+public:
+    /**
+     * @param on_batch called with every full batch and with the remaining quads at the end of the input.
+     *          The span is only valid during the call.
+     * @param on_error called for every parsing error. Quads parsed before the error are handed to on_batch before on_error is called.
+     * @param batch_size maximum number of quads per batch
+     * @throws std::invalid_argument if batch_size is 0
+     */
+    explicit BatchingQuadSink(batch_func_type on_batch,
+                              error_func_type on_error = [](ParsingError const &) noexcept {},
+                              size_t batch_size = default_batch_size);
+
+    void on_begin(storage::DynNodeStoragePtr node_storage) override;
+
+    void on_quad(storage::identifier::NodeBackendID graph,
+                 storage::identifier::NodeBackendID subject,
+                 storage::identifier::NodeBackendID predicate,
+                 storage::identifier::NodeBackendID object) override {
+        batch_.push_back(id_quad{graph, subject, predicate, object});
+        if (batch_.size() >= batch_size_) [[unlikely]] {
+            flush();
+        }
+    }
+
+    void on_error(ParsingError const &error) override;
+    void on_end() override;
+
+    /**
+     * Hands all buffered quads to on_batch (if there are any)
+     */
+    void flush();
+
+    /**
+     * @return the node storage the ids belong to, null before parsing started
+     */
+    [[nodiscard]] storage::DynNodeStoragePtr node_storage() const noexcept {
+        return node_storage_;
+    }
+};
+
+}  // namespace rdf4cpp::parser
+
+#endif  //RDF4CPP_PARSER_BATCHINGQUADSINK_HPP
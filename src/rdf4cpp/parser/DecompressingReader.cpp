@@ -0,0 +1,329 @@
+#include "DecompressingReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <bzlib.h>
+#include <zlib.h>
+#include <zstd.h>
+
+namespace rdf4cpp::parser {
+
+Compression detect_compression(std::string_view const prefix) noexcept {
+    if (prefix.starts_with("\x1f\x8b")) {
+        return Compression::Gzip;
+    }
+    if (prefix.starts_with("\x28\xb5\x2f\xfd")) {
+        return Compression::Zstd;
+    }
+    if (prefix.starts_with("BZh") && prefix.size() >= 4 && prefix[3] >= '1' && prefix[3] <= '9') {
+        return Compression::BZip2;
+    }
+
+    return Compression::None;
+}
+
+/**
+ * Streaming decoder for one compression format
+ */
+struct DecompressingReader::Decoder {
+    enum struct Status {
+        Ok,        //< made progress or needs more input
+        StreamEnd, //< the end of a compressed stream was reached, call reset before decoding the next one
+        Error,     //< the input is corrupt
+    };
+
+    struct Result {
+        size_t consumed;
+        size_t produced;
+        Status status;
+    };
+
+    virtual ~Decoder() = default;
+
+    /**
+     * Decompresses as much of in as possible into out
+     */
+    virtual Result decompress(char const *in, size_t in_size, char *out, size_t out_size) noexcept = 0;
+
+    /**
+     * Prepares the decoder for the next (concatenated) stream
+     */
+    virtual bool reset() noexcept = 0;
+};
+
+namespace {
+
+struct GzipDecoder final : DecompressingReader::Decoder {
+    z_stream z_{};
+
+    GzipDecoder() {
+        if (inflateInit2(&z_, 16 + MAX_WBITS) != Z_OK) { // 16: expect gzip header
+            throw std::runtime_error{"unable to initialize gzip decoder"};
+        }
+    }
+
+    ~GzipDecoder() override {
+        inflateEnd(&z_);
+    }
+
+    Result decompress(char const *in, size_t const in_size, char *out, size_t const out_size) noexcept override {
+        // zlib uses 32-bit sizes
+        z_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(in));
+        z_.avail_in = static_cast<uInt>(std::min<size_t>(in_size, std::numeric_limits<uInt>::max()));
+        z_.next_out = reinterpret_cast<Bytef *>(out);
+        z_.avail_out = static_cast<uInt>(std::min<size_t>(out_size, std::numeric_limits<uInt>::max()));
+
+        auto const avail_in = z_.avail_in;
+        auto const avail_out = z_.avail_out;
+        auto const ret = inflate(&z_, Z_NO_FLUSH);
+        Result res{.consumed = avail_in - z_.avail_in, .produced = avail_out - z_.avail_out, .status = Status::Ok};
+
+        if (ret == Z_STREAM_END) {
+            res.status = Status::StreamEnd;
+        } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            res.status = Status::Error;
+        }
+
+        return res;
+    }
+
+    bool reset() noexcept override {
+        return inflateReset(&z_) == Z_OK;
+    }
+};
+
+struct ZstdDecoder final : DecompressingReader::Decoder {
+    ZSTD_DStream *z_;
+
+    ZstdDecoder() : z_{ZSTD_createDStream()} {
+        if (z_ == nullptr) {
+            throw std::runtime_error{"unable to initialize zstd decoder"};
+        }
+    }
+
+    ~ZstdDecoder() override {
+        ZSTD_freeDStream(z_);
+    }
+
+    Result decompress(char const *in, size_t const in_size, char *out, size_t const out_size) noexcept override {
+        ZSTD_inBuffer in_buf{.src = in, .size = in_size, .pos = 0};
+        ZSTD_outBuffer out_buf{.dst = out, .size = out_size, .pos = 0};
+
+        auto const ret = ZSTD_decompressStream(z_, &out_buf, &in_buf);
+        Result res{.consumed = in_buf.pos, .produced = out_buf.pos, .status = Status::Ok};
+
+        if (ZSTD_isError(ret)) {
+            res.status = Status::Error;
+        } else if (ret == 0) {
+            // frame completely decoded and flushed
+            res.status = Status::StreamEnd;
+        }
+
+        return res;
+    }
+
+    bool reset() noexcept override {
+        return !ZSTD_isError(ZSTD_DCtx_reset(z_, ZSTD_reset_session_only));
+    }
+};
+
+struct BZip2Decoder final : DecompressingReader::Decoder {
+    bz_stream bz_{};
+
+    BZip2Decoder() {
+        if (BZ2_bzDecompressInit(&bz_, 0, 0) != BZ_OK) {
+            throw std::runtime_error{"unable to initialize bzip2 decoder"};
+        }
+    }
+
+    ~BZip2Decoder() override {
+        BZ2_bzDecompressEnd(&bz_);
+    }
+
+    Result decompress(char const *in, size_t const in_size, char *out, size_t const out_size) noexcept override {
+        // bzip2 uses 32-bit sizes
+        bz_.next_in = const_cast<char *>(in);
+        bz_.avail_in = static_cast<unsigned>(std::min<size_t>(in_size, std::numeric_limits<unsigned>::max()));
+        bz_.next_out = out;
+        bz_.avail_out = static_cast<unsigned>(std::min<size_t>(out_size, std::numeric_limits<unsigned>::max()));
+
+        auto const avail_in = bz_.avail_in;
+        auto const avail_out = bz_.avail_out;
+        auto const ret = BZ2_bzDecompress(&bz_);
+        Result res{.consumed = avail_in - bz_.avail_in, .produced = avail_out - bz_.avail_out, .status = Status::Ok};
+
+        if (ret == BZ_STREAM_END) {
+            res.status = Status::StreamEnd;
+        } else if (ret != BZ_OK) {
+            res.status = Status::Error;
+        }
+
+        return res;
+    }
+
+    bool reset() noexcept override {
+        // bzip2 has no reset, start from scratch
+        BZ2_bzDecompressEnd(&bz_);
+        bz_ = bz_stream{};
+        return BZ2_bzDecompressInit(&bz_, 0, 0) == BZ_OK;
+    }
+};
+
+} // namespace
+
+DecompressingReader::DecompressingReader(void *stream, ReadFunc read, ErrorFunc error, size_t const buffer_size)
+    : stream_{stream},
+      read_{read},
+      error_{error},
+      in_buf_size_{buffer_size} {
+    if (buffer_size < 4) {
+        throw std::invalid_argument{"buffer size must be at least 4"};
+    }
+
+    in_buf_ = std::make_unique_for_overwrite<char[]>(buffer_size);
+}
+
+DecompressingReader::DecompressingReader(DecompressingReader &&other) noexcept = default;
+DecompressingReader &DecompressingReader::operator=(DecompressingReader &&other) noexcept = default;
+DecompressingReader::~DecompressingReader() = default;
+
+void DecompressingReader::refill() noexcept {
+    if (in_pos_ > 0) {
+        std::memmove(in_buf_.get(), in_buf_.get() + in_pos_, in_size_ - in_pos_);
+        in_size_ -= in_pos_;
+        in_pos_ = 0;
+    }
+
+    if (in_size_ == in_buf_size_ || in_eof_) {
+        return;
+    }
+
+    auto const n = read_(in_buf_.get() + in_size_, 1, in_buf_size_ - in_size_, stream_);
+    in_size_ += n;
+
+    if (n == 0) {
+        in_eof_ = true;
+        failed_ |= error_(stream_) != 0;
+    }
+}
+
+void DecompressingReader::detect() noexcept {
+    detected_ = true;
+
+    while (in_size_ < 4 && !in_eof_) {
+        refill();
+    }
+
+    compression_ = detect_compression(std::string_view{in_buf_.get(), in_size_});
+
+    try {
+        switch (compression_) {
+            case Compression::Gzip:
+                decoder_ = std::make_unique<GzipDecoder>();
+                break;
+            case Compression::Zstd:
+                decoder_ = std::make_unique<ZstdDecoder>();
+                break;
+            case Compression::BZip2:
+                decoder_ = std::make_unique<BZip2Decoder>();
+                break;
+            default:
+                break;
+        }
+    } catch (...) {
+        failed_ = true;
+    }
+}
+
+size_t DecompressingReader::read_bytes(char *out, size_t const count) noexcept {
+    if (!detected_) [[unlikely]] {
+        detect();
+    }
+
+    if (failed_) [[unlikely]] {
+        return 0;
+    }
+
+    size_t total = 0;
+
+    if (compression_ == Compression::None) {
+        // hand out the bytes read during detection first, then read directly into out
+        auto const n = std::min(count, in_size_ - in_pos_);
+        std::memcpy(out, in_buf_.get() + in_pos_, n);
+        in_pos_ += n;
+        total += n;
+
+        if (total < count && !in_eof_) {
+            auto const requested = count - total;
+            auto const m = read_(out + total, 1, requested, stream_);
+            total += m;
+
+            if (m < requested) {
+                failed_ |= error_(stream_) != 0;
+            }
+        }
+
+        return total;
+    }
+
+    while (total < count) {
+        if (in_pos_ == in_size_) {
+            refill();
+        }
+
+        if (stream_end_) {
+            if (in_pos_ == in_size_) {
+                break; // end of input after a complete stream
+            }
+
+            // next concatenated stream
+            if (!decoder_->reset()) {
+                failed_ = true;
+                break;
+            }
+            stream_end_ = false;
+        }
+
+        auto const res = decoder_->decompress(in_buf_.get() + in_pos_, in_size_ - in_pos_, out + total, count - total);
+        in_pos_ += res.consumed;
+        total += res.produced;
+
+        if (res.status == Decoder::Status::Error) {
+            failed_ = true;
+            break;
+        }
+
+        if (res.status == Decoder::Status::StreamEnd) {
+            stream_end_ = true;
+        } else if (res.consumed == 0 && res.produced == 0 && in_pos_ == in_size_ && in_eof_) {
+            failed_ = true; // truncated input
+            break;
+        }
+    }
+
+    return total;
+}
+
+Compression DecompressingReader::compression() noexcept {
+    if (!detected_) {
+        detect();
+    }
+
+    return compression_;
+}
+
+size_t DecompressingReader::read(void *buffer, size_t const elem_size, size_t const count, void *voided_self) noexcept {
+    auto *self = static_cast<DecompressingReader *>(voided_self);
+    return self->read_bytes(static_cast<char *>(buffer), elem_size * count) / elem_size;
+}
+
+int DecompressingReader::error(void *voided_self) noexcept {
+    auto const *self = static_cast<DecompressingReader const *>(voided_self);
+    return static_cast<int>(self->failed_);
+}
+
+}  // namespace rdf4cpp::parser
@@ -0,0 +1,126 @@
+#ifndef RDF4CPP_PARSER_DECOMPRESSINGREADER_HPP
+#define RDF4CPP_PARSER_DECOMPRESSINGREADER_HPP
+
+#include <rdf4cpp/parser/IStreamQuadIterator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace rdf4cpp::parser {
+
+/**
+ * Compression formats that are recognized by DecompressingReader
+ */
+enum struct Compression : uint8_t {
+    None,
+    Gzip,
+    Zstd,
+    BZip2,
+};
+
+/**
+ * Detects the compression format of some data by its magic bytes
+ *
+ * @param prefix the first (at least 4) bytes of the data
+ * @return the compression format, Compression::None if no known format matches
+ */
+[[nodiscard]] Compression detect_compression(std::string_view prefix) noexcept;
+
+/**
+ * Reads from an underlying (stream, ReadFunc, ErrorFunc) source and decompresses it on the fly, if it is compressed.
+ * The compression format is detected by the magic bytes at the start of the input (see detect_compression),
+ * uncompressed input is passed through as is.
+ * Concatenated streams (e.g. produced by pigz, pbzip2 or zstdmt) are supported.
+ *
+ * The reader itself is again a (stream, ReadFunc, ErrorFunc) source, pass it to IStreamQuadIterator
+ * using DecompressingReader::read and DecompressingReader::error.
+ * Corrupt or truncated compressed input is reported as a stream error.
+ *
+ * To overlap decompression with parsing, put a PrefetchingReader on top of a DecompressingReader.
+ *
+ * @example
+ * @code
+ * FILE *file = fopen_fastseq("data.nt.gz", "r");
+ * DecompressingReader reader{file, reinterpret_cast<ReadFunc>(&fread), reinterpret_cast<ErrorFunc>(&ferror)};
+ * for (IStreamQuadIterator qit{&reader, &DecompressingReader::read, &DecompressingReader::error}; qit != std::default_sentinel; ++qit) {
+ *     // ...
+ * }
+ * @endcode
+ */
+struct DecompressingReader {
+    static constexpr size_t default_buffer_size = 1 << 17;
+
+    struct Decoder; //< implementation detail
+
+private:
+    void *stream_;
+    ReadFunc read_;
+    ErrorFunc error_;
+
+    std::unique_ptr<char[]> in_buf_; //< compressed input
+    size_t in_buf_size_;
+    size_t in_size_ = 0; //< number of valid bytes in in_buf_
+    size_t in_pos_ = 0;  //< number of bytes of in_buf_ that were already consumed
+
+    bool detected_ = false;
+    bool in_eof_ = false;
+    bool failed_ = false;
+    bool stream_end_ = false; //< the decoder reached the end of a compressed stream
+    Compression compression_ = Compression::None;
+    std::unique_ptr<Decoder> decoder_;
+
+    /**
+     * Reads more input into in_buf_ (appending to the unconsumed bytes)
+     */
+    void refill() noexcept;
+    void detect() noexcept;
+    size_t read_bytes(char *out, size_t count) noexcept;
+
+public:
+    /**
+     * @param stream pointer to the underlying source
+     * @param read see ReadFunc
+     * @param error see ErrorFunc
+     * @param buffer_size size of the buffer for compressed input in bytes
+     * @throws std::invalid_argument if buffer_size is less than 4
+     */
+    DecompressingReader(void *stream,
+                        ReadFunc read,
+                        ErrorFunc error,
+                        size_t buffer_size = default_buffer_size);
+
+    DecompressingReader(DecompressingReader const &) = delete;
+    DecompressingReader(DecompressingReader &&) noexcept;
+    DecompressingReader &operator=(DecompressingReader const &) = delete;
+    DecompressingReader &operator=(DecompressingReader &&) noexcept;
+
+    ~DecompressingReader();
+
+    /**
+     * Determines the compression format of the input. Reads the first bytes of the input, if not done yet.
+     *
+     * @return the compression format of the input
+     */
+    [[nodiscard]] Compression compression() noexcept;
+
+    /**
+     * ReadFunc over a DecompressingReader
+     *
+     * @param voided_self pointer to a DecompressingReader cast to void *
+     */
+    static size_t read(void *buffer, size_t elem_size, size_t count, void *voided_self) noexcept;
+
+    /**
+     * ErrorFunc over a DecompressingReader.
+     * Reports an error if the underlying stream reported an error or the compressed input is corrupt.
+     *
+     * @param voided_self pointer to a DecompressingReader cast to void *
+     */
+    static int error(void *voided_self) noexcept;
+};
+
+}  // namespace rdf4cpp::parser
+
+#endif  //RDF4CPP_PARSER_DECOMPRESSINGREADER_HPP
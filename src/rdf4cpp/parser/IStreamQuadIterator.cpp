@@ -53,6 +53,13 @@ IStreamQuadIterator::IStreamQuadIterator(std::istream &istream,
     : IStreamQuadIterator{&istream, &istream_read, &istream_error, flags, state} {
 }
 
+IStreamQuadIterator::IStreamQuadIterator(MMappedInput const &input,
+                                         flags_type flags,
+                                         state_type *state)
+    : impl{std::make_unique<Impl>(input, flags, state)},
+      cur{impl->next()} {
+}
+
 IStreamQuadIterator::IStreamQuadIterator(IStreamQuadIterator &&other) noexcept = default;
 IStreamQuadIterator &IStreamQuadIterator::operator=(IStreamQuadIterator &&) noexcept = default;
 
@@ -87,6 +94,29 @@ bool IStreamQuadIterator::operator!=(std::default_sentinel_t) const noexcept {
     return cur.has_value();
 }
 
+void IStreamQuadIterator::parse_into(QuadSink &sink,
+                                     void *stream,
+                                     ReadFunc read,
+                                     ErrorFunc error,
+                                     flags_type flags,
+                                     state_type *state) {
+    Impl{stream, read, error, flags, state}.drain_into(sink);
+}
+
+void IStreamQuadIterator::parse_into(QuadSink &sink,
+                                     std::istream &istream,
+                                     flags_type flags,
+                                     state_type *state) {
+    parse_into(sink, &istream, &istream_read, &istream_error, flags, state);
+}
+
+void IStreamQuadIterator::parse_into(QuadSink &sink,
+                                     MMappedInput const &input,
+                                     flags_type flags,
+                                     state_type *state) {
+    Impl{input, flags, state}.drain_into(sink);
+}
+
 FILE *fopen_fastseq(char const *path, char const *mode) noexcept {
     // inspired by <serd/system.c> (serd_fopen)
 
@@ -8,9 +8,11 @@
 
 #include <rdf4cpp/Quad.hpp>
 
+#include <rdf4cpp/parser/MMappedInput.hpp>
 #include <rdf4cpp/parser/ParsingError.hpp>
 #include <rdf4cpp/parser/ParsingFlags.hpp>
 #include <rdf4cpp/parser/ParsingState.hpp>
+#include <rdf4cpp/parser/QuadSink.hpp>
 #include <rdf4cpp/IRIFactory.hpp>
 
 namespace rdf4cpp::parser {
@@ -107,6 +109,20 @@ public:
                                  flags_type flags = ParsingFlags::none(),
                                  state_type *initial_state = nullptr);
 
+    /**
+     * Constructs an IStreamQuadIterator to parse a memory mapped file.
+     * The mapped contents are parsed in place, i.e. without copying them into an intermediate buffer.
+     *
+     * @param input the mapped file, must outlive the constructed iterator
+     * @param flags specifies the parser behaviour
+     * @param initial_state optionally specifies the initial state of the parser,
+     *          providing nullptr as the initial state results in the parser creating its own,fresh state
+     *          instead of writing to the provided state.
+     */
+    explicit IStreamQuadIterator(MMappedInput const &input,
+                                 flags_type flags = ParsingFlags::none(),
+                                 state_type *initial_state = nullptr);
+
     IStreamQuadIterator(IStreamQuadIterator const &) = delete;
     IStreamQuadIterator(IStreamQuadIterator &&) noexcept;
 
@@ -124,6 +140,36 @@ public:
 
     bool operator==(std::default_sentinel_t) const noexcept;
     bool operator!=(std::default_sentinel_t) const noexcept;
+
+    /**
+     * Push-style alternative to iterating.
+     * Parses the whole input and hands the ids of all parsed quads directly to sink, without materializing Quads.
+     * The parameters (except sink) have the same meaning as in the corresponding constructor.
+     *
+     * @param sink receives all quads and errors
+     */
+    static void parse_into(QuadSink &sink,
+                           void *stream,
+                           ReadFunc read,
+                           ErrorFunc error,
+                           flags_type flags = ParsingFlags::none(),
+                           state_type *initial_state = nullptr);
+
+    /**
+     * @see parse_into(QuadSink &, void *, ReadFunc, ErrorFunc, flags_type, state_type *)
+     */
+    static void parse_into(QuadSink &sink,
+                           std::istream &istream,
+                           flags_type flags = ParsingFlags::none(),
+                           state_type *initial_state = nullptr);
+
+    /**
+     * @see parse_into(QuadSink &, void *, ReadFunc, ErrorFunc, flags_type, state_type *)
+     */
+    static void parse_into(QuadSink &sink,
+                           MMappedInput const &input,
+                           flags_type flags = ParsingFlags::none(),
+                           state_type *initial_state = nullptr);
 };
 
 /**
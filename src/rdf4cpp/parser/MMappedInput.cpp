@@ -0,0 +1,95 @@
+#include "MMappedInput.hpp"
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rdf4cpp::parser {
+
+[[noreturn]] static void throw_errno(char const *what) {
+    throw std::system_error{errno, std::generic_category(), what};
+}
+
+MMappedInput::MMappedInput(std::filesystem::path const &path) : data_{""}, size_{0}, map_size_{0} {
+    auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw_errno("unable to open file");
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw_errno("unable to stat file");
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0) {
+        // cannot map empty files, data_ points to an empty string
+        ::close(fd);
+        return;
+    }
+
+    // The mapping is at least one byte bigger than the file, so that the contents are followed by a null byte.
+    // The tail of the last page of the file reads as zero, but if the file size is a multiple of the page size
+    // there is no tail. Therefore, first reserve an anonymous (zero-filled) region, then map the file over its beginning.
+    auto const page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    map_size_ = (size_ / page_size + 1) * page_size;
+
+    auto *region = ::mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED) {
+        ::close(fd);
+        throw_errno("unable to reserve memory for file");
+    }
+
+    auto *mapping = ::mmap(region, size_, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+
+    if (mapping == MAP_FAILED) {
+        auto const err = errno;
+        ::munmap(region, map_size_);
+        errno = err;
+        throw_errno("unable to map file");
+    }
+
+    // hints only, failures are not critical
+    (void) ::madvise(mapping, size_, MADV_SEQUENTIAL);
+    (void) ::madvise(mapping, size_, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+    (void) ::madvise(mapping, size_, MADV_HUGEPAGE);
+#endif
+
+    data_ = static_cast<char const *>(mapping);
+}
+
+MMappedInput::MMappedInput(MMappedInput &&other) noexcept
+    : data_{std::exchange(other.data_, "")},
+      size_{std::exchange(other.size_, 0)},
+      map_size_{std::exchange(other.map_size_, 0)} {
+}
+
+MMappedInput &MMappedInput::operator=(MMappedInput &&other) noexcept {
+    if (this != &other) {
+        if (map_size_ != 0) {
+            ::munmap(const_cast<char *>(data_), map_size_);
+        }
+
+        data_ = std::exchange(other.data_, "");
+        size_ = std::exchange(other.size_, 0);
+        map_size_ = std::exchange(other.map_size_, 0);
+    }
+
+    return *this;
+}
+
+MMappedInput::~MMappedInput() {
+    if (map_size_ != 0) {
+        ::munmap(const_cast<char *>(data_), map_size_);
+    }
+}
+
+}  // namespace rdf4cpp::parser
@@ -0,0 +1,58 @@
+#ifndef RDF4CPP_PARSER_MMAPPEDINPUT_HPP
+#define RDF4CPP_PARSER_MMAPPEDINPUT_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace rdf4cpp::parser {
+
+/**
+ * A file that is memory mapped read-only, to be parsed without copying it (see IStreamQuadIterator).
+ * The mapping is hinted for sequential access (and for transparent huge pages if available).
+ *
+ * The contents are always followed by a null byte, which the parser uses to detect the end of the input.
+ * Consequently, the input must not contain null bytes itself (which is never the case for valid RDF documents).
+ */
+struct MMappedInput {
+private:
+    char const *data_;
+    size_t size_;     //< size of the file
+    size_t map_size_; //< size of the mapping, 0 if nothing is mapped
+
+public:
+    /**
+     * Maps the file at path into memory
+     *
+     * @param path path to the file
+     * @throws std::system_error if the file cannot be opened or mapped
+     */
+    explicit MMappedInput(std::filesystem::path const &path);
+
+    MMappedInput(MMappedInput &&other) noexcept;
+    MMappedInput &operator=(MMappedInput &&other) noexcept;
+
+    MMappedInput(MMappedInput const &) = delete;
+    MMappedInput &operator=(MMappedInput const &) = delete;
+
+    ~MMappedInput();
+
+    /**
+     * @return the contents of the file, data()[size()] is guaranteed to be a null byte
+     */
+    [[nodiscard]] std::string_view view() const noexcept {
+        return std::string_view{data_, size_};
+    }
+
+    [[nodiscard]] char const *data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return size_;
+    }
+};
+
+}  // namespace rdf4cpp::parser
+
+#endif  //RDF4CPP_PARSER_MMAPPEDINPUT_HPP
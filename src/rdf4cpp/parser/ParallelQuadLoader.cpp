@@ -0,0 +1,208 @@
+#include "ParallelQuadLoader.hpp"
+
+#include <rdf4cpp/parser/IStreamQuadIterator.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <future>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace rdf4cpp::parser {
+
+struct ParallelQuadLoader::ParsedChunk {
+    Chunk chunk;
+    uint64_t num_lines; //< number of line breaks in the chunk
+};
+
+namespace {
+
+/**
+ * Owning wrapper around a FILE *
+ */
+struct File {
+    FILE *file;
+
+    explicit File(std::string const &path) : file{fopen_fastseq(path.c_str(), "r")} {
+        if (file == nullptr) {
+            throw std::system_error{errno, std::system_category()};
+        }
+    }
+
+    File(File const &) = delete;
+    File &operator=(File const &) = delete;
+
+    ~File() noexcept {
+        fclose(file);
+    }
+
+    void seek(uint64_t const pos) const {
+        if (fseeko(file, static_cast<off_t>(pos), SEEK_SET) != 0) {
+            throw std::system_error{errno, std::system_category()};
+        }
+    }
+};
+
+/**
+ * A byte range of a file, read by the serd reader of one chunk
+ */
+struct ChunkSource {
+    FILE *file;
+    uint64_t remaining;
+    uint64_t num_lines = 0;
+};
+
+/**
+ * Matches the interface of ReadFunc, reads at most the remaining bytes of the chunk
+ */
+size_t chunk_read(void *buf, [[maybe_unused]] size_t elem_size, size_t count, void *voided_self) noexcept {
+    assert(elem_size == 1);
+
+    auto *self = static_cast<ChunkSource *>(voided_self);
+    auto const n = fread(buf, 1, std::min<uint64_t>(count, self->remaining), self->file);
+
+    self->remaining -= n;
+    self->num_lines += std::count(static_cast<char const *>(buf), static_cast<char const *>(buf) + n, '\n');
+    return n;
+}
+
+/**
+ * Matches the interface of ErrorFunc
+ */
+int chunk_error(void *voided_self) noexcept {
+    return ferror(static_cast<ChunkSource *>(voided_self)->file);
+}
+
+}  // namespace
+
+ParallelQuadLoader::ParallelQuadLoader(std::string file_path, flags_type const flags, state_type const *state, size_t const num_threads, size_t const min_chunk_size)
+    : file_path_{std::move(file_path)},
+      flags_{flags},
+      state_{state},
+      num_threads_{num_threads != 0 ? num_threads : std::max(1u, std::thread::hardware_concurrency())},
+      min_chunk_size_{std::max<size_t>(1, min_chunk_size)} {
+
+    if (auto const syntax = flags.get_syntax(); syntax != ParsingFlag::NTriples && syntax != ParsingFlag::NQuads) {
+        throw std::invalid_argument{"ParallelQuadLoader only supports line based syntaxes (N-Triples, N-Quads)"};
+    }
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> ParallelQuadLoader::split_into_chunks() const {
+    auto const file_size = std::filesystem::file_size(file_path_);
+
+    // a few chunks per thread, so that threads that finish early can pick up more work
+    auto const num_chunks = std::max<uint64_t>(1, std::min<uint64_t>(num_threads_ * 4, file_size / min_chunk_size_));
+
+    std::vector<std::pair<uint64_t, uint64_t>> chunks;
+    chunks.reserve(num_chunks);
+
+    File file{file_path_};
+
+    uint64_t begin = 0;
+    for (uint64_t ix = 1; ix < num_chunks && begin < file_size; ++ix) {
+        auto end = std::max(begin, ix * file_size / num_chunks);
+
+        // move end behind the next line break
+        file.seek(end);
+        int c;
+        while ((c = fgetc(file.file)) != EOF) {
+            ++end;
+            if (c == '\n') {
+                break;
+            }
+        }
+
+        if (end > begin) {
+            chunks.emplace_back(begin, end);
+        }
+        begin = end;
+    }
+
+    if (begin < file_size || chunks.empty()) {
+        chunks.emplace_back(begin, file_size);
+    }
+
+    return chunks;
+}
+
+ParallelQuadLoader::ParsedChunk ParallelQuadLoader::parse_chunk(uint64_t const begin, uint64_t const end) const {
+    File file{file_path_};
+    file.seek(begin);
+
+    // the IRIFactory is not copyable and not needed for line based syntaxes
+    state_type state{};
+    if (state_ != nullptr) {
+        state.node_storage = state_->node_storage;
+        state.blank_node_scope_manager = state_->blank_node_scope_manager;
+        state.inspect_node_func = state_->inspect_node_func;
+    }
+
+    ChunkSource source{.file = file.file, .remaining = end - begin};
+    ParsedChunk ret{};
+
+    for (IStreamQuadIterator qit{&source, &chunk_read, &chunk_error, flags_, &state}; qit != std::default_sentinel; ++qit) {
+        if (qit->has_value()) {
+            ret.chunk.quads.push_back(**qit);
+        } else {
+            ret.chunk.errors.push_back(qit->error());
+        }
+    }
+
+    ret.num_lines = source.num_lines;
+    return ret;
+}
+
+void ParallelQuadLoader::load(std::function<void(Chunk &&)> const &consume) const {
+    auto const chunks = split_into_chunks();
+
+    std::vector<std::promise<ParsedChunk>> promises(chunks.size());
+    std::vector<std::future<ParsedChunk>> futures;
+    futures.reserve(chunks.size());
+    for (auto &promise : promises) {
+        futures.push_back(promise.get_future());
+    }
+
+    std::atomic<size_t> next_chunk = 0;
+    std::atomic<bool> cancelled = false;
+
+    std::vector<std::jthread> workers;
+    workers.reserve(std::min(num_threads_, chunks.size()));
+
+    for (size_t t = 0; t < std::min(num_threads_, chunks.size()); ++t) {
+        workers.emplace_back([&]() noexcept {
+            for (auto ix = next_chunk.fetch_add(1, std::memory_order_relaxed); ix < chunks.size() && !cancelled.load(std::memory_order_relaxed); ix = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+                try {
+                    promises[ix].set_value(parse_chunk(chunks[ix].first, chunks[ix].second));
+                } catch (...) {
+                    promises[ix].set_exception(std::current_exception());
+                }
+            }
+        });
+    }
+
+    try {
+        uint64_t line_offset = 0;
+        for (auto &future : futures) {
+            auto parsed = future.get();
+
+            for (auto &error : parsed.chunk.errors) {
+                error.line += line_offset;
+            }
+            line_offset += parsed.num_lines;
+
+            consume(std::move(parsed.chunk));
+        }
+    } catch (...) {
+        // workers are joined by their destructors, make them stop early
+        cancelled.store(true, std::memory_order_relaxed);
+        throw;
+    }
+}
+
+}  // namespace rdf4cpp::parser
@@ -0,0 +1,94 @@
+#ifndef RDF4CPP_PARSER_PARALLELQUADLOADER_HPP
+#define RDF4CPP_PARSER_PARALLELQUADLOADER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <rdf4cpp/Quad.hpp>
+#include <rdf4cpp/parser/ParsingError.hpp>
+#include <rdf4cpp/parser/ParsingFlags.hpp>
+#include <rdf4cpp/parser/ParsingState.hpp>
+
+namespace rdf4cpp::parser {
+
+/**
+ * Parses a file in a line based syntax (N-Triples or N-Quads) using multiple threads.
+ * The file is split into chunks at line boundaries, each chunk is parsed by its own parser on a worker thread.
+ * The parsed chunks are handed to the caller in file order on the calling thread.
+ *
+ * @warning The node storage and blank node scope manager in the parsing state must be thread-safe,
+ *          and the inspect_node_func must be safe to call concurrently.
+ *
+ * @example
+ * @code
+ * storage::reference_node_storage::SyncReferenceNodeStorage ns{};
+ * ParsingState state{.node_storage = ns};
+ *
+ * ParallelQuadLoader loader{"quads.nq", ParsingFlag::NQuads, &state};
+ * loader.load([](ParallelQuadLoader::Chunk &&chunk) {
+ *     for (auto const &quad : chunk.quads) {
+ *         std::cout << quad << std::endl;
+ *     }
+ *     for (auto const &error : chunk.errors) {
+ *         std::cerr << error << std::endl;
+ *     }
+ * });
+ * @endcode
+ */
+struct ParallelQuadLoader {
+    using flags_type = ParsingFlags;
+    using state_type = ParsingState;
+
+    /**
+     * The result of parsing one chunk of the file
+     */
+    struct Chunk {
+        std::vector<Quad> quads;
+        std::vector<ParsingError> errors; //< line numbers are relative to the beginning of the file
+    };
+
+private:
+    std::string file_path_;
+    flags_type flags_;
+    state_type const *state_;
+    size_t num_threads_;
+    size_t min_chunk_size_;
+
+    struct ParsedChunk;
+
+    [[nodiscard]] std::vector<std::pair<uint64_t, uint64_t>> split_into_chunks() const;
+    [[nodiscard]] ParsedChunk parse_chunk(uint64_t begin, uint64_t end) const;
+
+public:
+    static constexpr size_t default_min_chunk_size = 1 << 20;
+
+    /**
+     * @param file_path path to the file to parse
+     * @param flags parsing flags, the syntax must be either ParsingFlag::NTriples or ParsingFlag::NQuads
+     * @param state parsing state used to configure the parsers (node storage, blank node scope manager, inspect_node_func)
+     *          providing nullptr results in a default state. The iri_factory of the state is ignored, because the
+     *          supported syntaxes do not have prefixes.
+     * @param num_threads number of worker threads, 0 means std::thread::hardware_concurrency()
+     * @param min_chunk_size files are not split into chunks smaller than this (in bytes)
+     * @throws std::invalid_argument if the syntax in flags is not line based
+     */
+    explicit ParallelQuadLoader(std::string file_path,
+                                flags_type flags = ParsingFlag::NTriples,
+                                state_type const *state = nullptr,
+                                size_t num_threads = 0,
+                                size_t min_chunk_size = default_min_chunk_size);
+
+    /**
+     * Parses the file.
+     *
+     * @param consume called with every parsed chunk, in file order, on the calling thread
+     * @throws std::system_error if the file cannot be read
+     */
+    void load(std::function<void(Chunk &&)> const &consume) const;
+};
+
+}  // namespace rdf4cpp::parser
+
+#endif  //RDF4CPP_PARSER_PARALLELQUADLOADER_HPP
@@ -16,6 +16,7 @@ enum struct ParsingFlag : uint8_t {
     NoParsePrefix    = 1 << 1,
     KeepBlankNodeIds = 1 << 2,
     NoParseBlankNode = 1 << 3,
+    Trusted          = 1 << 6, // skip IRI and literal validation, only use for input that is known to be valid (e.g. previously validated dumps)
 
     Turtle   = 0b00 << 4, // default
     NTriples = 0b01 << 4,
@@ -0,0 +1,124 @@
+#include "PrefetchingReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace rdf4cpp::parser {
+
+PrefetchingReader::PrefetchingReader(void *stream, ReadFunc read, ErrorFunc error, size_t const buffer_size, size_t const depth)
+    : stream_{stream},
+      read_{read},
+      error_{error},
+      buffer_size_{buffer_size} {
+    if (buffer_size == 0) {
+        throw std::invalid_argument{"buffer size must be greater than 0"};
+    }
+    if (depth == 0) {
+        throw std::invalid_argument{"depth must be greater than 0"};
+    }
+
+    buffers_.resize(depth);
+    for (auto &buf : buffers_) {
+        buf.data = std::make_unique_for_overwrite<char[]>(buffer_size);
+    }
+
+    worker_ = std::jthread{[this](std::stop_token const &stop) {
+        run(stop);
+    }};
+}
+
+void PrefetchingReader::run(std::stop_token const &stop) {
+    try {
+        while (true) {
+            {
+                std::unique_lock lock{mutex_};
+                if (!cv_.wait(lock, stop, [this]() { return produced_ - consumed_ < buffers_.size(); })) {
+                    return; // stop requested
+                }
+            }
+
+            // produced_ is only modified by this thread, and the consumer does not touch unfilled buffers
+            auto &buf = buffers_[produced_ % buffers_.size()];
+            buf.size = read_(buf.data.get(), 1, buffer_size_, stream_);
+            auto const failed = buf.size < buffer_size_ && error_(stream_) != 0;
+            auto const done = buf.size == 0 || failed;
+
+            {
+                std::lock_guard lock{mutex_};
+                if (buf.size > 0) {
+                    ++produced_;
+                }
+                done_ = done;
+                failed_ = failed;
+            }
+            cv_.notify_all();
+
+            if (done) {
+                return;
+            }
+        }
+    } catch (...) {
+        {
+            std::lock_guard lock{mutex_};
+            exception_ = std::current_exception();
+            done_ = true;
+            failed_ = true;
+        }
+        cv_.notify_all();
+    }
+}
+
+size_t PrefetchingReader::read_bytes(char *out, size_t const count) {
+    size_t total = 0;
+
+    while (total < count) {
+        if (available_ == 0) {
+            std::unique_lock lock{mutex_};
+            cv_.wait(lock, [this]() { return produced_ > consumed_ || done_; });
+
+            available_ = produced_ - consumed_;
+            if (available_ == 0) {
+                break; // end of input
+            }
+        }
+
+        // consumed_ is only modified by this thread
+        auto const &buf = buffers_[consumed_ % buffers_.size()];
+        auto const n = std::min(count - total, buf.size - read_pos_);
+        std::memcpy(out + total, buf.data.get() + read_pos_, n);
+        total += n;
+        read_pos_ += n;
+
+        if (read_pos_ == buf.size) {
+            // hand the buffer back to the background thread
+            read_pos_ = 0;
+            --available_;
+            {
+                std::lock_guard lock{mutex_};
+                ++consumed_;
+            }
+            cv_.notify_all();
+        }
+    }
+
+    return total;
+}
+
+size_t PrefetchingReader::read(void *buffer, size_t const elem_size, size_t const count, void *voided_self) noexcept {
+    auto *self = static_cast<PrefetchingReader *>(voided_self);
+    return self->read_bytes(static_cast<char *>(buffer), elem_size * count) / elem_size;
+}
+
+int PrefetchingReader::error(void *voided_self) noexcept {
+    auto *self = static_cast<PrefetchingReader *>(voided_self);
+    std::lock_guard lock{self->mutex_};
+    return static_cast<int>(self->failed_);
+}
+
+std::exception_ptr PrefetchingReader::exception() noexcept {
+    std::lock_guard lock{mutex_};
+    return exception_;
+}
+
+}  // namespace rdf4cpp::parser
@@ -0,0 +1,121 @@
+#ifndef RDF4CPP_PARSER_PREFETCHINGREADER_HPP
+#define RDF4CPP_PARSER_PREFETCHINGREADER_HPP
+
+#include <rdf4cpp/parser/IStreamQuadIterator.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rdf4cpp::parser {
+
+/**
+ * Reads from an underlying (stream, ReadFunc, ErrorFunc) source on a dedicated background thread,
+ * so that reading (and e.g. decompressing, if the underlying ReadFunc does so) overlaps with parsing.
+ *
+ * The background thread fills a ring of depth buffers of buffer_size bytes each, ahead of the consumer.
+ * The reader itself is again a (stream, ReadFunc, ErrorFunc) source, pass it to IStreamQuadIterator
+ * using PrefetchingReader::read and PrefetchingReader::error.
+ *
+ * @example
+ * @code
+ * FILE *file = fopen_fastseq("data.nt", "r");
+ * PrefetchingReader reader{file, reinterpret_cast<ReadFunc>(&fread), reinterpret_cast<ErrorFunc>(&ferror)};
+ * for (IStreamQuadIterator qit{&reader, &PrefetchingReader::read, &PrefetchingReader::error}; qit != std::default_sentinel; ++qit) {
+ *     // ...
+ * }
+ * @endcode
+ *
+ * @note The underlying stream is exclusively used by the background thread until the reader is destroyed.
+ *      It must outlive the reader.
+ */
+struct PrefetchingReader {
+    static constexpr size_t default_buffer_size = 1 << 20;
+    static constexpr size_t default_depth = 4;
+
+private:
+    struct Buffer {
+        std::unique_ptr<char[]> data;
+        size_t size = 0; //< number of valid bytes in data
+    };
+
+    void *stream_;
+    ReadFunc read_;
+    ErrorFunc error_;
+    size_t buffer_size_;
+    std::vector<Buffer> buffers_;
+
+    std::mutex mutex_;
+    std::condition_variable_any cv_;
+    // protected by mutex_
+    size_t produced_ = 0; //< number of buffers filled by the background thread so far
+    size_t consumed_ = 0; //< number of buffers completely consumed so far
+    bool done_ = false;   //< true if the background thread will not produce any more buffers
+    bool failed_ = false; //< true if the underlying stream reported an error
+    std::exception_ptr exception_; //< exception thrown by the underlying ReadFunc, if any
+
+    // only accessed by the consumer
+    size_t read_pos_ = 0;       //< position in the current buffer
+    size_t available_ = 0;      //< number of filled buffers that are known to be available to the consumer
+
+    std::jthread worker_; //< must be the last member, so that it is joined before everything else is destroyed
+
+    void run(std::stop_token const &stop);
+
+    size_t read_bytes(char *out, size_t count);
+
+public:
+    /**
+     * Starts prefetching from the given source
+     *
+     * @param stream pointer to the underlying source
+     * @param read see ReadFunc, called on the background thread
+     * @param error see ErrorFunc, called on the background thread
+     * @param buffer_size size of each buffer in bytes
+     * @param depth number of buffers, i.e. how far the background thread may read ahead
+     * @throws std::invalid_argument if buffer_size or depth is 0
+     */
+    PrefetchingReader(void *stream,
+                      ReadFunc read,
+                      ErrorFunc error,
+                      size_t buffer_size = default_buffer_size,
+                      size_t depth = default_depth);
+
+    PrefetchingReader(PrefetchingReader const &) = delete;
+    PrefetchingReader(PrefetchingReader &&) = delete;
+    PrefetchingReader &operator=(PrefetchingReader const &) = delete;
+    PrefetchingReader &operator=(PrefetchingReader &&) = delete;
+
+    /**
+     * Stops the background thread. Blocks until a potentially running read of the underlying source returns.
+     */
+    ~PrefetchingReader() = default;
+
+    /**
+     * ReadFunc over a PrefetchingReader
+     *
+     * @param voided_self pointer to a PrefetchingReader cast to void *
+     */
+    static size_t read(void *buffer, size_t elem_size, size_t count, void *voided_self) noexcept;
+
+    /**
+     * ErrorFunc over a PrefetchingReader.
+     * Reports an error if the underlying stream reported an error or its ReadFunc threw an exception.
+     *
+     * @param voided_self pointer to a PrefetchingReader cast to void *
+     */
+    static int error(void *voided_self) noexcept;
+
+    /**
+     * @return the exception thrown by the underlying ReadFunc, if any
+     */
+    [[nodiscard]] std::exception_ptr exception() noexcept;
+};
+
+}  // namespace rdf4cpp::parser
+
+#endif  //RDF4CPP_PARSER_PREFETCHINGREADER_HPP
@@ -0,0 +1,56 @@
+#ifndef RDF4CPP_PARSER_QUADSINK_HPP
+#define RDF4CPP_PARSER_QUADSINK_HPP
+
+#include <rdf4cpp/parser/ParsingError.hpp>
+#include <rdf4cpp/storage/NodeStorage.hpp>
+#include <rdf4cpp/storage/identifier/NodeBackendID.hpp>
+
+namespace rdf4cpp::parser {
+
+/**
+ * Receiver for push-style parsing (see IStreamQuadIterator::parse_into).
+ * Instead of materializing a Quad for every statement, the parser directly hands the ids of the parsed nodes to the sink.
+ * All ids belong to the node storage of the parsing state.
+ *
+ * Exceptions thrown from the callbacks abort parsing and are propagated to the caller of parse_into.
+ */
+struct QuadSink {
+    virtual ~QuadSink() = default;
+
+    /**
+     * Called once before parsing starts
+     *
+     * @param node_storage the node storage all ids passed to on_quad belong to
+     */
+    virtual void on_begin([[maybe_unused]] storage::DynNodeStoragePtr node_storage) {
+    }
+
+    /**
+     * Called for every successfully parsed statement, in input order.
+     *
+     * @param graph id of the graph name, the id of the default graph IRI if the statement has no graph name
+     * @param subject id of the subject
+     * @param predicate id of the predicate
+     * @param object id of the object
+     */
+    virtual void on_quad(storage::identifier::NodeBackendID graph,
+                         storage::identifier::NodeBackendID subject,
+                         storage::identifier::NodeBackendID predicate,
+                         storage::identifier::NodeBackendID object) = 0;
+
+    /**
+     * Called for every parsing error, in input order (relative to on_quad)
+     */
+    virtual void on_error(ParsingError const &error) = 0;
+
+    /**
+     * Called once after the whole input was parsed.
+     * Not called if parsing is aborted by an exception.
+     */
+    virtual void on_end() {
+    }
+};
+
+}  // namespace rdf4cpp::parser
+
+#endif  //RDF4CPP_PARSER_QUADSINK_HPP
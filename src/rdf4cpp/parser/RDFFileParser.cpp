@@ -4,19 +4,28 @@
 #include <rdf4cpp/parser/IStreamQuadIteratorSerdImpl.hpp>
 
 namespace rdf4cpp::parser {
-RDFFileParser::RDFFileParser(const std::string &file_path, flags_type flags, state_type *state)
-    : file_path_(file_path), flags_(flags), state_(state) {
+RDFFileParser::RDFFileParser(const std::string &file_path, flags_type flags, state_type *state, InputMode input_mode)
+    : file_path_(file_path), flags_(flags), state_(state), input_mode_(input_mode) {
 }
-RDFFileParser::RDFFileParser(std::string &&file_path, flags_type flags, state_type *state)
-    : file_path_(std::move(file_path)), flags_(flags), state_(state) {
+RDFFileParser::RDFFileParser(std::string &&file_path, flags_type flags, state_type *state, InputMode input_mode)
+    : file_path_(std::move(file_path)), flags_(flags), state_(state), input_mode_(input_mode) {
 }
 RDFFileParser::iterator RDFFileParser::begin() const {
+    if (input_mode_ == InputMode::MMap) {
+        MMappedInput input{file_path_};
+        if (detect_compression(input.view()) == Compression::None) {
+            return {std::move(input), flags_, state_};
+        }
+
+        // compressed files cannot be parsed in place, read them sequentially instead
+    }
+
     FILE *stream = fopen_fastseq(file_path_.c_str(), "r");
     if (stream == nullptr) {
         throw std::system_error{errno, std::system_category()};
     }
 
-    return {std::move(stream), flags_, state_};
+    return {std::move(stream), flags_, state_, input_mode_ == InputMode::Prefetch};
 }
 std::default_sentinel_t RDFFileParser::end() const noexcept {
     return {};
@@ -27,13 +36,33 @@ RDFFileParser::iterator::iterator()
 }
 RDFFileParser::iterator::iterator(FILE *&&stream,
                                   flags_type flags,
-                                  state_type *state)
+                                  state_type *state,
+                                  bool prefetch)
     : stream_(stream),
-      iter_(std::make_unique<IStreamQuadIterator>(stream_, reinterpret_cast<ReadFunc>(&fread), reinterpret_cast<ErrorFunc>(&ferror),
-                                                  flags, state)) {
+      decompressor_(std::make_unique<DecompressingReader>(stream_, reinterpret_cast<ReadFunc>(&fread), reinterpret_cast<ErrorFunc>(&ferror))) {
+    if (prefetch) {
+        reader_ = std::make_unique<PrefetchingReader>(decompressor_.get(), &DecompressingReader::read, &DecompressingReader::error);
+        iter_ = std::make_unique<IStreamQuadIterator>(reader_.get(), &PrefetchingReader::read, &PrefetchingReader::error, flags, state);
+    } else {
+        iter_ = std::make_unique<IStreamQuadIterator>(decompressor_.get(), &DecompressingReader::read, &DecompressingReader::error, flags, state);
+    }
+}
+RDFFileParser::iterator::iterator(MMappedInput &&input,
+                                  flags_type flags,
+                                  state_type *state)
+    : stream_(nullptr),
+      input_(std::make_unique<MMappedInput>(std::move(input))),
+      iter_(std::make_unique<IStreamQuadIterator>(*input_, flags, state)) {
 }
 RDFFileParser::iterator::~iterator() noexcept {
-    fclose(stream_);
+    // the background thread of reader_ may still be reading from decompressor_ and stream_
+    iter_.reset();
+    reader_.reset();
+    decompressor_.reset();
+
+    if (stream_ != nullptr) {
+        fclose(stream_);
+    }
 }
 RDFFileParser::iterator::reference RDFFileParser::iterator::operator*() const noexcept {
     return (*iter_).operator*();
@@ -2,12 +2,15 @@
 #define RDF4CPP_RDFFILEPARSER_HPP
 
 #include <cstdio>
+#include <rdf4cpp/parser/DecompressingReader.hpp>
 #include <rdf4cpp/parser/IStreamQuadIterator.hpp>
+#include <rdf4cpp/parser/PrefetchingReader.hpp>
 
 namespace rdf4cpp::parser {
 /**
  * Similar to rdf4cpp::parser::IStreamQuadIterator
  * Parses the file by the given path and tries to extract Quads given in TURTLE format.
+ * gzip, zstd and bzip2 compressed files are detected by their magic bytes and decompressed on the fly (see DecompressingReader).
  *
  * @note the iterator _starts on_ the first Quad
  * @note An exhausted iterator becomes the end-of-stream iterator.
@@ -28,19 +31,31 @@ struct RDFFileParser {
     using state_type = IStreamQuadIterator::state_type;
     using flags_type = IStreamQuadIterator::flags_type;
 
+    /**
+     * Determines how the file is read
+     */
+    enum struct InputMode : uint8_t {
+        Stream,   //< the file is read sequentially into the buffer of the parser
+        MMap,     //< the file is memory mapped and parsed in place (see MMappedInput), compressed files are read like with Stream
+        Prefetch, //< the file is read (and decompressed) ahead on a background thread (see PrefetchingReader)
+    };
+
 private:
     std::string file_path_;
     flags_type flags_;
     state_type *state_;
+    InputMode input_mode_;
 
 public:
     explicit RDFFileParser(const std::string &file_path,
                            flags_type flags = flags_type::none(),
-                           state_type *state = nullptr);
+                           state_type *state = nullptr,
+                           InputMode input_mode = InputMode::Stream);
 
     explicit RDFFileParser(std::string &&file_path,
                            flags_type flags = flags_type::none(),
-                           state_type *state = nullptr);
+                           state_type *state = nullptr,
+                           InputMode input_mode = InputMode::Stream);
 
     struct iterator {
         friend struct RDFFileParser;
@@ -48,13 +63,20 @@ public:
     private:
         friend bool operator==(const RDFFileParser::iterator &iter, std::default_sentinel_t) noexcept;
         FILE *stream_;
+        std::unique_ptr<MMappedInput> input_;
+        std::unique_ptr<DecompressingReader> decompressor_;
+        std::unique_ptr<PrefetchingReader> reader_;
         std::unique_ptr<IStreamQuadIterator> iter_;
 
         iterator();
         /**
          * Constructs an iterator by taking ownership of the given file
          */
-        iterator(FILE *&&stream, flags_type flags, state_type *state);
+        iterator(FILE *&&stream, flags_type flags, state_type *state, bool prefetch = false);
+        /**
+         * Constructs an iterator by taking ownership of the given mapped file
+         */
+        iterator(MMappedInput &&input, flags_type flags, state_type *state);
 
     public:
         ~iterator() noexcept;
@@ -2,6 +2,7 @@
 #define RDF4CPP_STORAGE_NODESTORAGEVTABLE_HPP
 
 #include <concepts>
+#include <span>
 
 #include <rdf4cpp/storage/identifier/NodeBackendID.hpp>
 #include <rdf4cpp/storage/view/BNodeBackendView.hpp>
@@ -15,11 +16,17 @@ template<typename NS>
 concept NodeStorage = requires (NS ns_mut,
                                 NS const ns,
                                 identifier::LiteralType const lit_type,
+                                identifier::RDFNodeType const node_type,
                                 view::BNodeBackendView const &bnode_view,
                                 view::LiteralBackendView const &lit_view,
                                 view::VariableBackendView const &var_view,
                                 view::IRIBackendView const &iri_view,
-                                identifier::NodeBackendID const node_id) {
+                                identifier::NodeBackendID const node_id,
+                                std::span<view::BNodeBackendView const> bnode_views,
+                                std::span<view::LiteralBackendView const> lit_views,
+                                std::span<view::VariableBackendView const> var_views,
+                                std::span<view::IRIBackendView const> iri_views,
+                                std::span<identifier::NodeBackendID> ids_out) {
     /**
      * Backend for NodeStorage::has_specialized_storage_for(datatype)
      * @param datatype datatype of specialized storage to check for
@@ -27,6 +34,19 @@ concept NodeStorage = requires (NS ns_mut,
      */
     { ns.has_specialized_storage_for(lit_type) } -> std::convertible_to<bool>;
 
+    /**
+     * Backend for NodeStorage::has_lexically_ordered_ids(node_type)
+     * If this returns true, the order of the ids of (non-inlined) nodes of the given type that are stored in this implementation
+     * matches the lexical order of the nodes. I.e. ordering of these nodes can be decided by comparing their ids.
+     *      - IRI: the order of the IRI strings, except for the reserved datatype IRIs (see datatypes::registry::reserved_datatype_ids)
+     *      - BNode: the order of the blank node identifiers
+     *      - Literal: among literals in lexical storage with the same datatype, the order of their lexical forms
+     *
+     * @param node_type type of the nodes
+     * @return whether the ids for the given node type are assigned in lexical order
+     */
+    { ns.has_lexically_ordered_ids(node_type) } -> std::convertible_to<bool>;
+
     /**
       * Backend for NodeStorage::find_or_make_id(view::BNodeBackendView const &)
       * @param view Describes requested node. Can be expected to be valid.
@@ -55,6 +75,38 @@ concept NodeStorage = requires (NS ns_mut,
       */
     { ns_mut.find_or_make_id(var_view) } -> std::same_as<identifier::NodeBackendID>;
 
+    /**
+      * Batched version of find_or_make_id(view::BNodeBackendView const &).
+      * Implementations should use this to amortize per-call costs (e.g. locking) over the whole batch.
+      * @param views Describe the requested nodes. Can be expected to be valid.
+      * @param ids_out ids_out[i] is set to the identifier::NodeBackendID for views[i]. Must have the same size as views.
+      */
+    { ns_mut.find_or_make_ids(bnode_views, ids_out) } -> std::same_as<void>;
+
+    /**
+      * Batched version of find_or_make_id(view::IRIBackendView const &).
+      * Implementations should use this to amortize per-call costs (e.g. locking) over the whole batch.
+      * @param views Describe the requested nodes. Can be expected to be valid.
+      * @param ids_out ids_out[i] is set to the identifier::NodeBackendID for views[i]. Must have the same size as views.
+      */
+    { ns_mut.find_or_make_ids(iri_views, ids_out) } -> std::same_as<void>;
+
+    /**
+      * Batched version of find_or_make_id(view::LiteralBackendView const &).
+      * Implementations should use this to amortize per-call costs (e.g. locking) over the whole batch.
+      * @param views Describe the requested nodes. Can be expected to be valid.
+      * @param ids_out ids_out[i] is set to the identifier::NodeBackendID for views[i]. Must have the same size as views.
+      */
+    { ns_mut.find_or_make_ids(lit_views, ids_out) } -> std::same_as<void>;
+
+    /**
+      * Batched version of find_or_make_id(view::VariableBackendView const &).
+      * Implementations should use this to amortize per-call costs (e.g. locking) over the whole batch.
+      * @param views Describe the requested nodes. Can be expected to be valid.
+      * @param ids_out ids_out[i] is set to the identifier::NodeBackendID for views[i]. Must have the same size as views.
+      */
+    { ns_mut.find_or_make_ids(var_views, ids_out) } -> std::same_as<void>;
+
     /**
       * Backend for NodeStorage::find_id(view::BNodeBackendView const &) const
       * @param view Describes requested node. Can be expected to be valid.
@@ -117,12 +169,18 @@ concept NodeStorage = requires (NS ns_mut,
  */
 struct NodeStorageVTable {
     bool (*has_specialized_storage_for)(void const *self, identifier::LiteralType literal_type) noexcept;
+    bool (*has_lexically_ordered_ids)(void const *self, identifier::RDFNodeType node_type) noexcept;
 
     identifier::NodeBackendID (*find_or_make_iri_id)(void *self, view::IRIBackendView const &view);
     identifier::NodeBackendID (*find_or_make_bnode_id)(void *self, view::BNodeBackendView const &view);
     identifier::NodeBackendID (*find_or_make_literal_id)(void *self, view::LiteralBackendView const &view);
     identifier::NodeBackendID (*find_or_make_variable_id)(void *self, view::VariableBackendView const &view);
 
+    void (*find_or_make_iri_ids)(void *self, std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void (*find_or_make_bnode_ids)(void *self, std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void (*find_or_make_literal_ids)(void *self, std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void (*find_or_make_variable_ids)(void *self, std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+
     identifier::NodeBackendID (*find_iri_id)(void const *self, view::IRIBackendView const &view) noexcept;
     identifier::NodeBackendID (*find_bnode_id)(void const *self, view::BNodeBackendView const &view) noexcept;
     identifier::NodeBackendID (*find_literal_id)(void const *self, view::LiteralBackendView const &view) noexcept;
@@ -139,6 +197,9 @@ struct NodeStorageVTable {
             .has_specialized_storage_for = [](void const *self, identifier::LiteralType const lit_type) noexcept -> bool {
                 return static_cast<NS const *>(self)->has_specialized_storage_for(lit_type);
             },
+            .has_lexically_ordered_ids = [](void const *self, identifier::RDFNodeType const node_type) noexcept -> bool {
+                return static_cast<NS const *>(self)->has_lexically_ordered_ids(node_type);
+            },
             .find_or_make_iri_id = [](void *self, view::IRIBackendView const &view) -> identifier::NodeBackendID {
                 return static_cast<NS *>(self)->find_or_make_id(view);
             },
@@ -151,6 +212,18 @@ struct NodeStorageVTable {
             .find_or_make_variable_id = [](void *self, view::VariableBackendView const &view) -> identifier::NodeBackendID {
                 return static_cast<NS *>(self)->find_or_make_id(view);
             },
+            .find_or_make_iri_ids = [](void *self, std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+                static_cast<NS *>(self)->find_or_make_ids(views, ids_out);
+            },
+            .find_or_make_bnode_ids = [](void *self, std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+                static_cast<NS *>(self)->find_or_make_ids(views, ids_out);
+            },
+            .find_or_make_literal_ids = [](void *self, std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+                static_cast<NS *>(self)->find_or_make_ids(views, ids_out);
+            },
+            .find_or_make_variable_ids = [](void *self, std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+                static_cast<NS *>(self)->find_or_make_ids(views, ids_out);
+            },
             .find_iri_id = [](void const *self, view::IRIBackendView const &view) noexcept -> identifier::NodeBackendID {
                 return static_cast<NS const *>(self)->find_id(view);
             },
@@ -231,6 +304,10 @@ public:
         return vtable_->has_specialized_storage_for(backend_, literal_type);
     }
 
+    [[nodiscard]] bool has_lexically_ordered_ids(identifier::RDFNodeType node_type) const noexcept {
+        return vtable_->has_lexically_ordered_ids(backend_, node_type);
+    }
+
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::IRIBackendView const &view) {
         return vtable_->find_or_make_iri_id(backend_, view);
     }
@@ -247,6 +324,22 @@ public:
         return vtable_->find_or_make_variable_id(backend_, view);
     }
 
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+        vtable_->find_or_make_iri_ids(backend_, views, ids_out);
+    }
+
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+        vtable_->find_or_make_bnode_ids(backend_, views, ids_out);
+    }
+
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+        vtable_->find_or_make_literal_ids(backend_, views, ids_out);
+    }
+
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out) {
+        vtable_->find_or_make_variable_ids(backend_, views, ids_out);
+    }
+
     [[nodiscard]] identifier::NodeBackendID find_id(view::IRIBackendView const &view) const noexcept {
         return vtable_->find_iri_id(backend_, view);
     }
@@ -0,0 +1,150 @@
+#ifndef RDF4CPP_STORAGE_NODECODECS_HPP
+#define RDF4CPP_STORAGE_NODECODECS_HPP
+
+#include <rdf4cpp/storage/identifier/NodeBackendID.hpp>
+#include <rdf4cpp/storage/view/BNodeBackendView.hpp>
+#include <rdf4cpp/storage/view/IRIBackendView.hpp>
+#include <rdf4cpp/storage/view/LiteralBackendView.hpp>
+#include <rdf4cpp/storage/view/VariableBackendView.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+/**
+ * Codecs describe how the views of the different node types are laid out as contiguous bytes
+ * (e.g. inside of a persistent_node_storage::detail::PersistentDictionary)
+ * and how the ids of such a dictionary translate to identifier::NodeBackendIDs.
+ *
+ * A codec provides:
+ *      - view_type: the view type that is stored
+ *      - min_id: the first id that is dynamically assigned
+ *      - encoded_size(view): number of bytes needed to encode view
+ *      - encode(view, dst): writes the encoding of view to dst
+ *      - decode(src, size): reconstructs the view from its encoding
+ *      - to_backend_id(id, view) and from_backend_id(backend_id): translation between dictionary ids and NodeBackendIDs
+ *
+ * Any change to the encodings needs to be accompanied by an increase of POBR_VERSION, because they are persisted.
+ */
+namespace rdf4cpp::storage::detail {
+
+/**
+ * Codec for nodes that consist of a single string identifier (IRIs and blank nodes)
+ */
+template<typename View, identifier::RDFNodeType node_type, uint64_t min_id_>
+struct IdentifierCodec {
+    using view_type = View;
+    static constexpr uint64_t min_id = min_id_;
+
+    static size_t encoded_size(view_type const &view) noexcept {
+        return view.identifier.size();
+    }
+
+    static void encode(view_type const &view, char *dst) noexcept {
+        memcpy(dst, view.identifier.data(), view.identifier.size());
+    }
+
+    static view_type decode(char const *src, size_t const size) noexcept {
+        return view_type{.identifier = std::string_view{src, size}};
+    }
+
+    static identifier::NodeBackendID to_backend_id(uint64_t const id, [[maybe_unused]] view_type const &view) noexcept {
+        return identifier::NodeBackendID{identifier::NodeID{id}, node_type};
+    }
+
+    static uint64_t from_backend_id(identifier::NodeBackendID const id) noexcept {
+        return id.node_id().to_underlying();
+    }
+};
+
+using IRICodec = IdentifierCodec<view::IRIBackendView, identifier::RDFNodeType::IRI, identifier::NodeID::min_iri_id.to_underlying()>;
+using BNodeCodec = IdentifierCodec<view::BNodeBackendView, identifier::RDFNodeType::BNode, identifier::NodeID::min_bnode_id.to_underlying()>;
+
+/**
+ * Codec for variables
+ * Layout: [is_anonymous: 1 byte][name]
+ */
+struct VariableCodec {
+    using view_type = view::VariableBackendView;
+    static constexpr uint64_t min_id = identifier::NodeID::min_variable_id.to_underlying();
+
+    static size_t encoded_size(view_type const &view) noexcept {
+        return 1 + view.name.size();
+    }
+
+    static void encode(view_type const &view, char *dst) noexcept {
+        dst[0] = static_cast<char>(view.is_anonymous);
+        memcpy(dst + 1, view.name.data(), view.name.size());
+    }
+
+    static view_type decode(char const *src, size_t const size) noexcept {
+        return view_type{.name = std::string_view{src + 1, size - 1}, .is_anonymous = src[0] != 0};
+    }
+
+    static identifier::NodeBackendID to_backend_id(uint64_t const id, [[maybe_unused]] view_type const &view) noexcept {
+        return identifier::NodeBackendID{identifier::NodeID{id}, identifier::RDFNodeType::Variable};
+    }
+
+    static uint64_t from_backend_id(identifier::NodeBackendID const id) noexcept {
+        return id.node_id().to_underlying();
+    }
+};
+
+/**
+ * Codec for literals in lexical form
+ * Layout: [datatype_id: 8 bytes][needs_escape: 1 byte][language_tag size: 4 bytes][language_tag][lexical_form]
+ */
+struct LiteralCodec {
+    using view_type = view::LexicalFormLiteralBackendView;
+    static constexpr uint64_t min_id = identifier::NodeID::min_literal_id.to_underlying();
+
+private:
+    static constexpr size_t datatype_offset = 0;
+    static constexpr size_t needs_escape_offset = datatype_offset + sizeof(uint64_t);
+    static constexpr size_t language_tag_size_offset = needs_escape_offset + 1;
+    static constexpr size_t language_tag_offset = language_tag_size_offset + sizeof(uint32_t);
+
+public:
+    static size_t encoded_size(view_type const &view) noexcept {
+        return language_tag_offset + view.language_tag.size() + view.lexical_form.size();
+    }
+
+    static void encode(view_type const &view, char *dst) noexcept {
+        auto const datatype = view.datatype_id.to_underlying();
+        auto const language_tag_size = static_cast<uint32_t>(view.language_tag.size());
+
+        memcpy(dst + datatype_offset, &datatype, sizeof(datatype));
+        dst[needs_escape_offset] = static_cast<char>(view.needs_escape);
+        memcpy(dst + language_tag_size_offset, &language_tag_size, sizeof(language_tag_size));
+        memcpy(dst + language_tag_offset, view.language_tag.data(), view.language_tag.size());
+        memcpy(dst + language_tag_offset + view.language_tag.size(), view.lexical_form.data(), view.lexical_form.size());
+    }
+
+    static view_type decode(char const *src, size_t const size) noexcept {
+        identifier::NodeBackendID::underlying_type datatype;
+        uint32_t language_tag_size;
+
+        memcpy(&datatype, src + datatype_offset, sizeof(datatype));
+        memcpy(&language_tag_size, src + language_tag_size_offset, sizeof(language_tag_size));
+
+        auto const lexical_form_offset = language_tag_offset + language_tag_size;
+
+        return view_type{.datatype_id = identifier::NodeBackendID{datatype},
+                         .lexical_form = std::string_view{src + lexical_form_offset, size - lexical_form_offset},
+                         .language_tag = std::string_view{src + language_tag_offset, language_tag_size},
+                         .needs_escape = src[needs_escape_offset] != 0};
+    }
+
+    static identifier::NodeBackendID to_backend_id(uint64_t const id, view_type const &view) noexcept {
+        return identifier::NodeBackendID{identifier::NodeID{identifier::LiteralID{id}, identifier::iri_node_id_to_literal_type(view.datatype_id)},
+                                         identifier::RDFNodeType::Literal};
+    }
+
+    static uint64_t from_backend_id(identifier::NodeBackendID const id) noexcept {
+        return id.node_id().literal_id().to_underlying();
+    }
+};
+
+}  // namespace rdf4cpp::storage::detail
+
+#endif  //RDF4CPP_STORAGE_NODECODECS_HPP
@@ -0,0 +1,162 @@
+#include "PersistentNodeStorage.hpp"
+
+#include <rdf4cpp/datatypes/registry/FixedIdMappings.hpp>
+
+#include <cassert>
+#include <stdexcept>
+
+namespace rdf4cpp::storage::persistent_node_storage {
+
+/**
+ * Creates directory if it does not exist
+ * @return directory
+ */
+static std::filesystem::path const &ensure_directory(std::filesystem::path const &directory) {
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+PersistentNodeStorage::PersistentNodeStorage(std::filesystem::path const &directory, size_t const max_file_size)
+    : bnode_storage_{ensure_directory(directory), "bnode", max_file_size},
+      iri_storage_{directory, "iri", max_file_size},
+      variable_storage_{directory, "variable", max_file_size},
+      literal_storage_{directory, "literal", max_file_size} {
+
+    // some iri's like xsd:string are there by default
+    for (auto const &[iri, literal_type] : datatypes::registry::reserved_datatype_ids) {
+        iri_storage_.insert_reserved(view::IRIBackendView{.identifier = iri}, literal_type.to_underlying());
+    }
+}
+
+size_t PersistentNodeStorage::size() const noexcept {
+    return bnode_storage_.size()
+           + iri_storage_.size()
+           + variable_storage_.size()
+           + literal_storage_.size();
+}
+
+void PersistentNodeStorage::sync() const {
+    bnode_storage_.sync();
+    iri_storage_.sync();
+    variable_storage_.sync();
+    literal_storage_.sync();
+}
+
+bool PersistentNodeStorage::has_specialized_storage_for([[maybe_unused]] identifier::LiteralType const datatype) noexcept {
+    return false;
+}
+
+bool PersistentNodeStorage::has_lexically_ordered_ids([[maybe_unused]] identifier::RDFNodeType const node_type) noexcept {
+    return false;
+}
+
+template<typename Codec>
+static identifier::NodeBackendID lookup_or_insert_impl(detail::PersistentDictionary<Codec> &storage, typename Codec::view_type const &view) {
+    return Codec::to_backend_id(storage.lookup_or_insert(view), view);
+}
+
+template<typename Codec>
+static identifier::NodeBackendID lookup_impl(detail::PersistentDictionary<Codec> const &storage, typename Codec::view_type const &view) noexcept {
+    if (auto const id = storage.lookup(view); id != 0) {
+        return Codec::to_backend_id(id, view);
+    }
+
+    return identifier::NodeBackendID{};
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_or_make_id(view::BNodeBackendView const &view) {
+    return lookup_or_insert_impl(bnode_storage_, view);
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_or_make_id(view::IRIBackendView const &view) {
+    return lookup_or_insert_impl(iri_storage_, view);
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_or_make_id(view::LiteralBackendView const &view) {
+    if (!view.is_lexical()) [[unlikely]] {
+        // cannot happen when going through Literal, because has_specialized_storage_for is always false
+        throw std::invalid_argument{"PersistentNodeStorage can only store literals in lexical form"};
+    }
+
+    return lookup_or_insert_impl(literal_storage_, view.get_lexical());
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_or_make_id(view::VariableBackendView const &view) {
+    return lookup_or_insert_impl(variable_storage_, view);
+}
+
+void PersistentNodeStorage::find_or_make_ids(std::span<view::BNodeBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+void PersistentNodeStorage::find_or_make_ids(std::span<view::IRIBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+void PersistentNodeStorage::find_or_make_ids(std::span<view::LiteralBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+void PersistentNodeStorage::find_or_make_ids(std::span<view::VariableBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_id(view::BNodeBackendView const &view) const noexcept {
+    return lookup_impl(bnode_storage_, view);
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_id(view::IRIBackendView const &view) const noexcept {
+    return lookup_impl(iri_storage_, view);
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_id(view::LiteralBackendView const &view) const noexcept {
+    if (!view.is_lexical()) [[unlikely]] {
+        return identifier::NodeBackendID{};
+    }
+
+    return lookup_impl(literal_storage_, view.get_lexical());
+}
+
+identifier::NodeBackendID PersistentNodeStorage::find_id(view::VariableBackendView const &view) const noexcept {
+    return lookup_impl(variable_storage_, view);
+}
+
+template<typename Codec>
+static typename Codec::view_type find_backend_view(detail::PersistentDictionary<Codec> const &storage, identifier::NodeBackendID const id) noexcept {
+    if (auto view = storage.lookup_value(Codec::from_backend_id(id)); view.has_value()) {
+        return *view;
+    } else {
+        assert(false); // assert in debug build; not critical error but should not happen
+        return typename Codec::view_type{};
+    }
+}
+
+view::IRIBackendView PersistentNodeStorage::find_iri_backend(identifier::NodeBackendID const id) const noexcept {
+    return find_backend_view(iri_storage_, id);
+}
+
+view::LiteralBackendView PersistentNodeStorage::find_literal_backend(identifier::NodeBackendID const id) const noexcept {
+    return find_backend_view(literal_storage_, id);
+}
+
+view::BNodeBackendView PersistentNodeStorage::find_bnode_backend(identifier::NodeBackendID const id) const noexcept {
+    return find_backend_view(bnode_storage_, id);
+}
+
+view::VariableBackendView PersistentNodeStorage::find_variable_backend(identifier::NodeBackendID const id) const noexcept {
+    return find_backend_view(variable_storage_, id);
+}
+
+}  // namespace rdf4cpp::storage::persistent_node_storage
@@ -0,0 +1,82 @@
+#ifndef RDF4CPP_PERSISTENTNODESTORAGE_HPP
+#define RDF4CPP_PERSISTENTNODESTORAGE_HPP
+
+#include <rdf4cpp/storage/NodeStorage.hpp>
+#include <rdf4cpp/storage/detail/NodeCodecs.hpp>
+#include <rdf4cpp/storage/persistent_node_storage/detail/PersistentDictionary.hpp>
+
+#include <filesystem>
+
+namespace rdf4cpp::storage::persistent_node_storage {
+
+/**
+ * Thread-safe NodeStorage whose contents are persisted in memory mapped files inside of a directory.
+ *
+ * Opening an existing directory does not need to rebuild anything, i.e. it is fast and
+ * all NodeBackendIDs that were handed out before are still valid and refer to the same nodes.
+ * New nodes can be added while the storage is open, they are persisted as well.
+ *
+ * The on-disk layout is versioned using rdf4cpp::pobr_version, opening files written with a different version fails.
+ * The same holds for the hash function of the persisted hashes (see detail::persistent_hash_id).
+ * Changes are written back by the operating system, call sync() to force them to disk.
+ *
+ * Limitations:
+ *      - nodes cannot be erased
+ *      - there are no specialized literal storages, all literals are stored in lexical form
+ */
+struct PersistentNodeStorage {
+    static constexpr size_t default_max_file_size = size_t{1} << 36;
+
+private:
+    detail::PersistentDictionary<storage::detail::BNodeCodec> bnode_storage_;
+    detail::PersistentDictionary<storage::detail::IRICodec> iri_storage_;
+    detail::PersistentDictionary<storage::detail::VariableCodec> variable_storage_;
+    detail::PersistentDictionary<storage::detail::LiteralCodec> literal_storage_;
+
+public:
+    /**
+     * Opens the persistent node storage in the given directory.
+     * If the directory (or the files inside of it) do not exist, a new (empty) node storage is created.
+     *
+     * @param directory directory that contains the files of the node storage
+     * @param max_file_size maximum size of each of the files in the directory. This much address space is reserved for each file.
+     * @throws std::runtime_error if the directory contains files that were written by an incompatible version
+     * @throws std::system_error if the files cannot be created, opened or mapped
+     */
+    explicit PersistentNodeStorage(std::filesystem::path const &directory, size_t max_file_size = default_max_file_size);
+
+    [[nodiscard]] size_t size() const noexcept;
+
+    /**
+     * Flushes all changes to disk
+     */
+    void sync() const;
+
+    [[nodiscard]] static bool has_specialized_storage_for(identifier::LiteralType datatype) noexcept;
+    [[nodiscard]] static bool has_lexically_ordered_ids(identifier::RDFNodeType node_type) noexcept;
+
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::BNodeBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::IRIBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::LiteralBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::VariableBackendView const &view);
+
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+
+    [[nodiscard]] identifier::NodeBackendID find_id(view::BNodeBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::IRIBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::LiteralBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::VariableBackendView const &view) const noexcept;
+
+    [[nodiscard]] view::IRIBackendView find_iri_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::LiteralBackendView find_literal_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::BNodeBackendView find_bnode_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::VariableBackendView find_variable_backend(identifier::NodeBackendID id) const noexcept;
+};
+static_assert(NodeStorage<PersistentNodeStorage>);
+
+}  // namespace rdf4cpp::storage::persistent_node_storage
+
+#endif  //RDF4CPP_PERSISTENTNODESTORAGE_HPP
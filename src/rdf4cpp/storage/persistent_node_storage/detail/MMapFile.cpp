@@ -0,0 +1,84 @@
+#include "MMapFile.hpp"
+
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rdf4cpp::storage::persistent_node_storage::detail {
+
+[[noreturn]] static void throw_errno(int const error, char const *what) {
+    throw std::system_error{error, std::generic_category(), what};
+}
+
+[[noreturn]] static void throw_errno(char const *what) {
+    throw_errno(errno, what);
+}
+
+/**
+ * Closes fd and throws the error of the failed call, which has to be saved first because close might overwrite errno
+ */
+[[noreturn]] static void close_and_throw_errno(int const fd, char const *what) {
+    auto const error = errno;
+    ::close(fd);
+    throw_errno(error, what);
+}
+
+MMapFile::MMapFile(std::filesystem::path const &path, size_t const max_size) : max_size_{max_size} {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw_errno("unable to open file");
+    }
+
+    struct stat st{};
+    if (::fstat(fd_, &st) != 0) {
+        close_and_throw_errno(fd_, "unable to stat file");
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > max_size_) {
+        ::close(fd_);
+        throw std::length_error{"file is bigger than the maximum size"};
+    }
+
+    // MAP_NORESERVE: the mapping is only an address space reservation, the file itself determines how much memory is used
+    auto *mapping = ::mmap(nullptr, max_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        close_and_throw_errno(fd_, "unable to map file");
+    }
+
+    data_ = static_cast<char *>(mapping);
+}
+
+MMapFile::~MMapFile() {
+    ::munmap(data_, max_size_);
+    ::close(fd_);
+}
+
+void MMapFile::grow(size_t const new_size) {
+    if (new_size <= size_) {
+        return;
+    }
+
+    if (new_size > max_size_) {
+        throw std::length_error{"file would grow beyond its maximum size"};
+    }
+
+    if (::ftruncate(fd_, static_cast<off_t>(new_size)) != 0) {
+        throw_errno("unable to resize file");
+    }
+
+    size_ = new_size;
+}
+
+void MMapFile::sync() const {
+    if (::msync(data_, size_, MS_SYNC) != 0) {
+        throw_errno("unable to flush file");
+    }
+}
+
+}  // namespace rdf4cpp::storage::persistent_node_storage::detail
@@ -0,0 +1,74 @@
+#ifndef RDF4CPP_PERSISTENTNODESTORAGE_MMAPFILE_HPP
+#define RDF4CPP_PERSISTENTNODESTORAGE_MMAPFILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+
+namespace rdf4cpp::storage::persistent_node_storage::detail {
+
+/**
+ * A file that is memory mapped for reading and writing.
+ *
+ * The mapping always spans max_size bytes, independent of the current size of the file.
+ * Therefore, growing the file (see grow()) never changes the address of its contents
+ * and pointers into the file stay valid for the whole lifetime of the MMapFile.
+ * Only the first size() bytes may be accessed.
+ */
+struct MMapFile {
+private:
+    int fd_;
+    char *data_;
+    size_t size_;     //< current size of the file
+    size_t max_size_; //< size of the mapping
+
+public:
+    /**
+     * Opens (or creates if it does not exist) the file at path and maps it into memory
+     *
+     * @param path path to the file
+     * @param max_size maximum size the file can grow to
+     * @throws std::system_error if the file cannot be opened or mapped
+     * @throws std::length_error if the existing file is bigger than max_size
+     */
+    MMapFile(std::filesystem::path const &path, size_t max_size);
+
+    // deleted because pointers into the mapping are handed out
+    MMapFile(MMapFile const &) = delete;
+    MMapFile(MMapFile &&) = delete;
+    MMapFile &operator=(MMapFile const &) = delete;
+    MMapFile &operator=(MMapFile &&) = delete;
+
+    ~MMapFile();
+
+    [[nodiscard]] char *data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] size_t max_size() const noexcept {
+        return max_size_;
+    }
+
+    /**
+     * Grows the file to new_size bytes. The new bytes are zero.
+     * Does nothing if the file is already at least new_size bytes big.
+     *
+     * @throws std::length_error if new_size is bigger than max_size()
+     * @throws std::system_error if the file cannot be resized
+     */
+    void grow(size_t new_size);
+
+    /**
+     * Flushes all changes to disk
+     *
+     * @throws std::system_error if flushing fails
+     */
+    void sync() const;
+};
+
+}  // namespace rdf4cpp::storage::persistent_node_storage::detail
+
+#endif  //RDF4CPP_PERSISTENTNODESTORAGE_MMAPFILE_HPP
@@ -0,0 +1,346 @@
+#ifndef RDF4CPP_PERSISTENTNODESTORAGE_PERSISTENTDICTIONARY_HPP
+#define RDF4CPP_PERSISTENTNODESTORAGE_PERSISTENTDICTIONARY_HPP
+
+#include <rdf4cpp/storage/persistent_node_storage/detail/MMapFile.hpp>
+#include <rdf4cpp/storage/persistent_node_storage/detail/PersistentHash.hpp>
+#include <rdf4cpp/version.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+
+namespace rdf4cpp::storage::persistent_node_storage::detail {
+
+/**
+ * A bidirectional mapping between ids and (views of) values that lives in three memory mapped files.
+ *
+ *  - <name>.records: the encoded values, appended one after another, every one of them prefixed with its size (4 bytes)
+ *  - <name>.ids: an array of {offset into records, hash} indexed by id
+ *  - <name>.hash: an open-addressing (linear probing) hash table of {hash, id}
+ *
+ * Every file starts with a file_header that contains the pobr_version it was written with
+ * and the id of the hash function that the stored hashes were computed with (see persistent_hash).
+ * Values cannot be erased, ids are assigned consecutively starting at Codec::min_id.
+ *
+ * Thread-safety:
+ *      - lookup and insertion are synchronized using an internal shared mutex
+ *      - lookup_value() does not need any synchronization, because the files are mapped in a way that their contents never move
+ *
+ * @tparam Codec describes the layout of the values (see storage/detail/NodeCodecs.hpp)
+ */
+template<typename Codec>
+struct PersistentDictionary {
+    using view_type = typename Codec::view_type;
+    using id_type = uint64_t;
+
+private:
+    static constexpr std::array<char, 8> magic{'r', 'd', 'f', '4', 'c', 'p', 'p', 'D'};
+
+    enum struct FileKind : uint32_t {
+        Records = 0,
+        Ids = 1,
+        Hash = 2,
+    };
+
+    struct alignas(8) file_header {
+        std::array<char, 8> magic;
+        uint32_t pobr_version;
+        FileKind kind;
+        uint64_t size;     //< Records: bytes used (including header), Ids: number of id slots, Hash: number of stored elements
+        uint64_t capacity; //< Hash: number of slots, unused otherwise
+        uint32_t hash_function; //< persistent_hash_id of the hash function used for the stored hashes
+        uint32_t reserved;
+    };
+
+    struct id_entry {
+        uint64_t offset; //< offset of the record in the records file, 0 means no value is stored for this id
+        uint64_t hash;   //< persistent_hash of the value
+    };
+
+    struct hash_slot {
+        uint64_t hash;
+        id_type id; //< 0 means the slot is empty
+    };
+
+    using record_size_type = uint32_t;
+
+    static constexpr size_t min_file_size = 1 << 16;
+    static constexpr size_t initial_hash_capacity = 1 << 10;
+
+    MMapFile records_;
+    MMapFile ids_;
+    MMapFile hash_;
+    std::shared_mutex mutable mutex_;
+
+    [[nodiscard]] static file_header &header_of(MMapFile const &file) noexcept {
+        return *reinterpret_cast<file_header *>(file.data());
+    }
+
+    [[nodiscard]] id_entry *id_entries() const noexcept {
+        return reinterpret_cast<id_entry *>(ids_.data() + sizeof(file_header));
+    }
+
+    [[nodiscard]] hash_slot *hash_slots() const noexcept {
+        return reinterpret_cast<hash_slot *>(hash_.data() + sizeof(file_header));
+    }
+
+    /**
+     * Grows file such that it is at least min_size bytes big.
+     * Grows exponentially to amortize the cost of resizing.
+     */
+    static void grow_to_fit(MMapFile &file, size_t const min_size) {
+        if (min_size <= file.size()) {
+            return;
+        }
+
+        file.grow(std::min(std::max({min_size, file.size() * 2, min_file_size}), std::max(min_size, file.max_size())));
+    }
+
+    /**
+     * Initializes the header of a freshly created file or validates the header of an existing file
+     */
+    static void init_or_validate(MMapFile &file, FileKind const kind, uint64_t const initial_size, uint64_t const initial_capacity, size_t const initial_file_size) {
+        if (file.size() == 0) {
+            grow_to_fit(file, initial_file_size);
+            header_of(file) = file_header{.magic = magic,
+                                          .pobr_version = static_cast<uint32_t>(pobr_version),
+                                          .kind = kind,
+                                          .size = initial_size,
+                                          .capacity = initial_capacity,
+                                          .hash_function = persistent_hash_id,
+                                          .reserved = 0};
+            return;
+        }
+
+        if (file.size() < sizeof(file_header)) {
+            throw std::runtime_error{"persistent node storage file is corrupted"};
+        }
+
+        auto const &header = header_of(file);
+        if (header.magic != magic || header.kind != kind) {
+            throw std::runtime_error{"file is not a persistent node storage file"};
+        }
+
+        if (header.pobr_version != static_cast<uint32_t>(pobr_version)) {
+            throw std::runtime_error{"persistent node storage file was written with incompatible persisted object binary representation version "
+                                     + std::to_string(header.pobr_version) + " (expected " + std::to_string(pobr_version) + ")"};
+        }
+
+        if (header.hash_function != persistent_hash_id) {
+            throw std::runtime_error{"persistent node storage file was written with incompatible hash function "
+                                     + std::to_string(header.hash_function) + " (expected " + std::to_string(persistent_hash_id) + ")"};
+        }
+    }
+
+    /**
+     * Places (hash, id) into the hash table.
+     * @precondition there is at least one free slot
+     */
+    void hash_place(uint64_t const hash, id_type const id) noexcept {
+        auto const mask = header_of(hash_).capacity - 1;
+        auto *slots = hash_slots();
+
+        for (auto ix = hash & mask;; ix = (ix + 1) & mask) {
+            if (slots[ix].id == 0) {
+                slots[ix] = hash_slot{.hash = hash, .id = id};
+                return;
+            }
+        }
+    }
+
+    /**
+     * Doubles the capacity of the hash table and reinserts all ids
+     */
+    void hash_grow() {
+        auto &header = header_of(hash_);
+        auto const new_capacity = header.capacity * 2;
+
+        grow_to_fit(hash_, sizeof(file_header) + new_capacity * sizeof(hash_slot));
+        header.capacity = new_capacity;
+        memset(hash_slots(), 0, new_capacity * sizeof(hash_slot));
+
+        auto const *entries = id_entries();
+        for (id_type id = 1; id < header_of(ids_).size; ++id) {
+            if (entries[id].offset != 0) {
+                hash_place(entries[id].hash, id);
+            }
+        }
+    }
+
+    [[nodiscard]] view_type value_at(uint64_t const offset) const noexcept {
+        record_size_type size;
+        memcpy(&size, records_.data() + offset, sizeof(size));
+        return Codec::decode(records_.data() + offset + sizeof(size), size);
+    }
+
+    [[nodiscard]] id_type lookup_id_unsync(view_type const &view, uint64_t const hash) const noexcept {
+        auto const mask = header_of(hash_).capacity - 1;
+        auto const *slots = hash_slots();
+        auto const *entries = id_entries();
+
+        for (auto ix = hash & mask;; ix = (ix + 1) & mask) {
+            auto const &slot = slots[ix];
+            if (slot.id == 0) {
+                return 0;
+            }
+
+            if (slot.hash == hash && value_at(entries[slot.id].offset) == view) {
+                return slot.id;
+            }
+        }
+    }
+
+    /**
+     * Appends the encoding of view to the records file and stores it at the given id
+     */
+    void store_at(view_type const &view, uint64_t const hash, id_type const id) {
+        auto const payload_size = Codec::encoded_size(view);
+        if (payload_size > std::numeric_limits<record_size_type>::max()) [[unlikely]] {
+            throw std::length_error{"value is too large to be stored in a persistent node storage"};
+        }
+
+        if ((header_of(hash_).size + 1) * 2 > header_of(hash_).capacity) {
+            hash_grow();
+        }
+
+        auto &records_header = header_of(records_);
+        auto const offset = records_header.size;
+        auto const record_size = static_cast<record_size_type>(payload_size);
+
+        grow_to_fit(records_, offset + sizeof(record_size) + payload_size);
+        memcpy(records_.data() + offset, &record_size, sizeof(record_size));
+        Codec::encode(view, records_.data() + offset + sizeof(record_size));
+        records_header.size = offset + sizeof(record_size) + payload_size;
+
+        auto &ids_header = header_of(ids_);
+        auto const new_ids_size = std::max(ids_header.size, id + 1);
+        grow_to_fit(ids_, sizeof(file_header) + new_ids_size * sizeof(id_entry));
+        id_entries()[id] = id_entry{.offset = offset, .hash = hash};
+
+        // publish the entry to lookup_value
+        std::atomic_ref{ids_header.size}.store(new_ids_size, std::memory_order_release);
+
+        hash_place(hash, id);
+        ++header_of(hash_).size;
+    }
+
+public:
+    /**
+     * Opens (or creates) the dictionary with the given name in directory
+     *
+     * @param directory directory the files are placed in
+     * @param name name of the dictionary, used as prefix for the file names
+     * @param max_file_size maximum size of each of the files
+     * @throws std::runtime_error if the files exist but were not written by a compatible version
+     * @throws std::system_error if the files cannot be opened
+     */
+    PersistentDictionary(std::filesystem::path const &directory, std::string const &name, size_t const max_file_size)
+        : records_{directory / (name + ".records"), max_file_size},
+          ids_{directory / (name + ".ids"), max_file_size},
+          hash_{directory / (name + ".hash"), max_file_size} {
+
+        init_or_validate(records_, FileKind::Records, sizeof(file_header), 0, min_file_size);
+        init_or_validate(ids_, FileKind::Ids, Codec::min_id, 0, sizeof(file_header) + Codec::min_id * sizeof(id_entry));
+        init_or_validate(hash_, FileKind::Hash, 0, initial_hash_capacity, sizeof(file_header) + initial_hash_capacity * sizeof(hash_slot));
+    }
+
+    /**
+     * Synchronized lookup of the id of a value
+     * @return id of the value or 0 if it is not present
+     */
+    [[nodiscard]] id_type lookup(view_type const &view) const noexcept {
+        std::shared_lock lock{mutex_};
+        return lookup_id_unsync(view, persistent_hash<Codec>(view));
+    }
+
+    /**
+     * Synchronized lookup and creation of the id of a value
+     * @return id of the looked up or newly created value
+     */
+    [[nodiscard]] id_type lookup_or_insert(view_type const &view) {
+        auto const hash = persistent_hash<Codec>(view);
+
+        {
+            std::shared_lock lock{mutex_};
+            if (auto const id = lookup_id_unsync(view, hash); id != 0) {
+                return id;
+            }
+        }
+
+        std::unique_lock lock{mutex_};
+
+        // check again, might have changed between unlocking of shared_lock and locking of unique_lock
+        if (auto const id = lookup_id_unsync(view, hash); id != 0) {
+            return id;
+        }
+
+        auto const id = header_of(ids_).size;
+        store_at(view, hash, id);
+        return id;
+    }
+
+    /**
+     * Stores view at a reserved id (i.e. an id below Codec::min_id) if there is not already a value for it
+     */
+    void insert_reserved(view_type const &view, id_type const id) {
+        assert(id < Codec::min_id);
+
+        std::unique_lock lock{mutex_};
+        if (id_entries()[id].offset != 0) {
+            return;
+        }
+
+        store_at(view, persistent_hash<Codec>(view), id);
+    }
+
+    /**
+     * Look up the value for the given id.
+     * Does not need to be synchronized.
+     *
+     * @return view of the value if it was found, otherwise nullopt
+     */
+    [[nodiscard]] std::optional<view_type> lookup_value(id_type const id) const noexcept {
+        if (id == 0 || id >= std::atomic_ref{header_of(ids_).size}.load(std::memory_order_acquire)) [[unlikely]] {
+            return std::nullopt;
+        }
+
+        auto const offset = id_entries()[id].offset;
+        if (offset == 0) {
+            return std::nullopt;
+        }
+
+        return value_at(offset);
+    }
+
+    /**
+     * Number of values stored in this dictionary
+     */
+    [[nodiscard]] size_t size() const noexcept {
+        std::shared_lock lock{mutex_};
+        return header_of(hash_).size;
+    }
+
+    /**
+     * Flushes all changes to disk
+     */
+    void sync() const {
+        std::shared_lock lock{mutex_};
+        records_.sync();
+        ids_.sync();
+        hash_.sync();
+    }
+};
+
+}  // namespace rdf4cpp::storage::persistent_node_storage::detail
+
+#endif  //RDF4CPP_PERSISTENTNODESTORAGE_PERSISTENTDICTIONARY_HPP
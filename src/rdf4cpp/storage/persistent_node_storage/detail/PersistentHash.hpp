@@ -0,0 +1,73 @@
+#ifndef RDF4CPP_PERSISTENTNODESTORAGE_PERSISTENTHASH_HPP
+#define RDF4CPP_PERSISTENTNODESTORAGE_PERSISTENTHASH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace rdf4cpp::storage::persistent_node_storage::detail {
+
+/**
+ * Identifies the hash function implemented by persistent_hash.
+ * It is stored in the headers of the files of a PersistentDictionary, because the hashes are persisted.
+ *
+ * @warning persistent_hash must never produce different values for the same input unless this id is changed as well,
+ *      otherwise lookups in existing files silently fail
+ */
+inline constexpr uint32_t persistent_hash_id = 1;
+
+/**
+ * Hash of a sequence of bytes that is owned and pinned by rdf4cpp (unlike e.g. dice::hash whose values might change between versions).
+ * Words are read in native byte order, like all other persisted data.
+ */
+inline uint64_t persistent_hash(char const *data, size_t size) noexcept {
+    static constexpr uint64_t mul = 0x9e3779b97f4a7c15;
+
+    auto const mix = [](uint64_t h) noexcept {
+        // splitmix64 finalizer
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111eb;
+        return h ^ (h >> 31);
+    };
+
+    uint64_t h = 0x243f6a8885a308d3 ^ (static_cast<uint64_t>(size) * mul);
+
+    for (; size >= sizeof(uint64_t); data += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        h = mix(h ^ word) * mul;
+    }
+
+    if (size > 0) {
+        uint64_t word = 0;
+        memcpy(&word, data, size);
+        h = mix(h ^ word) * mul;
+    }
+
+    return mix(h);
+}
+
+/**
+ * persistent_hash of the encoding of view (see storage/detail/NodeCodecs.hpp)
+ */
+template<typename Codec>
+uint64_t persistent_hash(typename Codec::view_type const &view) noexcept {
+    static constexpr size_t small_size = 256;
+
+    auto const size = Codec::encoded_size(view);
+    if (size <= small_size) {
+        std::array<char, small_size> buf;
+        Codec::encode(view, buf.data());
+        return persistent_hash(buf.data(), size);
+    }
+
+    std::vector<char> buf(size);
+    Codec::encode(view, buf.data());
+    return persistent_hash(buf.data(), size);
+}
+
+}  // namespace rdf4cpp::storage::persistent_node_storage::detail
+
+#endif  //RDF4CPP_PERSISTENTNODESTORAGE_PERSISTENTHASH_HPP
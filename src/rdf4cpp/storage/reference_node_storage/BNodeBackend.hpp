@@ -3,7 +3,7 @@
 
 #include <rdf4cpp/storage/view/BNodeBackendView.hpp>
 #include <rdf4cpp/storage/identifier/NodeBackendID.hpp>
-#include <rdf4cpp/storage/reference_node_storage/detail/ConstString.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/StringArena.hpp>
 
 namespace rdf4cpp::storage::reference_node_storage {
 
@@ -11,11 +11,13 @@ struct BNodeBackend {
     using view_type = view::BNodeBackendView;
     using id_type = identifier::NodeID;
 
+    using allocator_type = detail::ArenaAllocator<char>;
+
     size_t hash;
-    detail::ConstString identifier;
+    detail::ArenaString identifier;
 
-    explicit BNodeBackend(view_type const &view) noexcept : hash{view.hash()},
-                                                            identifier{view.identifier} {
+    BNodeBackend(view_type const &view, allocator_type const &alloc) : hash{view.hash()},
+                                                                       identifier{view.identifier, alloc.arena()} {
     }
 
     explicit operator view_type() const noexcept {
@@ -3,7 +3,7 @@
 
 #include <rdf4cpp/storage/identifier/NodeID.hpp>
 #include <rdf4cpp/storage/view/LiteralBackendView.hpp>
-#include <rdf4cpp/storage/reference_node_storage/detail/ConstString.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/StringArena.hpp>
 
 namespace rdf4cpp::storage::reference_node_storage {
 
@@ -11,17 +11,19 @@ struct FallbackLiteralBackend {
     using view_type = view::LexicalFormLiteralBackendView;
     using id_type = identifier::LiteralID;
 
+    using allocator_type = detail::ArenaAllocator<char>;
+
     size_t hash;
     identifier::NodeBackendID datatype_id;
-    detail::ConstString lexical_form;
-    detail::ConstString language_tag;
+    detail::ArenaString lexical_form;
+    detail::ArenaString language_tag;
     bool needs_escape;
 
-    explicit FallbackLiteralBackend(view_type const &view) noexcept : hash{view.hash()},
-                                                                      datatype_id{view.datatype_id},
-                                                                      lexical_form{view.lexical_form},
-                                                                      language_tag{view.language_tag},
-                                                                      needs_escape{view.needs_escape} {
+    FallbackLiteralBackend(view_type const &view, allocator_type const &alloc) : hash{view.hash()},
+                                                                                 datatype_id{view.datatype_id},
+                                                                                 lexical_form{view.lexical_form, alloc.arena()},
+                                                                                 language_tag{view.language_tag, alloc.arena()},
+                                                                                 needs_escape{view.needs_escape} {
     }
 
     explicit operator view_type() const noexcept {
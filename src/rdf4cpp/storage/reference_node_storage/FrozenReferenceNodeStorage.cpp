@@ -0,0 +1,199 @@
+#include "FrozenReferenceNodeStorage.hpp"
+
+#include <dice/template-library/tuple_algorithm.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/SpecializationDetail.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace rdf4cpp::storage::reference_node_storage {
+
+namespace {
+
+/**
+ * Translates the datatype ids of lexical literals from the ids of the original storage to the ids of the frozen storage.
+ * This is necessary because the ids of (non-reserved) datatype IRIs change if ids are assigned in lexical order.
+ */
+struct DatatypeIdRemapping {
+    std::vector<uint64_t> new_ids; //< new_ids[old_id] is the id in the frozen storage of the IRI that had id old_id, 0 if there is no such IRI
+
+    template<typename Mapping>
+    static DatatypeIdRemapping make(Mapping const &old_iri_mapping, detail::FrozenStringNodeTypeStorage<storage::detail::IRICodec> const &frozen_iri_storage) {
+        DatatypeIdRemapping remapping;
+        old_iri_mapping.for_each([&](auto const old_id, view::IRIBackendView const &view) {
+            auto const ix = static_cast<uint64_t>(old_id.to_underlying());
+            remapping.new_ids.resize(std::max(remapping.new_ids.size(), ix + 1), 0);
+            remapping.new_ids[ix] = frozen_iri_storage.lookup_id(view).node_id().to_underlying();
+        });
+        return remapping;
+    }
+
+    view::LexicalFormLiteralBackendView operator()(view::LexicalFormLiteralBackendView view) const noexcept {
+        auto const old_id = view.datatype_id.node_id().to_underlying();
+        if (old_id < new_ids.size() && new_ids[old_id] != 0) {
+            view.datatype_id = identifier::NodeBackendID{identifier::NodeID{new_ids[old_id]}, identifier::RDFNodeType::IRI};
+        }
+        return view;
+    }
+};
+
+}  // namespace
+
+template<typename ReferenceNodeStorage>
+FrozenReferenceNodeStorage::FrozenReferenceNodeStorage(ReferenceNodeStorage const &node_storage, IdAssignment const id_assignment, std::in_place_t)
+    : bnode_storage_{node_storage.bnode_storage_.mapping, id_assignment == IdAssignment::LexicalOrder},
+      iri_storage_{node_storage.iri_storage_.mapping, id_assignment == IdAssignment::LexicalOrder},
+      variable_storage_{node_storage.variable_storage_.mapping, false},
+      // iri_storage_ is initialized before, so the new ids of the datatype IRIs are already known
+      fallback_literal_storage_{node_storage.fallback_literal_storage_.mapping, id_assignment == IdAssignment::LexicalOrder,
+                                id_assignment == IdAssignment::LexicalOrder ? DatatypeIdRemapping::make(node_storage.iri_storage_.mapping, iri_storage_)
+                                                                            : DatatypeIdRemapping{}},
+      specialized_literal_storage_{std::apply([](auto const &...storages) {
+          return decltype(specialized_literal_storage_){storages.mapping...};
+      }, node_storage.specialized_literal_storage_)},
+      id_assignment_{id_assignment} {
+}
+
+FrozenReferenceNodeStorage::FrozenReferenceNodeStorage(UnsyncReferenceNodeStorage const &node_storage, IdAssignment const id_assignment)
+    : FrozenReferenceNodeStorage{node_storage, id_assignment, std::in_place} {
+}
+
+FrozenReferenceNodeStorage::FrozenReferenceNodeStorage(SyncReferenceNodeStorage const &node_storage, IdAssignment const id_assignment)
+    : FrozenReferenceNodeStorage{node_storage, id_assignment, std::in_place} {
+}
+
+size_t FrozenReferenceNodeStorage::size() const noexcept {
+    return iri_storage_.size() +
+           bnode_storage_.size() +
+           variable_storage_.size() +
+           fallback_literal_storage_.size() +
+           dice::template_library::tuple_fold(specialized_literal_storage_, 0, [](auto acc, auto const &storage) noexcept {
+               return acc + storage.size();
+           });
+}
+
+bool FrozenReferenceNodeStorage::has_specialized_storage_for(identifier::LiteralType const datatype) noexcept {
+    static constexpr auto specialization_lut = specialization_detail::make_storage_specialization_lut<decltype(specialized_literal_storage_)>();
+    return specialization_lut[datatype.to_underlying()];
+}
+
+bool FrozenReferenceNodeStorage::has_lexically_ordered_ids(identifier::RDFNodeType const node_type) const noexcept {
+    if (id_assignment_ != IdAssignment::LexicalOrder) {
+        return false;
+    }
+
+    switch (node_type) {
+        case identifier::RDFNodeType::IRI:
+        case identifier::RDFNodeType::BNode:
+        case identifier::RDFNodeType::Literal:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Returns id if it is not the null-id, otherwise throws because the frozen storage cannot create new nodes
+ */
+static identifier::NodeBackendID expect_present(identifier::NodeBackendID const id) {
+    if (id.null()) [[unlikely]] {
+        throw std::runtime_error{"FrozenReferenceNodeStorage is immutable, cannot create new nodes"};
+    }
+
+    return id;
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_or_make_id(view::BNodeBackendView const &view) {
+    return expect_present(find_id(view));
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_or_make_id(view::IRIBackendView const &view) {
+    return expect_present(find_id(view));
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_or_make_id(view::LiteralBackendView const &view) {
+    return expect_present(find_id(view));
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_or_make_id(view::VariableBackendView const &view) {
+    return expect_present(find_id(view));
+}
+
+void FrozenReferenceNodeStorage::find_or_make_ids(std::span<view::BNodeBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+void FrozenReferenceNodeStorage::find_or_make_ids(std::span<view::IRIBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+void FrozenReferenceNodeStorage::find_or_make_ids(std::span<view::LiteralBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+void FrozenReferenceNodeStorage::find_or_make_ids(std::span<view::VariableBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        ids_out[ix] = find_or_make_id(views[ix]);
+    }
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_id(view::BNodeBackendView const &view) const noexcept {
+    return bnode_storage_.lookup_id(view);
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_id(view::IRIBackendView const &view) const noexcept {
+    return iri_storage_.lookup_id(view);
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_id(view::LiteralBackendView const &view) const noexcept {
+    return view.visit(
+            [this](view::LexicalFormLiteralBackendView const &lexical) noexcept {
+                assert(!has_specialized_storage_for(identifier::iri_node_id_to_literal_type(lexical.datatype_id)));
+                return this->fallback_literal_storage_.lookup_id(lexical);
+            },
+            [this](view::ValueLiteralBackendView const &any) noexcept {
+                assert(has_specialized_storage_for(any.datatype));
+                return specialization_detail::visit_specialized(this->specialized_literal_storage_, any.datatype, [&any](auto const &storage) noexcept {
+                    return storage.lookup_id(any);
+                });
+            });
+}
+
+identifier::NodeBackendID FrozenReferenceNodeStorage::find_id(view::VariableBackendView const &view) const noexcept {
+    return variable_storage_.lookup_id(view);
+}
+
+view::IRIBackendView FrozenReferenceNodeStorage::find_iri_backend(identifier::NodeBackendID const id) const noexcept {
+    return iri_storage_.lookup_value(id);
+}
+
+view::LiteralBackendView FrozenReferenceNodeStorage::find_literal_backend(identifier::NodeBackendID const id) const noexcept {
+    if (id.node_id().literal_type().is_fixed() && has_specialized_storage_for(id.node_id().literal_type())) {
+        return specialization_detail::visit_specialized(specialized_literal_storage_, id.node_id().literal_type(), [id](auto const &storage) noexcept {
+            return view::LiteralBackendView{storage.lookup_value(id)};
+        });
+    }
+
+    return fallback_literal_storage_.lookup_value(id);
+}
+
+view::BNodeBackendView FrozenReferenceNodeStorage::find_bnode_backend(identifier::NodeBackendID const id) const noexcept {
+    return bnode_storage_.lookup_value(id);
+}
+
+view::VariableBackendView FrozenReferenceNodeStorage::find_variable_backend(identifier::NodeBackendID const id) const noexcept {
+    return variable_storage_.lookup_value(id);
+}
+
+}  // namespace rdf4cpp::storage::reference_node_storage
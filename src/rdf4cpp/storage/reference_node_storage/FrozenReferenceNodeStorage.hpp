@@ -0,0 +1,120 @@
+#ifndef RDF4CPP_FROZENREFERENCENODESTORAGE_HPP
+#define RDF4CPP_FROZENREFERENCENODESTORAGE_HPP
+
+#include <tuple>
+#include <utility>
+
+#include <rdf4cpp/storage/NodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SpecializedLiteralBackend.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/UnsyncReferenceNodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/FrozenNodeTypeStorage.hpp>
+
+namespace rdf4cpp::storage::reference_node_storage {
+
+/**
+ * Immutable, compacted snapshot of a SyncReferenceNodeStorage or UnsyncReferenceNodeStorage.
+ * Intended for workloads that load all data up front and afterwards only read.
+ *
+ * By default, all NodeBackendIDs of the original storage are preserved, so Nodes (and graphs) that were created
+ * using the original storage are valid in the frozen storage as well.
+ * Alternatively, ids can be reassigned in lexical order (see IdAssignment::LexicalOrder).
+ *
+ * Strings are stored in contiguous blobs with offset tables and values are found using minimal perfect hashing.
+ * Because nothing is ever modified, lookups do not need any synchronization, i.e. this storage is thread-safe without any locks.
+ *
+ * find_or_make_id only finds existing nodes, trying to create a new node throws std::runtime_error.
+ */
+struct FrozenReferenceNodeStorage {
+    /**
+     * Determines how ids are assigned when freezing a node storage
+     */
+    enum struct IdAssignment : bool {
+        /**
+         * All ids of the original storage are preserved
+         */
+        Preserve,
+        /**
+         * Ids of IRIs (except the reserved datatype IRIs), blank nodes and literals in lexical storage are reassigned
+         * in lexical order, see NodeStorage::has_lexically_ordered_ids.
+         * Nodes of the original storage need to be translated using Node::to_node_storage.
+         */
+        LexicalOrder,
+    };
+
+private:
+    detail::FrozenStringNodeTypeStorage<storage::detail::BNodeCodec> bnode_storage_;
+    detail::FrozenStringNodeTypeStorage<storage::detail::IRICodec> iri_storage_;
+    detail::FrozenStringNodeTypeStorage<storage::detail::VariableCodec> variable_storage_;
+
+    detail::FrozenStringNodeTypeStorage<storage::detail::LiteralCodec> fallback_literal_storage_;
+
+    std::tuple<detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Integer>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NonNegativeInteger>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::PositiveInteger>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NonPositiveInteger>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NegativeInteger>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Long>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::UnsignedLong>>,
+
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Decimal>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Double>>,
+
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Base64Binary>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::HexBinary>>,
+
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Date>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::DateTime>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::DateTimeStamp>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::GYearMonth>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Duration>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::DayTimeDuration>>,
+               detail::FrozenSpecializedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::YearMonthDuration>>> specialized_literal_storage_;
+
+    IdAssignment id_assignment_;
+
+    template<typename ReferenceNodeStorage>
+    FrozenReferenceNodeStorage(ReferenceNodeStorage const &node_storage, IdAssignment id_assignment, std::in_place_t);
+
+public:
+    /**
+     * Creates a frozen copy of node_storage
+     */
+    explicit FrozenReferenceNodeStorage(UnsyncReferenceNodeStorage const &node_storage, IdAssignment id_assignment = IdAssignment::Preserve);
+
+    /**
+     * Creates a frozen copy of node_storage
+     * @note node_storage must not be modified concurrently
+     */
+    explicit FrozenReferenceNodeStorage(SyncReferenceNodeStorage const &node_storage, IdAssignment id_assignment = IdAssignment::Preserve);
+
+    [[nodiscard]] size_t size() const noexcept;
+
+    [[nodiscard]] static bool has_specialized_storage_for(identifier::LiteralType datatype) noexcept;
+    [[nodiscard]] bool has_lexically_ordered_ids(identifier::RDFNodeType node_type) const noexcept;
+
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::BNodeBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::IRIBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::LiteralBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::VariableBackendView const &view);
+
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+
+    [[nodiscard]] identifier::NodeBackendID find_id(view::BNodeBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::IRIBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::LiteralBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::VariableBackendView const &view) const noexcept;
+
+    [[nodiscard]] view::IRIBackendView find_iri_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::LiteralBackendView find_literal_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::BNodeBackendView find_bnode_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::VariableBackendView find_variable_backend(identifier::NodeBackendID id) const noexcept;
+};
+static_assert(NodeStorage<FrozenReferenceNodeStorage>);
+
+}  // namespace rdf4cpp::storage::reference_node_storage
+
+#endif  //RDF4CPP_FROZENREFERENCENODESTORAGE_HPP
@@ -2,7 +2,7 @@
 #define RDF4CPP_IRIBACKEND_HPP
 
 #include <rdf4cpp/storage/view/IRIBackendView.hpp>
-#include <rdf4cpp/storage/reference_node_storage/detail/ConstString.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/StringArena.hpp>
 
 namespace rdf4cpp::storage::reference_node_storage {
 
@@ -10,11 +10,13 @@ struct IRIBackend {
     using view_type = view::IRIBackendView;
     using id_type = identifier::NodeID;
 
+    using allocator_type = detail::ArenaAllocator<char>;
+
     size_t hash;
-    detail::ConstString identifier;
+    detail::ArenaString identifier;
 
-    explicit IRIBackend(view_type const &view) noexcept : hash{view.hash()},
-                                                          identifier{view.identifier} {
+    IRIBackend(view_type const &view, allocator_type const &alloc) : hash{view.hash()},
+                                                                     identifier{view.identifier, alloc.arena()} {
     }
 
     explicit operator view_type() const noexcept {
@@ -0,0 +1,268 @@
+#include "ShardedReferenceNodeStorage.hpp"
+
+#include <dice/template-library/tuple_algorithm.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/SpecializationDetail.hpp>
+
+#include <bit>
+#include <stdexcept>
+
+namespace rdf4cpp::storage::reference_node_storage {
+
+/**
+ * Constructs the tuple of specialized literal storages, every one of them with the given number of shards
+ */
+template<typename Tuple, size_t ...Ixs>
+static Tuple make_specialized_literal_storage(size_t const shard_count, std::index_sequence<Ixs...>) {
+    return Tuple{std::tuple_element_t<Ixs, Tuple>{shard_count, identifier::NodeID::min_literal_id}...};
+}
+
+/**
+ * Checks that the given shard count is valid for ShardedNodeTypeStorage
+ * @throws std::invalid_argument if it is not
+ */
+static size_t validate_shard_count(size_t const shard_count) {
+    if (!std::has_single_bit(shard_count) || shard_count > ShardedNodeTypeStorage<IRIBackend>::max_shard_count) {
+        throw std::invalid_argument{"shard_count must be a power of two and at most 256"};
+    }
+
+    return shard_count;
+}
+
+ShardedReferenceNodeStorage::ShardedReferenceNodeStorage(size_t const shard_count)
+    : bnode_storage_{validate_shard_count(shard_count), identifier::NodeID::min_bnode_id},
+      iri_storage_{shard_count, identifier::NodeID::min_iri_id},
+      variable_storage_{shard_count, identifier::NodeID::min_variable_id},
+      fallback_literal_storage_{shard_count, identifier::NodeID::min_literal_id},
+      specialized_literal_storage_{make_specialized_literal_storage<decltype(specialized_literal_storage_)>(shard_count,
+                                                                                                            std::make_index_sequence<std::tuple_size_v<decltype(specialized_literal_storage_)>>{})} {
+
+    // some iri's like xsd:string are there by default
+    for (const auto &[iri, literal_type] : datatypes::registry::reserved_datatype_ids) {
+        auto const id = literal_type.to_underlying();
+        iri_storage_.insert_reserved(view::IRIBackendView{.identifier = iri}, identifier::NodeID{id});
+    }
+}
+
+size_t ShardedReferenceNodeStorage::size() const noexcept {
+    return iri_storage_.size() +
+           bnode_storage_.size() +
+           variable_storage_.size() +
+           fallback_literal_storage_.size() +
+           dice::template_library::tuple_fold(specialized_literal_storage_, 0, [](auto acc, auto const &storage) noexcept {
+               return acc + storage.size();
+           });
+}
+
+void ShardedReferenceNodeStorage::shrink_to_fit() {
+    iri_storage_.shrink_to_fit();
+    bnode_storage_.shrink_to_fit();
+    variable_storage_.shrink_to_fit();
+    fallback_literal_storage_.shrink_to_fit();
+
+    dice::template_library::tuple_for_each(specialized_literal_storage_, [](auto &storage) {
+        storage.shrink_to_fit();
+    });
+}
+
+bool ShardedReferenceNodeStorage::has_specialized_storage_for(identifier::LiteralType const datatype) noexcept {
+    static constexpr auto specialization_lut = specialization_detail::make_storage_specialization_lut<decltype(specialized_literal_storage_)>();
+    return specialization_lut[datatype.to_underlying()];
+}
+
+bool ShardedReferenceNodeStorage::has_lexically_ordered_ids([[maybe_unused]] identifier::RDFNodeType const node_type) noexcept {
+    return false;
+}
+
+/**
+ * Sharded lookup (and creation) of IDs by a provided view of a Node Backend.
+ * @tparam create_if_not_present enables code for creating non-existing Node Backends
+ * @param view contains the data of the requested Node Backend
+ * @param storage the storage where the Node Backend is looked up
+ * @return the NodeID for the looked up Node Backend. Result is the null-id if there was no matching Node Backend.
+ */
+template<bool create_if_not_present, typename Storage>
+static identifier::NodeBackendID lookup_or_insert_impl(typename Storage::backend_view_type const &view,
+                                                       Storage &storage) noexcept(!create_if_not_present) {
+    if constexpr (!create_if_not_present) {
+        if (auto const id = storage.lookup(view); id != typename Storage::backend_id_type{}) {
+            return Storage::from_storage_id(id, view);
+        }
+
+        return identifier::NodeBackendID{};
+    } else {
+        return Storage::from_storage_id(storage.lookup_or_insert(view), view);
+    }
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_or_make_id(view::LiteralBackendView const &view) {
+    return view.visit(
+            [this](view::LexicalFormLiteralBackendView const &lexical) {
+                assert(!has_specialized_storage_for(identifier::iri_node_id_to_literal_type(lexical.datatype_id)));
+                return lookup_or_insert_impl<true>(lexical, this->fallback_literal_storage_);
+            },
+            [this](view::ValueLiteralBackendView const &any) {
+                assert(has_specialized_storage_for(any.datatype));
+                return specialization_detail::visit_specialized(this->specialized_literal_storage_, any.datatype, [&any](auto &storage) {
+                    return lookup_or_insert_impl<true>(any, storage);
+                });
+            });
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_or_make_id(view::IRIBackendView const &view) {
+    return lookup_or_insert_impl<true>(view, iri_storage_);
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_or_make_id(view::BNodeBackendView const &view) {
+    return lookup_or_insert_impl<true>(view, bnode_storage_);
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_or_make_id(view::VariableBackendView const &view) {
+    return lookup_or_insert_impl<true>(view, variable_storage_);
+}
+
+/**
+ * Sharded lookup and creation of IDs for a batch of views of Node Backends that all belong into storage.
+ * Consecutive views usually belong to different shards, so the shards are still locked per view,
+ * but the batch saves the indirect call per view.
+ *
+ * @param storage the storage where the Node Backends are looked up
+ * @param ids_out ids_out[ix] is set to the NodeID for view_at(ix)
+ * @param view_at function that returns the view of the ix-th requested Node Backend
+ */
+template<typename Storage, typename ViewAt>
+static void lookup_or_insert_batch_impl(Storage &storage, std::span<identifier::NodeBackendID> const ids_out, ViewAt view_at) {
+    for (size_t ix = 0; ix < ids_out.size(); ++ix) {
+        auto const &view = view_at(ix);
+        ids_out[ix] = Storage::from_storage_id(storage.lookup_or_insert(view), view);
+    }
+}
+
+void ShardedReferenceNodeStorage::find_or_make_ids(std::span<view::LiteralBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+
+    specialization_detail::for_each_literal_storage_run(views, [&](size_t const run_begin, size_t const run_end, std::optional<identifier::LiteralType> const datatype) {
+        auto const run = views.subspan(run_begin, run_end - run_begin);
+        auto const run_ids_out = ids_out.subspan(run_begin, run_end - run_begin);
+
+        if (!datatype.has_value()) {
+            lookup_or_insert_batch_impl(fallback_literal_storage_, run_ids_out, [run](size_t const ix) -> auto const & {
+                assert(!has_specialized_storage_for(identifier::iri_node_id_to_literal_type(run[ix].get_lexical().datatype_id)));
+                return run[ix].get_lexical();
+            });
+        } else {
+            assert(has_specialized_storage_for(*datatype));
+            specialization_detail::visit_specialized(specialized_literal_storage_, *datatype, [&](auto &storage) {
+                lookup_or_insert_batch_impl(storage, run_ids_out, [run](size_t const ix) -> auto const & {
+                    return run[ix].get_value();
+                });
+            });
+        }
+    });
+}
+
+void ShardedReferenceNodeStorage::find_or_make_ids(std::span<view::IRIBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(iri_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
+void ShardedReferenceNodeStorage::find_or_make_ids(std::span<view::BNodeBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(bnode_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
+void ShardedReferenceNodeStorage::find_or_make_ids(std::span<view::VariableBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(variable_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_id(view::BNodeBackendView const &view) const noexcept {
+    return lookup_or_insert_impl<false>(view, bnode_storage_);
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_id(view::IRIBackendView const &view) const noexcept {
+    return lookup_or_insert_impl<false>(view, iri_storage_);
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_id(view::LiteralBackendView const &view) const noexcept {
+    return view.visit(
+            [this](view::LexicalFormLiteralBackendView const &lexical) noexcept {
+                assert(!has_specialized_storage_for(identifier::iri_node_id_to_literal_type(lexical.datatype_id)));
+                return lookup_or_insert_impl<false>(lexical, this->fallback_literal_storage_);
+            },
+            [this](view::ValueLiteralBackendView const &any) noexcept {
+                return specialization_detail::visit_specialized(this->specialized_literal_storage_, any.datatype, [&any](auto const &storage) noexcept {
+                    assert(has_specialized_storage_for(any.datatype));
+                    return lookup_or_insert_impl<false>(any, storage);
+                });
+            });
+}
+
+identifier::NodeBackendID ShardedReferenceNodeStorage::find_id(view::VariableBackendView const &view) const noexcept {
+    return lookup_or_insert_impl<false>(view, variable_storage_);
+}
+
+template<typename Storage>
+static typename Storage::backend_view_type find_backend_view(Storage const &storage, identifier::NodeBackendID const id) noexcept {
+    if (auto view = storage.lookup_value(Storage::to_storage_id(id)); view.has_value()) {
+        return *view;
+    } else {
+        assert(false); // assert in debug build; not critical error but should not happen
+        return Storage::get_default_view();
+    }
+}
+
+view::IRIBackendView ShardedReferenceNodeStorage::find_iri_backend(identifier::NodeBackendID const id) const noexcept {
+    return find_backend_view(iri_storage_, id);
+}
+
+view::LiteralBackendView ShardedReferenceNodeStorage::find_literal_backend(identifier::NodeBackendID const id) const noexcept {
+    if (id.node_id().literal_type().is_fixed() && has_specialized_storage_for(id.node_id().literal_type())) {
+        return specialization_detail::visit_specialized(specialized_literal_storage_, id.node_id().literal_type(), [id](auto const &storage) noexcept {
+            return find_backend_view(storage, id);
+        });
+    }
+
+    return find_backend_view(fallback_literal_storage_, id);
+}
+
+view::BNodeBackendView ShardedReferenceNodeStorage::find_bnode_backend(identifier::NodeBackendID const id) const noexcept {
+    return find_backend_view(bnode_storage_, id);
+}
+
+view::VariableBackendView ShardedReferenceNodeStorage::find_variable_backend(identifier::NodeBackendID const id) const noexcept {
+    return find_backend_view(variable_storage_, id);
+}
+
+template<typename Storage>
+static bool erase_impl(Storage &storage, identifier::NodeBackendID const id) {
+    return storage.erase(Storage::to_storage_id(id));
+}
+
+bool ShardedReferenceNodeStorage::erase_iri(identifier::NodeBackendID const id) {
+    // check predefined IRIs
+    if (identifier::iri_node_id_to_literal_type(id).is_fixed()) {
+        return false;
+    }
+
+    return erase_impl(iri_storage_, id);
+}
+
+bool ShardedReferenceNodeStorage::erase_literal(identifier::NodeBackendID const id) {
+    if (id.node_id().literal_type().is_fixed() && has_specialized_storage_for(id.node_id().literal_type())) {
+        return specialization_detail::visit_specialized(specialized_literal_storage_, id.node_id().literal_type(), [id](auto &storage) noexcept {
+            return erase_impl(storage, id);
+        });
+    }
+
+    return erase_impl(fallback_literal_storage_, id);
+}
+
+bool ShardedReferenceNodeStorage::erase_bnode(identifier::NodeBackendID const id) {
+    return erase_impl(bnode_storage_, id);
+}
+
+bool ShardedReferenceNodeStorage::erase_variable(identifier::NodeBackendID const id) {
+    return erase_impl(variable_storage_, id);
+}
+
+}  // namespace rdf4cpp::storage::reference_node_storage
@@ -0,0 +1,98 @@
+#ifndef RDF4CPP_SHARDEDREFERENCENODESTORAGE_HPP
+#define RDF4CPP_SHARDEDREFERENCENODESTORAGE_HPP
+
+#include <tuple>
+
+#include <rdf4cpp/storage/NodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/BNodeBackend.hpp>
+#include <rdf4cpp/storage/reference_node_storage/FallbackLiteralBackend.hpp>
+#include <rdf4cpp/storage/reference_node_storage/IRIBackend.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SpecializedLiteralBackend.hpp>
+#include <rdf4cpp/storage/reference_node_storage/VariableBackend.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/ShardedNodeTypeStorage.hpp>
+
+namespace rdf4cpp::storage::reference_node_storage {
+
+/**
+ * Thread-safe reference implementation of a INodeStorageBackend that is optimized for concurrent insertion.
+ *
+ * In contrast to SyncReferenceNodeStorage, the storage for each node type is split into
+ * a number of hash-partitioned shards with their own locks. This way, concurrent inserts
+ * (e.g. when parsing with multiple threads) only contend if the nodes hash to the same shard.
+ * The index of the shard is encoded in the lower bits of the NodeID.
+ * Like in SyncReferenceNodeStorage, find_*_backend does not take any locks and erased nodes are only destroyed by shrink_to_fit(),
+ * which must therefore not run concurrently with find_*_backend.
+ */
+struct ShardedReferenceNodeStorage {
+    static constexpr size_t default_shard_count = 16;
+
+private:
+    ShardedNodeTypeStorage<BNodeBackend> bnode_storage_;
+    ShardedNodeTypeStorage<IRIBackend> iri_storage_;
+    ShardedNodeTypeStorage<VariableBackend> variable_storage_;
+
+    ShardedNodeTypeStorage<FallbackLiteralBackend> fallback_literal_storage_;
+
+    std::tuple<ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Integer>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NonNegativeInteger>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::PositiveInteger>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NonPositiveInteger>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NegativeInteger>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Long>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::UnsignedLong>>,
+
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Decimal>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Double>>,
+
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Base64Binary>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::HexBinary>>,
+
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Date>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::DateTime>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::DateTimeStamp>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::GYearMonth>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Duration>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::DayTimeDuration>>,
+               ShardedNodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::YearMonthDuration>>> specialized_literal_storage_;
+
+public:
+    /**
+     * @param shard_count number of shards per node type; must be a power of two and at most 256
+     */
+    explicit ShardedReferenceNodeStorage(size_t shard_count = default_shard_count);
+
+    [[nodiscard]] size_t size() const noexcept;
+    void shrink_to_fit();
+
+    [[nodiscard]] static bool has_specialized_storage_for(identifier::LiteralType datatype) noexcept;
+    [[nodiscard]] static bool has_lexically_ordered_ids(identifier::RDFNodeType node_type) noexcept;
+
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::BNodeBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::IRIBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::LiteralBackendView const &view);
+    [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::VariableBackendView const &view);
+
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+
+    [[nodiscard]] identifier::NodeBackendID find_id(view::BNodeBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::IRIBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::LiteralBackendView const &view) const noexcept;
+    [[nodiscard]] identifier::NodeBackendID find_id(view::VariableBackendView const &view) const noexcept;
+
+    [[nodiscard]] view::IRIBackendView find_iri_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::LiteralBackendView find_literal_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::BNodeBackendView find_bnode_backend(identifier::NodeBackendID id) const noexcept;
+    [[nodiscard]] view::VariableBackendView find_variable_backend(identifier::NodeBackendID id) const noexcept;
+
+    bool erase_iri(identifier::NodeBackendID id);
+    bool erase_literal(identifier::NodeBackendID id);
+    bool erase_bnode(identifier::NodeBackendID id);
+    bool erase_variable(identifier::NodeBackendID id);
+};
+static_assert(NodeStorage<ShardedReferenceNodeStorage>);
+
+}  // namespace rdf4cpp::storage::reference_node_storage
+#endif  //RDF4CPP_SHARDEDREFERENCENODESTORAGE_HPP
@@ -17,7 +17,7 @@ struct SpecializedLiteralBackend {
     typename T::cpp_type value;
 
     explicit SpecializedLiteralBackend(view_type const &view) noexcept : hash{view.hash<literal_type>()},
-                                                                         value{std::any_cast<typename T::cpp_type>(view.value)} {
+                                                                         value{datatypes::registry::any_cast<typename T::cpp_type>(view.value)} {
         assert(view.datatype == SpecializedLiteralBackend::datatype);
     }
 
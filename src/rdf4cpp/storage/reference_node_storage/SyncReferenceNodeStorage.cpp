@@ -3,6 +3,9 @@
 #include <dice/template-library/tuple_algorithm.hpp>
 #include <rdf4cpp/storage/reference_node_storage/detail/SpecializationDetail.hpp>
 
+#include <algorithm>
+#include <array>
+
 namespace rdf4cpp::storage::reference_node_storage {
 
 SyncReferenceNodeStorage::SyncReferenceNodeStorage() noexcept {
@@ -41,7 +44,7 @@ size_t SyncReferenceNodeStorage::size() const noexcept {
 template<typename Backend>
 static void storage_shrink_to_fit(SyncNodeTypeStorage<Backend> &storage) {
     std::unique_lock<std::shared_mutex> l{storage.mutex};
-    storage.mapping.shrink_to_fit();
+    storage.shrink_to_fit();
 }
 
 void SyncReferenceNodeStorage::shrink_to_fit() {
@@ -60,6 +63,10 @@ bool SyncReferenceNodeStorage::has_specialized_storage_for(identifier::LiteralTy
     return specialization_lut[datatype.to_underlying()];
 }
 
+bool SyncReferenceNodeStorage::has_lexically_ordered_ids([[maybe_unused]] identifier::RDFNodeType const node_type) noexcept {
+    return false;
+}
+
 /**
  * Synchronized lookup (and creation) of IDs by a provided view of a Node Backend.
  * @tparam create_if_not_present enables code for creating non-existing Node Backends
@@ -119,6 +126,108 @@ identifier::NodeBackendID SyncReferenceNodeStorage::find_or_make_id(view::Variab
     return lookup_or_insert_impl<true>(view, variable_storage_);
 }
 
+/**
+ * Number of views that are processed under one lock acquisition in lookup_or_insert_batch_impl.
+ * Bounds the time other threads have to wait for the lock.
+ */
+static constexpr size_t batch_block_size = 256;
+
+/**
+ * Synchronized lookup and creation of IDs for a batch of views of Node Backends that all belong into storage.
+ * The hashes of the views are computed before any lock is taken, afterwards every block of batch_block_size views
+ * takes the shared lock once for the lookups and (only if there are missing Node Backends) the unique lock once for the insertions.
+ *
+ * @param storage the storage where the Node Backends are looked up
+ * @param ids_out ids_out[ix] is set to the NodeID for view_at(ix)
+ * @param view_at function that returns the view of the ix-th requested Node Backend
+ */
+template<typename Storage, typename ViewAt>
+static void lookup_or_insert_batch_impl(Storage &storage, std::span<identifier::NodeBackendID> const ids_out, ViewAt view_at) {
+    using backend_id_type = typename Storage::backend_id_type;
+
+    std::array<size_t, batch_block_size> hashes;
+    std::array<size_t, batch_block_size> missing;
+
+    for (size_t block_begin = 0; block_begin < ids_out.size(); block_begin += batch_block_size) {
+        auto const block_size = std::min(batch_block_size, ids_out.size() - block_begin);
+
+        for (size_t ix = 0; ix < block_size; ++ix) {
+            hashes[ix] = storage.mapping.hash(view_at(block_begin + ix));
+        }
+
+        size_t missing_size = 0;
+
+        {
+            std::shared_lock lock{storage.mutex};
+            for (size_t ix = 0; ix < block_size; ++ix) {
+                auto const &view = view_at(block_begin + ix);
+                if (auto const id = storage.mapping.lookup_id(view, hashes[ix]); id != backend_id_type{}) {
+                    ids_out[block_begin + ix] = Storage::from_storage_id(id, view);
+                } else {
+                    missing[missing_size++] = ix;
+                }
+            }
+        }
+
+        if (missing_size == 0) {
+            continue;
+        }
+
+        std::unique_lock lock{storage.mutex};
+        for (size_t missing_ix = 0; missing_ix < missing_size; ++missing_ix) {
+            auto const ix = missing[missing_ix];
+            auto const &view = view_at(block_begin + ix);
+
+            // check again, might have changed between unlocking of shared_lock and locking of unique_lock
+            // or might have been inserted earlier in this block
+            auto id = storage.mapping.lookup_id(view, hashes[ix]);
+            if (id == backend_id_type{}) {
+                id = storage.mapping.insert_assume_not_present(view, hashes[ix]);
+            }
+
+            ids_out[block_begin + ix] = Storage::from_storage_id(id, view);
+        }
+    }
+}
+
+void SyncReferenceNodeStorage::find_or_make_ids(std::span<view::LiteralBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+
+    specialization_detail::for_each_literal_storage_run(views, [&](size_t const run_begin, size_t const run_end, std::optional<identifier::LiteralType> const datatype) {
+        auto const run = views.subspan(run_begin, run_end - run_begin);
+        auto const run_ids_out = ids_out.subspan(run_begin, run_end - run_begin);
+
+        if (!datatype.has_value()) {
+            lookup_or_insert_batch_impl(fallback_literal_storage_, run_ids_out, [run](size_t const ix) -> auto const & {
+                assert(!has_specialized_storage_for(identifier::iri_node_id_to_literal_type(run[ix].get_lexical().datatype_id)));
+                return run[ix].get_lexical();
+            });
+        } else {
+            assert(has_specialized_storage_for(*datatype));
+            specialization_detail::visit_specialized(specialized_literal_storage_, *datatype, [&](auto &storage) {
+                lookup_or_insert_batch_impl(storage, run_ids_out, [run](size_t const ix) -> auto const & {
+                    return run[ix].get_value();
+                });
+            });
+        }
+    });
+}
+
+void SyncReferenceNodeStorage::find_or_make_ids(std::span<view::IRIBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(iri_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
+void SyncReferenceNodeStorage::find_or_make_ids(std::span<view::BNodeBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(bnode_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
+void SyncReferenceNodeStorage::find_or_make_ids(std::span<view::VariableBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(variable_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
 identifier::NodeBackendID SyncReferenceNodeStorage::find_id(view::BNodeBackendView const &view) const noexcept {
     return lookup_or_insert_impl<false>(view, bnode_storage_);
 }
@@ -145,10 +254,13 @@ identifier::NodeBackendID SyncReferenceNodeStorage::find_id(view::VariableBacken
     return lookup_or_insert_impl<false>(view, variable_storage_);
 }
 
+/**
+ * Lookup of a Node Backend by its id.
+ * This does not lock storage.mutex, the values in the mapping never relocate (see BiDirFlatMap::lookup_value),
+ * ids can only be obtained after their value was published and erased values are only destroyed by shrink_to_fit.
+ */
 template<typename Storage>
 static typename Storage::backend_view_type find_backend_view(Storage &storage, identifier::NodeBackendID const id) noexcept {
-    std::shared_lock<std::shared_mutex> shared_lock{storage.mutex};
-
     if (auto view = storage.mapping.lookup_value(Storage::to_storage_id(id)); view.has_value()) {
         return *view;
     } else {
@@ -184,11 +296,12 @@ static bool erase_impl(Storage &storage, identifier::NodeBackendID const id) {
     std::unique_lock lock{storage.mutex};
 
     auto const backend_id = Storage::to_storage_id(id);
-    if (!storage.mapping.lookup_value(backend_id).has_value()) {
+    if (!storage.mapping.contains(backend_id)) {
         return false;
     }
 
-    storage.mapping.erase_assume_present(backend_id);
+    // concurrent find_*_backend calls might still access the value, so it is only destroyed by shrink_to_fit
+    storage.mapping.retire_assume_present(backend_id);
     return true;
 }
 
@@ -15,9 +15,16 @@ namespace rdf4cpp::storage::reference_node_storage {
 
 /**
  * Thread-safe reference implementation of a INodeStorageBackend.
+ *
+ * Looking up and creating ids (find_id, find_or_make_id) takes the lock of the respective node type storage,
+ * resolving ids back to their Node Backends (find_*_backend) does not take any locks.
+ * Erased nodes are only destroyed (and their ids reused) by shrink_to_fit(), so that find_*_backend can safely run
+ * concurrently with erase_*. Consequently, shrink_to_fit() must not run concurrently with find_*_backend.
  */
 struct SyncReferenceNodeStorage {
 private:
+    friend struct FrozenReferenceNodeStorage;
+
     SyncNodeTypeStorage<BNodeBackend> bnode_storage_;
     SyncNodeTypeStorage<IRIBackend> iri_storage_;
     SyncNodeTypeStorage<VariableBackend> variable_storage_;
@@ -53,12 +60,18 @@ public:
     void shrink_to_fit();
 
     [[nodiscard]] static bool has_specialized_storage_for(identifier::LiteralType datatype) noexcept;
+    [[nodiscard]] static bool has_lexically_ordered_ids(identifier::RDFNodeType node_type) noexcept;
 
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::BNodeBackendView const &view);
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::IRIBackendView const &view);
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::LiteralBackendView const &view);
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::VariableBackendView const &view);
 
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+
     [[nodiscard]] identifier::NodeBackendID find_id(view::BNodeBackendView const &view) const noexcept;
     [[nodiscard]] identifier::NodeBackendID find_id(view::IRIBackendView const &view) const noexcept;
     [[nodiscard]] identifier::NodeBackendID find_id(view::LiteralBackendView const &view) const noexcept;
@@ -37,13 +37,13 @@ size_t UnsyncReferenceNodeStorage::size() const noexcept {
 }
 
 void UnsyncReferenceNodeStorage::shrink_to_fit() {
-    iri_storage_.mapping.shrink_to_fit();
-    bnode_storage_.mapping.shrink_to_fit();
-    variable_storage_.mapping.shrink_to_fit();
-    fallback_literal_storage_.mapping.shrink_to_fit();
+    iri_storage_.shrink_to_fit();
+    bnode_storage_.shrink_to_fit();
+    variable_storage_.shrink_to_fit();
+    fallback_literal_storage_.shrink_to_fit();
 
     dice::template_library::tuple_for_each(specialized_literal_storage_, [](auto &storage) {
-        storage.mapping.shrink_to_fit();
+        storage.shrink_to_fit();
     });
 }
 
@@ -52,6 +52,10 @@ bool UnsyncReferenceNodeStorage::has_specialized_storage_for(identifier::Literal
     return specialization_lut[datatype.to_underlying()];
 }
 
+bool UnsyncReferenceNodeStorage::has_lexically_ordered_ids([[maybe_unused]] identifier::RDFNodeType const node_type) noexcept {
+    return false;
+}
+
 /**
  * Unsynchronized lookup (and creation) of IDs by a provided view of a Node Backend.
  * @tparam create_if_not_present enables code for creating non-existing Node Backends
@@ -101,6 +105,67 @@ identifier::NodeBackendID UnsyncReferenceNodeStorage::find_or_make_id(view::Vari
     return lookup_or_insert_impl<true>(view, variable_storage_);
 }
 
+/**
+ * Unsynchronized lookup and creation of IDs for a batch of views of Node Backends that all belong into storage.
+ * Every view is only hashed once for both lookup and insertion.
+ *
+ * @param storage the storage where the Node Backends are looked up
+ * @param ids_out ids_out[ix] is set to the NodeID for view_at(ix)
+ * @param view_at function that returns the view of the ix-th requested Node Backend
+ */
+template<typename Storage, typename ViewAt>
+static void lookup_or_insert_batch_impl(Storage &storage, std::span<identifier::NodeBackendID> const ids_out, ViewAt view_at) {
+    for (size_t ix = 0; ix < ids_out.size(); ++ix) {
+        auto const &view = view_at(ix);
+        auto const hash = storage.mapping.hash(view);
+
+        auto id = storage.mapping.lookup_id(view, hash);
+        if (id == typename Storage::backend_id_type{}) {
+            id = storage.mapping.insert_assume_not_present(view, hash);
+        }
+
+        ids_out[ix] = Storage::from_storage_id(id, view);
+    }
+}
+
+void UnsyncReferenceNodeStorage::find_or_make_ids(std::span<view::LiteralBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+
+    specialization_detail::for_each_literal_storage_run(views, [&](size_t const run_begin, size_t const run_end, std::optional<identifier::LiteralType> const datatype) {
+        auto const run = views.subspan(run_begin, run_end - run_begin);
+        auto const run_ids_out = ids_out.subspan(run_begin, run_end - run_begin);
+
+        if (!datatype.has_value()) {
+            lookup_or_insert_batch_impl(fallback_literal_storage_, run_ids_out, [run](size_t const ix) -> auto const & {
+                assert(!has_specialized_storage_for(identifier::iri_node_id_to_literal_type(run[ix].get_lexical().datatype_id)));
+                return run[ix].get_lexical();
+            });
+        } else {
+            assert(has_specialized_storage_for(*datatype));
+            specialization_detail::visit_specialized(specialized_literal_storage_, *datatype, [&](auto &storage) {
+                lookup_or_insert_batch_impl(storage, run_ids_out, [run](size_t const ix) -> auto const & {
+                    return run[ix].get_value();
+                });
+            });
+        }
+    });
+}
+
+void UnsyncReferenceNodeStorage::find_or_make_ids(std::span<view::IRIBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(iri_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
+void UnsyncReferenceNodeStorage::find_or_make_ids(std::span<view::BNodeBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(bnode_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
+void UnsyncReferenceNodeStorage::find_or_make_ids(std::span<view::VariableBackendView const> const views, std::span<identifier::NodeBackendID> const ids_out) {
+    assert(views.size() == ids_out.size());
+    lookup_or_insert_batch_impl(variable_storage_, ids_out, [views](size_t const ix) -> auto const & { return views[ix]; });
+}
+
 identifier::NodeBackendID UnsyncReferenceNodeStorage::find_id(view::BNodeBackendView const &view) const noexcept {
     return lookup_or_insert_impl<false>(view, bnode_storage_);
 }
@@ -197,7 +262,7 @@ bool UnsyncReferenceNodeStorage::erase_variable(identifier::NodeBackendID const
     return erase_impl(variable_storage_, id);
 }
 
-void UnsyncReferenceNodeStorage::clear() noexcept {
+void UnsyncReferenceNodeStorage::clear() {
     iri_storage_.mapping.clear();
     bnode_storage_.mapping.clear();
     variable_storage_.mapping.clear();
@@ -207,6 +272,9 @@ void UnsyncReferenceNodeStorage::clear() noexcept {
         storage.mapping.clear();
     });
 
+    // all values are dead now, release the capacity of all storages (including the chunks of the arenas)
+    shrink_to_fit();
+
     init();
 }
 
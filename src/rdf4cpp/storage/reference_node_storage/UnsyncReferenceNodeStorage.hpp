@@ -19,6 +19,8 @@ namespace rdf4cpp::storage::reference_node_storage {
  */
 struct UnsyncReferenceNodeStorage {
 private:
+    friend struct FrozenReferenceNodeStorage;
+
     UnsyncNodeTypeStorage<BNodeBackend> bnode_storage_;
     UnsyncNodeTypeStorage<IRIBackend> iri_storage_;
     UnsyncNodeTypeStorage<VariableBackend> variable_storage_;
@@ -56,12 +58,18 @@ public:
     void shrink_to_fit();
 
     [[nodiscard]] static bool has_specialized_storage_for(identifier::LiteralType datatype) noexcept;
+    [[nodiscard]] static bool has_lexically_ordered_ids(identifier::RDFNodeType node_type) noexcept;
 
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::BNodeBackendView const &view);
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::IRIBackendView const &view);
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::LiteralBackendView const &view);
     [[nodiscard]] identifier::NodeBackendID find_or_make_id(view::VariableBackendView const &view);
 
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeBackendID> ids_out);
+
     [[nodiscard]] identifier::NodeBackendID find_id(view::BNodeBackendView const &view) const noexcept;
     [[nodiscard]] identifier::NodeBackendID find_id(view::IRIBackendView const &view) const noexcept;
     [[nodiscard]] identifier::NodeBackendID find_id(view::LiteralBackendView const &view) const noexcept;
@@ -77,7 +85,13 @@ public:
     bool erase_bnode(identifier::NodeBackendID id);
     bool erase_variable(identifier::NodeBackendID id);
 
-    void clear() noexcept;
+    /**
+     * Removes all nodes (except the reserved datatype IRIs) and releases the memory of all node type storages,
+     * including the specialized literal storages
+     *
+     * @throws std::bad_alloc if re-inserting the reserved datatype IRIs or rehashing during shrink_to_fit fails
+     */
+    void clear();
 };
 
 static_assert(NodeStorage<UnsyncReferenceNodeStorage>);
@@ -2,7 +2,7 @@
 #define RDF4CPP_VARIABLEBACKEND_HPP
 
 #include <rdf4cpp/storage/view/VariableBackendView.hpp>
-#include <rdf4cpp/storage/reference_node_storage/detail/ConstString.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/StringArena.hpp>
 
 namespace rdf4cpp::storage::reference_node_storage {
 
@@ -10,13 +10,15 @@ struct VariableBackend {
     using view_type = view::VariableBackendView;
     using id_type = identifier::NodeID;
 
+    using allocator_type = detail::ArenaAllocator<char>;
+
     size_t hash;
-    detail::ConstString name;
+    detail::ArenaString name;
     bool is_anonymous;
 
-    explicit VariableBackend(view_type const &view) noexcept : hash{view.hash()},
-                                                               name{view.name},
-                                                               is_anonymous{view.is_anonymous} {
+    VariableBackend(view_type const &view, allocator_type const &alloc) : hash{view.hash()},
+                                                                          name{view.name, alloc.arena()},
+                                                                          is_anonymous{view.is_anonymous} {
     }
 
     explicit operator view_type() const noexcept {
@@ -3,12 +3,21 @@
 
 #include <dice/sparse-map/sparse_set.hpp>
 #include <rdf4cpp/storage/reference_node_storage/detail/IndexFreeList.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/SegmentedVector.hpp>
+
+#include <vector>
 
 namespace rdf4cpp::storage::reference_node_storage::detail {
 
 /**
  * A bidirectional map from Id to Value
  *
+ * Values never move once they are inserted (see SegmentedVector), which makes it possible
+ * to call lookup_value() without synchronization while another thread is inserting.
+ * To also allow this while another thread is erasing, values can be erased with retire_assume_present(),
+ * which keeps them alive and their ids occupied until the next call to shrink_to_fit().
+ * lookup_id() and all modifying operations still need external synchronization.
+ *
  * @tparam Id id type
  * @tparam Value stored value type
  * @tparam View view of Value
@@ -29,7 +38,7 @@ struct BiDirFlatMap {
 private:
     using forward_value_type = std::optional<mapped_type>;
     using forward_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<forward_value_type>;
-    using forward_type = std::vector<forward_value_type, forward_allocator_type>;
+    using forward_type = SegmentedVector<forward_value_type, forward_allocator_type>;
 
     struct backward_key_type {
         size_t hash; //< hash of the Value being looked up
@@ -88,9 +97,13 @@ private:
     using index_free_list_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<index_free_list_bitmap_type>;
     using index_free_list_type = IndexFreeList<index_free_list_bitmap_type, index_free_list_allocator>;
 
+    using retired_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<bool>;
+    using retired_type = std::vector<bool, retired_allocator_type>;
+
     forward_type forward_;   //< forward_[to_index(id)] stores Value for Id id
     backward_type backward_; //< backward_[view] stores Id into forward_
     index_free_list_type freelist_; //< freelist for forward_
+    retired_type retired_;   //< retired_[to_index(id)] is true if the value for id was retired but not yet reclaimed (see retire_assume_present)
     [[no_unique_address]] allocator_type alloc_;
 
     /**
@@ -107,11 +120,31 @@ private:
         return static_cast<id_type>(ix + 1);
     }
 
+    [[nodiscard]] bool is_retired(size_type const ix) const noexcept {
+        return ix < retired_.size() && retired_[ix];
+    }
+
+    /**
+     * Destroys all retired values and makes their ids available again
+     */
+    void reclaim_retired() noexcept {
+        for (size_type ix = 0; ix < retired_.size(); ++ix) {
+            if (retired_[ix]) {
+                forward_[ix].reset();
+                freelist_.vacate(ix);
+            }
+        }
+
+        retired_.clear();
+    }
+
 public:
     explicit BiDirFlatMap(hasher const &hash = hasher{},
                           key_equal const &equal = key_equal{},
                           allocator_type const &alloc = allocator_type{}) noexcept : forward_{alloc},
                                                                                      backward_{0, backward_hasher{hash}, backward_key_equal{&forward_, equal}, alloc},
+                                                                                     freelist_{alloc},
+                                                                                     retired_{alloc},
                                                                                      alloc_{alloc} {
     }
 
@@ -133,15 +166,20 @@ public:
 
     /**
      * Requests the removal of unused capacity.
+     * This also destroys all retired values, so it must not run concurrently with lookup_value().
      */
     void shrink_to_fit() {
+        reclaim_retired();
+        retired_.shrink_to_fit();
         forward_.shrink_to_fit();
         backward_.rehash(0); // force rehash (zero is special value)
         freelist_.shrink_to_fit();
     }
 
     /**
-     * Look up the value corresponding to the given id
+     * Look up the value corresponding to the given id.
+     * Does not need to be synchronized with insertions and retire_assume_present, only with erase_assume_present, shrink_to_fit and clear.
+     * The value of a retired id is still returned until it is reclaimed by shrink_to_fit.
      *
      * @param id id for value to look up
      * @return if a value was found: a view to that value, otherwise nullopt
@@ -159,6 +197,34 @@ public:
         return static_cast<view_type>(*forward_[ix]);
     }
 
+    /**
+     * Checks if there is a value for the given id, that was neither erased nor retired.
+     * Must be synchronized with all modifications.
+     */
+    [[nodiscard]] bool contains(id_type const id) const noexcept {
+        if (id == id_type{}) [[unlikely]] {
+            return false;
+        }
+
+        auto const ix = to_index(id);
+        return ix < forward_.size() && forward_[ix].has_value() && !is_retired(ix);
+    }
+
+    /**
+     * Calls f(id, view) for every (non-retired) value stored in this map, in ascending order of ids.
+     * Must be synchronized with all modifications.
+     *
+     * @param f function to call for every (id, value) pair
+     */
+    template<typename F>
+    void for_each(F f) const {
+        for (size_type ix = 0; ix < forward_.size(); ++ix) {
+            if (forward_[ix].has_value() && !is_retired(ix)) {
+                f(to_id(ix), static_cast<view_type>(*forward_[ix]));
+            }
+        }
+    }
+
     /**
      * Look up the id corresponding the given (view to a) value
      *
@@ -174,6 +240,32 @@ public:
         return it->id;
     }
 
+    /**
+     * Look up the id corresponding the given (view to a) value
+     *
+     * @param view view of value of which to find the id
+     * @param hash precomputed hash of view (as returned by hash(view))
+     * @return id of the value if it was found, otherwise id_type{} if no id was found
+     */
+    [[nodiscard]] id_type lookup_id(view_type const &view, size_t const hash) const noexcept {
+        assert(hash == this->hash(view));
+
+        auto it = backward_.find(view, hash);
+        if (it == backward_.end()) {
+            return id_type{};
+        }
+
+        return it->id;
+    }
+
+    /**
+     * Computes the hash of the given view, as it is used by this map.
+     * Can be used to avoid hashing the same view multiple times (see lookup_id(view, hash) and insert_assume_not_present(view, hash)).
+     */
+    [[nodiscard]] size_t hash(view_type const &view) const noexcept {
+        return backward_.hash_function().hash(view);
+    }
+
     /**
      * Reserve capacity such that min_id is the first id that
      * triggers an allocation if it is inserted.
@@ -198,19 +290,33 @@ public:
      * @return id of newly constructed value
      */
     [[nodiscard]] id_type insert_assume_not_present(view_type const &view) {
+        return insert_assume_not_present(view, hash(view));
+    }
+
+    /**
+     * Insert a value at the first free id
+     *
+     * @precondition the value is not yet present in this map
+     *
+     * @param view view of the value to construct
+     * @param hash precomputed hash of view (as returned by hash(view))
+     * @return id of newly constructed value
+     */
+    [[nodiscard]] id_type insert_assume_not_present(view_type const &view, size_t const hash) {
         assert(lookup_id(view) == Id{});
+        assert(hash == this->hash(view));
 
         auto const assigned_ix = freelist_.occupy_next_available();
         if (assigned_ix >= forward_.size()) {
             assert(assigned_ix == forward_.size());
-            forward_.emplace_back();
+            // construct in place, so that readers never observe a partially constructed value
+            forward_.emplace_back(std::make_obj_using_allocator<mapped_type>(alloc_, view));
+        } else {
+            forward_[assigned_ix] = std::make_obj_using_allocator<mapped_type>(alloc_, view);
         }
 
-        forward_[assigned_ix] = std::make_obj_using_allocator<mapped_type>(alloc_, view);
-
         auto const assigned_id = to_id(assigned_ix);
-        auto const h = backward_.hash_function().hash(view);
-        backward_.emplace(h, assigned_id);
+        backward_.emplace(hash, assigned_id);
 
         return assigned_id;
     }
@@ -246,7 +352,7 @@ public:
      * @param id id of the value to be erased
      */
     void erase_assume_present(id_type const id) {
-        assert(lookup_value(id).has_value());
+        assert(contains(id));
 
         auto const ix = to_index(id);
         auto &value = forward_[ix];
@@ -257,10 +363,31 @@ public:
         freelist_.vacate(ix);
     }
 
+    /**
+     * Erase the value at the given id, but defer its destruction until the next call to shrink_to_fit().
+     * Afterwards, the value cannot be found by lookup_id() anymore, but concurrent calls to lookup_value()
+     * can still safely access it. The id is not reused before the value is destroyed.
+     *
+     * @precondition there is actually a value at the given id
+     * @param id id of the value to be retired
+     */
+    void retire_assume_present(id_type const id) {
+        assert(contains(id));
+
+        auto const ix = to_index(id);
+        if (ix >= retired_.size()) {
+            retired_.resize(ix + 1);
+        }
+
+        backward_.erase(static_cast<view_type>(*forward_[ix]));
+        retired_[ix] = true;
+    }
+
     void clear() noexcept {
         forward_.clear();
         backward_.clear();
         freelist_.clear();
+        retired_.clear();
     }
 };
 
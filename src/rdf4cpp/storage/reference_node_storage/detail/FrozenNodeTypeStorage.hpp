@@ -0,0 +1,216 @@
+#ifndef RDF4CPP_FROZENNODETYPESTORAGE_HPP
+#define RDF4CPP_FROZENNODETYPESTORAGE_HPP
+
+#include <rdf4cpp/storage/detail/NodeCodecs.hpp>
+#include <rdf4cpp/storage/identifier/NodeBackendID.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SpecializedLiteralBackend.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/MinimalPerfectHash.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace rdf4cpp::storage::reference_node_storage::detail {
+
+/**
+ * @return the string that determines the lexical order of view
+ */
+inline std::string_view lexical_order_key(view::IRIBackendView const &view) noexcept {
+    return view.identifier;
+}
+
+inline std::string_view lexical_order_key(view::BNodeBackendView const &view) noexcept {
+    return view.identifier;
+}
+
+inline std::string_view lexical_order_key(view::VariableBackendView const &view) noexcept {
+    return view.name;
+}
+
+inline std::string_view lexical_order_key(view::LexicalFormLiteralBackendView const &view) noexcept {
+    return view.lexical_form;
+}
+
+/**
+ * Immutable storage for one of the string based Node Backend types (IRIs, blank nodes, variables and lexical literals).
+ * The values are encoded (see storage::detail::NodeCodecs.hpp) into a single contiguous blob,
+ * an offset table maps ids to values and a FrozenIdIndex maps values to ids.
+ *
+ * @tparam Codec one of the codecs in storage::detail::NodeCodecs.hpp
+ */
+template<typename Codec>
+struct FrozenStringNodeTypeStorage {
+    using backend_view_type = typename Codec::view_type;
+
+private:
+    std::vector<char> blob_;
+    std::vector<uint64_t> offsets_; //< the encoding of the value with id i is at blob_[offsets_[i], offsets_[i + 1])
+    size_t size_ = 0;
+    FrozenIdIndex index_;
+
+    [[nodiscard]] backend_view_type value_at(uint64_t const id) const noexcept {
+        return Codec::decode(blob_.data() + offsets_[id], offsets_[id + 1] - offsets_[id]);
+    }
+
+public:
+    /**
+     * Copies all values of mapping
+     *
+     * @param mapping a BiDirFlatMap with view type backend_view_type
+     * @param lexically_ordered if true, the dynamically assigned ids (i.e. ids starting at Codec::min_id) are reassigned
+     *          such that their order matches the lexical order of the values (see lexical_order_key), otherwise ids are preserved
+     * @param transform applied to every value before it is stored, e.g. to translate ids of other nodes that are contained in the value
+     */
+    template<typename Mapping, typename Transform = std::identity>
+    FrozenStringNodeTypeStorage(Mapping const &mapping, bool const lexically_ordered, Transform const &transform = {}) {
+        struct id_value {
+            uint64_t id;
+            backend_view_type view;
+        };
+
+        std::vector<id_value> values;
+        mapping.for_each([&](auto const id, backend_view_type const &view) {
+            values.push_back(id_value{.id = static_cast<uint64_t>(id.to_underlying()), .view = transform(view)});
+        });
+
+        if (lexically_ordered) {
+            auto const dynamic_begin = std::ranges::find_if(values, [](id_value const &v) noexcept { return v.id >= Codec::min_id; });
+            std::ranges::sort(dynamic_begin, values.end(), {}, [](id_value const &v) noexcept { return lexical_order_key(v.view); });
+
+            auto next_id = Codec::min_id;
+            for (auto it = dynamic_begin; it != values.end(); ++it) {
+                it->id = next_id++;
+            }
+        }
+
+        std::vector<std::pair<uint64_t, FrozenIdIndex::id_type>> entries;
+        entries.reserve(values.size());
+
+        for (auto const &[id, view] : values) {
+            // ids without values get an empty range
+            offsets_.resize(id + 1, blob_.size());
+
+            auto const off = blob_.size();
+            blob_.resize(off + Codec::encoded_size(view));
+            Codec::encode(view, blob_.data() + off);
+
+            entries.emplace_back(view.hash(), id);
+        }
+
+        offsets_.push_back(blob_.size());
+        blob_.shrink_to_fit();
+        offsets_.shrink_to_fit();
+
+        size_ = entries.size();
+        index_ = FrozenIdIndex{std::move(entries)};
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @return id of view or the null-id if it is not present
+     */
+    [[nodiscard]] identifier::NodeBackendID lookup_id(backend_view_type const &view) const noexcept {
+        auto const id = index_.lookup(view.hash(), [&](uint64_t const candidate) noexcept {
+            return value_at(candidate) == view;
+        });
+
+        if (id == 0) {
+            return identifier::NodeBackendID{};
+        }
+
+        return Codec::to_backend_id(id, view);
+    }
+
+    /**
+     * @precondition id refers to a value in this storage
+     */
+    [[nodiscard]] backend_view_type lookup_value(identifier::NodeBackendID const id) const noexcept {
+        auto const ix = Codec::from_backend_id(id);
+        assert(ix + 1 < offsets_.size());
+        return value_at(ix);
+    }
+};
+
+/**
+ * Immutable storage for the values of one of the specialized literal types.
+ * The values are stored in an array indexed by id, a FrozenIdIndex maps values to ids.
+ *
+ * @tparam BackendType_t a SpecializedLiteralBackend
+ */
+template<typename BackendType_t>
+struct FrozenSpecializedNodeTypeStorage {
+    using backend_type = BackendType_t;
+    using backend_view_type = typename backend_type::view_type;
+    using literal_type = typename backend_type::literal_type;
+    using backend_id_type = typename backend_type::id_type;
+
+private:
+    std::vector<typename literal_type::cpp_type> values_; //< values_[i] is the value with id i
+    size_t size_ = 0;
+    FrozenIdIndex index_;
+
+public:
+    /**
+     * Copies all values of mapping
+     * @param mapping a BiDirFlatMap with view type backend_view_type
+     */
+    template<typename Mapping>
+    explicit FrozenSpecializedNodeTypeStorage(Mapping const &mapping) {
+        std::vector<std::pair<uint64_t, FrozenIdIndex::id_type>> entries;
+
+        mapping.for_each([&](auto const id, backend_view_type const &view) {
+            auto const ix = static_cast<uint64_t>(id.to_underlying());
+
+            values_.resize(ix + 1);
+            values_[ix] = datatypes::registry::any_cast<typename literal_type::cpp_type>(view.value);
+
+            entries.emplace_back(view.template hash<literal_type>(), ix);
+        });
+
+        values_.shrink_to_fit();
+
+        size_ = entries.size();
+        index_ = FrozenIdIndex{std::move(entries)};
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @return id of view or the null-id if it is not present
+     */
+    [[nodiscard]] identifier::NodeBackendID lookup_id(backend_view_type const &view) const noexcept {
+        assert(view.datatype == backend_type::datatype);
+
+        auto const id = index_.lookup(view.template hash<literal_type>(), [&](uint64_t const candidate) noexcept {
+            return view.template eq<literal_type>(values_[candidate]);
+        });
+
+        if (id == 0) {
+            return identifier::NodeBackendID{};
+        }
+
+        return backend_type::from_storage_id(backend_id_type{id}, view);
+    }
+
+    /**
+     * @precondition id refers to a value in this storage
+     */
+    [[nodiscard]] backend_view_type lookup_value(identifier::NodeBackendID const id) const noexcept {
+        auto const ix = backend_type::to_storage_id(id).to_underlying();
+        assert(ix < values_.size());
+        return backend_view_type{.datatype = backend_type::datatype, .value = values_[ix]};
+    }
+};
+
+}  // namespace rdf4cpp::storage::reference_node_storage::detail
+
+#endif  //RDF4CPP_FROZENNODETYPESTORAGE_HPP
@@ -0,0 +1,247 @@
+#ifndef RDF4CPP_REFERENCENODESTORAGE_MINIMALPERFECTHASH_HPP
+#define RDF4CPP_REFERENCENODESTORAGE_MINIMALPERFECTHASH_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace rdf4cpp::storage::reference_node_storage::detail {
+
+/**
+ * A minimal perfect hash function over a fixed set of (pairwise distinct) 64-bit hashes,
+ * i.e. a bijection from the set of hashes to [0, size()).
+ *
+ * Built using hash-and-displace: the hashes are distributed into buckets of (on average) bucket_load hashes,
+ * then, beginning with the biggest bucket, a pilot is searched for every bucket that places all of its hashes into
+ * free slots. Buckets with a single hash are placed into the remaining free slots directly.
+ *
+ * Evaluating the function on a hash that is not part of the set yields an arbitrary slot in [0, size()).
+ */
+struct MinimalPerfectHash {
+private:
+    static constexpr size_t bucket_load = 3;
+    static constexpr uint64_t direct_slot_flag = uint64_t{1} << 63; //< pilot is the slot itself
+
+    std::vector<uint64_t> pilots_; //< pilots_[bucket] is the pilot of the bucket (or the slot if direct_slot_flag is set)
+    size_t size_ = 0;
+
+    [[nodiscard]] static constexpr uint64_t mix(uint64_t x) noexcept {
+        // finalizer of MurmurHash3
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    /**
+     * Maps x uniformly into [0, n) without a division
+     */
+    [[nodiscard]] static constexpr size_t reduce(uint64_t const x, size_t const n) noexcept {
+        return static_cast<size_t>((static_cast<__uint128_t>(x) * n) >> 64);
+    }
+
+    [[nodiscard]] size_t bucket_of(uint64_t const hash) const noexcept {
+        return reduce(mix(hash), pilots_.size());
+    }
+
+    [[nodiscard]] size_t slot_of(uint64_t const hash, uint64_t const pilot) const noexcept {
+        return reduce(mix(hash ^ mix(pilot + 0x9e3779b97f4a7c15ULL)), size_);
+    }
+
+public:
+    MinimalPerfectHash() noexcept = default;
+
+    /**
+     * Builds the minimal perfect hash function for the given hashes
+     * @param hashes set of hashes, must not contain duplicates
+     */
+    explicit MinimalPerfectHash(std::span<uint64_t const> const hashes) : size_{hashes.size()} {
+        if (hashes.empty()) {
+            return;
+        }
+
+        pilots_.resize((hashes.size() + bucket_load - 1) / bucket_load);
+
+        // group hashes by bucket
+        std::vector<std::pair<size_t, uint64_t>> bucketed; // (bucket, hash)
+        bucketed.reserve(hashes.size());
+        for (auto const hash : hashes) {
+            bucketed.emplace_back(bucket_of(hash), hash);
+        }
+        std::ranges::sort(bucketed);
+        assert(std::ranges::adjacent_find(bucketed) == bucketed.end());
+
+        struct bucket_range {
+            size_t bucket;
+            size_t begin;
+            size_t end;
+        };
+
+        std::vector<bucket_range> buckets;
+        for (size_t begin = 0; begin < bucketed.size();) {
+            auto end = begin + 1;
+            while (end < bucketed.size() && bucketed[end].first == bucketed[begin].first) {
+                ++end;
+            }
+
+            buckets.push_back(bucket_range{.bucket = bucketed[begin].first, .begin = begin, .end = end});
+            begin = end;
+        }
+
+        // biggest buckets first, they are hardest to place
+        std::ranges::stable_sort(buckets, std::greater{}, [](bucket_range const &b) { return b.end - b.begin; });
+
+        std::vector<bool> taken(size_);
+        std::vector<size_t> bucket_slots;
+
+        auto it = buckets.begin();
+        for (; it != buckets.end() && it->end - it->begin > 1; ++it) {
+            for (uint64_t pilot = 0;; ++pilot) {
+                bucket_slots.clear();
+
+                bool ok = true;
+                for (auto ix = it->begin; ix < it->end; ++ix) {
+                    auto const slot = slot_of(bucketed[ix].second, pilot);
+                    if (taken[slot] || std::ranges::find(bucket_slots, slot) != bucket_slots.end()) {
+                        ok = false;
+                        break;
+                    }
+                    bucket_slots.push_back(slot);
+                }
+
+                if (ok) {
+                    for (auto const slot : bucket_slots) {
+                        taken[slot] = true;
+                    }
+                    pilots_[it->bucket] = pilot;
+                    break;
+                }
+            }
+        }
+
+        // remaining buckets contain exactly one hash, place them directly
+        size_t next_free = 0;
+        for (; it != buckets.end(); ++it) {
+            while (taken[next_free]) {
+                ++next_free;
+            }
+
+            taken[next_free] = true;
+            pilots_[it->bucket] = direct_slot_flag | next_free;
+        }
+    }
+
+    /**
+     * @return number of hashes in the set; slots are in [0, size())
+     */
+    [[nodiscard]] size_t size() const noexcept {
+        return size_;
+    }
+
+    /**
+     * @param hash a hash
+     * @return the slot of hash if it is part of the set, otherwise an arbitrary slot
+     * @precondition size() > 0
+     */
+    [[nodiscard]] size_t operator()(uint64_t const hash) const noexcept {
+        assert(size_ > 0);
+
+        auto const pilot = pilots_[bucket_of(hash)];
+        if (pilot & direct_slot_flag) {
+            return static_cast<size_t>(pilot & ~direct_slot_flag);
+        }
+
+        return slot_of(hash, pilot);
+    }
+};
+
+/**
+ * Maps (views of) values to their ids using a MinimalPerfectHash.
+ * The index does not store the values itself, so a lookup needs a way to check whether a candidate id holds the requested value.
+ */
+struct FrozenIdIndex {
+    using id_type = uint64_t;
+
+private:
+    struct entry {
+        uint64_t hash;
+        id_type id; //< 0 means no entry
+
+        auto operator<=>(entry const &) const noexcept = default;
+    };
+
+    MinimalPerfectHash mph_;
+    std::vector<entry> slots_;    //< slots_[mph_(hash)] is the entry for hash
+    std::vector<entry> overflow_; //< sorted entries of values whose hash is shared with another value
+
+public:
+    FrozenIdIndex() noexcept = default;
+
+    /**
+     * @param entries (hash, id) pairs of all values that should be found in this index
+     */
+    explicit FrozenIdIndex(std::vector<std::pair<uint64_t, id_type>> entries) {
+        std::ranges::sort(entries);
+
+        std::vector<uint64_t> unique_hashes;
+        unique_hashes.reserve(entries.size());
+        for (size_t ix = 0; ix < entries.size(); ++ix) {
+            if (ix > 0 && entries[ix].first == entries[ix - 1].first) {
+                overflow_.push_back(entry{.hash = entries[ix].first, .id = entries[ix].second});
+            } else {
+                unique_hashes.push_back(entries[ix].first);
+            }
+        }
+
+        mph_ = MinimalPerfectHash{unique_hashes};
+        slots_.resize(unique_hashes.size());
+
+        for (size_t ix = 0; ix < entries.size(); ++ix) {
+            if (ix == 0 || entries[ix].first != entries[ix - 1].first) {
+                slots_[mph_(entries[ix].first)] = entry{.hash = entries[ix].first, .id = entries[ix].second};
+            }
+        }
+    }
+
+    /**
+     * Looks up the id of a value
+     *
+     * @param hash hash of the value
+     * @param holds_value function that checks if the given id holds the requested value
+     * @return id of the value or 0 if it is not present
+     */
+    template<typename F>
+    [[nodiscard]] id_type lookup(uint64_t const hash, F holds_value) const noexcept {
+        if (slots_.empty()) [[unlikely]] {
+            return 0;
+        }
+
+        if (auto const &e = slots_[mph_(hash)]; e.hash == hash && holds_value(e.id)) [[likely]] {
+            return e.id;
+        }
+
+        if (overflow_.empty()) [[likely]] {
+            return 0;
+        }
+
+        auto const [first, last] = std::ranges::equal_range(overflow_, hash, {}, &entry::hash);
+        for (auto it = first; it != last; ++it) {
+            if (holds_value(it->id)) {
+                return it->id;
+            }
+        }
+
+        return 0;
+    }
+};
+
+}  // namespace rdf4cpp::storage::reference_node_storage::detail
+
+#endif  //RDF4CPP_REFERENCENODESTORAGE_MINIMALPERFECTHASH_HPP
@@ -0,0 +1,182 @@
+#ifndef RDF4CPP_RDF_REFERENCENODESTORAGE_SEGMENTEDVECTOR_HPP
+#define RDF4CPP_RDF_REFERENCENODESTORAGE_SEGMENTEDVECTOR_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rdf4cpp::storage::reference_node_storage::detail {
+
+/**
+ * An append-only vector whose elements never relocate.
+ *
+ * The elements are stored in segments of exponentially growing size (segment k holds first_segment_size * 2^k elements),
+ * so that growing never needs to move existing elements. Segments and the size are published with release semantics,
+ * which allows reading existing elements without any locks while (at most) one other thread appends new elements.
+ *
+ * Thread-safety:
+ *      - all modifying operations need to be externally synchronized with each other
+ *      - operator[] and size() can be called concurrently with emplace_back() and resize() (but not with clear() or shrink_to_fit()),
+ *        as long as the element being accessed was published to the reading thread (i.e. its index is below size())
+ *
+ * @tparam T element type
+ * @tparam Allocator allocator for T
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+struct SegmentedVector {
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using reference = value_type &;
+    using const_reference = value_type const &;
+
+private:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+    static_assert(std::is_same_v<typename alloc_traits::pointer, value_type *>, "SegmentedVector requires an allocator with raw pointers");
+
+    static constexpr size_type first_segment_size_log2 = 8;
+    static constexpr size_type first_segment_size = size_type{1} << first_segment_size_log2;
+    static constexpr size_type max_segments = sizeof(size_type) * 8 - first_segment_size_log2;
+
+    std::array<std::atomic<value_type *>, max_segments> segments_{};
+    std::atomic<size_type> size_ = 0;
+    [[no_unique_address]] allocator_type alloc_;
+
+    /**
+     * Number of elements in segment segment_ix
+     */
+    [[nodiscard]] static constexpr size_type segment_size(size_type const segment_ix) noexcept {
+        return first_segment_size << segment_ix;
+    }
+
+    /**
+     * Decomposes an element index into segment index and offset into that segment
+     */
+    [[nodiscard]] static constexpr std::pair<size_type, size_type> decompose(size_type const ix) noexcept {
+        auto const biased_ix = ix + first_segment_size;
+        auto const segment_ix = static_cast<size_type>(std::bit_width(biased_ix)) - 1 - first_segment_size_log2;
+        return {segment_ix, biased_ix - segment_size(segment_ix)};
+    }
+
+    [[nodiscard]] value_type *element_ptr(size_type const ix) const noexcept {
+        auto const [segment_ix, offset] = decompose(ix);
+        return segments_[segment_ix].load(std::memory_order_acquire) + offset;
+    }
+
+    /**
+     * Destroys all elements with index >= new_size
+     */
+    void destroy_from(size_type const new_size) noexcept {
+        auto const old_size = size_.load(std::memory_order_relaxed);
+        for (auto ix = new_size; ix < old_size; ++ix) {
+            alloc_traits::destroy(alloc_, element_ptr(ix));
+        }
+        size_.store(new_size, std::memory_order_release);
+    }
+
+    /**
+     * Deallocates all segments that do not contain any elements
+     */
+    void deallocate_unused_segments() noexcept {
+        auto const size = size_.load(std::memory_order_relaxed);
+        auto const first_unused = size == 0 ? 0 : decompose(size - 1).first + 1;
+
+        for (auto segment_ix = first_unused; segment_ix < max_segments; ++segment_ix) {
+            if (auto *segment = segments_[segment_ix].exchange(nullptr, std::memory_order_relaxed); segment != nullptr) {
+                alloc_traits::deallocate(alloc_, segment, segment_size(segment_ix));
+            }
+        }
+    }
+
+public:
+    explicit SegmentedVector(allocator_type const &alloc = allocator_type{}) noexcept : alloc_{alloc} {
+    }
+
+    // deleted because elements are supposed to never move
+    SegmentedVector(SegmentedVector const &) = delete;
+    SegmentedVector(SegmentedVector &&) = delete;
+    SegmentedVector &operator=(SegmentedVector const &) = delete;
+    SegmentedVector &operator=(SegmentedVector &&) = delete;
+
+    ~SegmentedVector() {
+        clear();
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] reference operator[](size_type const ix) noexcept {
+        assert(ix < size());
+        return *element_ptr(ix);
+    }
+
+    [[nodiscard]] const_reference operator[](size_type const ix) const noexcept {
+        assert(ix < size());
+        return *element_ptr(ix);
+    }
+
+    /**
+     * Constructs a new element at the end.
+     * The element is fully constructed before it is published to readers.
+     */
+    template<typename ...Args>
+    reference emplace_back(Args &&...args) {
+        auto const ix = size_.load(std::memory_order_relaxed);
+        auto const [segment_ix, offset] = decompose(ix);
+
+        auto *segment = segments_[segment_ix].load(std::memory_order_relaxed);
+        if (segment == nullptr) {
+            segment = alloc_traits::allocate(alloc_, segment_size(segment_ix));
+            segments_[segment_ix].store(segment, std::memory_order_release);
+        }
+
+        auto *elem = segment + offset;
+        alloc_traits::construct(alloc_, elem, std::forward<Args>(args)...);
+        size_.store(ix + 1, std::memory_order_release);
+
+        return *elem;
+    }
+
+    /**
+     * Resizes this vector to contain new_size elements.
+     * New elements are value-initialized.
+     */
+    void resize(size_type const new_size) {
+        if (new_size < size()) {
+            destroy_from(new_size);
+            return;
+        }
+
+        while (size() < new_size) {
+            emplace_back();
+        }
+    }
+
+    /**
+     * Requests the removal of unused capacity.
+     * Can only free whole segments that are not used anymore.
+     */
+    void shrink_to_fit() noexcept {
+        deallocate_unused_segments();
+    }
+
+    void clear() noexcept {
+        destroy_from(0);
+        deallocate_unused_segments();
+    }
+};
+
+} // namespace rdf4cpp::storage::reference_node_storage::detail
+
+#endif // RDF4CPP_RDF_REFERENCENODESTORAGE_SEGMENTEDVECTOR_HPP
@@ -0,0 +1,290 @@
+#ifndef RDF4CPP_SHARDEDNODETYPESTORAGE_HPP
+#define RDF4CPP_SHARDEDNODETYPESTORAGE_HPP
+
+#include <rdf4cpp/datatypes/registry/FixedIdMappings.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/SyncNodeTypeStorage.hpp>
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+
+namespace rdf4cpp::storage::reference_node_storage {
+
+/**
+ * Storage for one of the Node Backend types, that is split into a number of hash-partitioned shards.
+ * Every shard is a SyncNodeTypeStorage with its own mutex, so operations on nodes that belong to
+ * different shards do not contend with each other.
+ *
+ * Ids are assigned per shard. To make them unique across shards the index of the shard is stored
+ * in the lowest bits of the (global) id (see to_global_id() and to_local_id()).
+ * The exception to this are reserved ids (i.e. ids below min_id), these are the same in all shards
+ * and the shard they are stored in is remembered separately.
+ * Because of this, every shard can only assign 1/shard_count of the ids that fit into backend_id_type.
+ *
+ * @tparam BackendType_t one of BNodeBackend, IRIBackend, FallbackLiteralBackend, SpecializedLiteralBackend and VariableBackend.
+ */
+template<typename BackendType_t>
+struct ShardedNodeTypeStorage {
+    using shard_type = SyncNodeTypeStorage<BackendType_t>;
+    using backend_type = typename shard_type::backend_type;
+    using backend_view_type = typename shard_type::backend_view_type;
+    using backend_id_type = typename shard_type::backend_id_type;
+
+    static constexpr size_t max_shard_count = 256;
+    static constexpr uint64_t max_representable_id = (uint64_t{1} << backend_id_type::width) - 1;
+
+private:
+    // every shard gets its own cache line(s) to prevent false sharing between the mutexes
+    struct alignas(64) aligned_shard : shard_type {
+    };
+
+    std::unique_ptr<aligned_shard[]> shards_;
+    size_t shard_bits_;
+    uint64_t min_id_; //< first id that is not reserved
+    uint64_t max_id_; //< last (global) id that can be assigned
+    std::array<uint8_t, datatypes::registry::min_dynamic_datatype_id> reserved_shards_{}; //< reserved_shards_[id] is the shard of reserved id id
+
+    [[nodiscard]] size_t shard_count() const noexcept {
+        return size_t{1} << shard_bits_;
+    }
+
+    /**
+     * Selects the shard for a hash value.
+     * The upper bits are used, because the lower bits are used to select the bucket inside the hash table of the shard.
+     */
+    [[nodiscard]] size_t shard_of(size_t const hash) const noexcept {
+        if (shard_bits_ == 0) {
+            return 0;
+        }
+
+        return hash >> (sizeof(size_t) * 8 - shard_bits_);
+    }
+
+    /**
+     * Checks if the shard-local id of the given shard translates to a global id that is at most max_id_
+     */
+    [[nodiscard]] bool has_global_id(size_t const shard_ix, backend_id_type const local_id) const noexcept {
+        auto const local = local_id.to_underlying();
+        if (local < min_id_) {
+            return true;
+        }
+
+        // equivalent to min_id_ + ((local - min_id_) << shard_bits_ | shard_ix) <= max_id_, without overflowing
+        return local - min_id_ <= ((max_id_ - min_id_ - shard_ix) >> shard_bits_);
+    }
+
+    /**
+     * Translates a shard-local id of the given shard into a globally unique id
+     *
+     * @precondition has_global_id(shard_ix, local_id)
+     */
+    [[nodiscard]] backend_id_type to_global_id(size_t const shard_ix, backend_id_type const local_id) const noexcept {
+        assert(has_global_id(shard_ix, local_id));
+
+        auto const local = local_id.to_underlying();
+        if (local < min_id_) {
+            return local_id;
+        }
+
+        return backend_id_type{min_id_ + (((local - min_id_) << shard_bits_) | shard_ix)};
+    }
+
+    /**
+     * Translates a globally unique id into the index of its shard and its shard-local id
+     */
+    [[nodiscard]] std::pair<size_t, backend_id_type> to_local_id(backend_id_type const global_id) const noexcept {
+        auto const global = global_id.to_underlying();
+        if (global < min_id_) {
+            return {reserved_shards_[global], global_id};
+        }
+
+        auto const offset = global - min_id_;
+        return {offset & (shard_count() - 1), backend_id_type{min_id_ + (offset >> shard_bits_)}};
+    }
+
+public:
+    /**
+     * @param shard_count number of shards, must be a power of two and at most max_shard_count
+     * @param min_id first id that is not reserved, i.e. the first id that can be dynamically assigned
+     * @param max_id last id that can be assigned, defaults to the largest id that fits into backend_id_type
+     */
+    ShardedNodeTypeStorage(size_t const shard_count,
+                           backend_id_type const min_id,
+                           backend_id_type const max_id = backend_id_type{max_representable_id}) : shards_{std::make_unique<aligned_shard[]>(shard_count)},
+                                                                                                   shard_bits_{static_cast<size_t>(std::countr_zero(shard_count))},
+                                                                                                   min_id_{min_id.to_underlying()},
+                                                                                                   max_id_{max_id.to_underlying()} {
+        assert(std::has_single_bit(shard_count));
+        assert(shard_count <= max_shard_count);
+        assert(min_id_ <= reserved_shards_.size());
+        assert(max_id_ >= min_id_ + shard_count - 1); // every shard can assign at least one id
+
+        for (size_t ix = 0; ix < shard_count; ++ix) {
+            shards_[ix].mapping.reserve_until(min_id);
+        }
+    }
+
+    /**
+     * Inserts a value at a reserved id.
+     * Must only be called during construction of the enclosing node storage.
+     *
+     * @precondition id is below min_id
+     */
+    void insert_reserved(backend_view_type const &view, backend_id_type const id) {
+        assert(id.to_underlying() < min_id_);
+
+        auto const hash = shards_[0].mapping.hash(view);
+        auto const shard_ix = shard_of(hash);
+
+        shards_[shard_ix].mapping.insert_assume_not_present_at(view, id);
+        reserved_shards_[id.to_underlying()] = static_cast<uint8_t>(shard_ix);
+    }
+
+    /**
+     * Synchronized lookup of ids by a provided view of a Node Backend.
+     * Only the shard the view belongs to is locked.
+     *
+     * @param view contains the data of the requested Node Backend
+     * @return the id for the looked up Node Backend. Result is the null-id if there was no matching Node Backend.
+     */
+    [[nodiscard]] backend_id_type lookup(backend_view_type const &view) const noexcept {
+        auto const hash = shards_[0].mapping.hash(view);
+        auto const shard_ix = shard_of(hash);
+        auto const &shard = shards_[shard_ix];
+
+        std::shared_lock lock{shard.mutex};
+        if (auto const id = shard.mapping.lookup_id(view, hash); id != backend_id_type{}) {
+            return to_global_id(shard_ix, id);
+        }
+
+        return backend_id_type{};
+    }
+
+    /**
+     * Synchronized lookup and creation of ids by a provided view of a Node Backend.
+     * Only the shard the view belongs to is locked.
+     *
+     * @param view contains the data of the requested Node Backend
+     * @return the id for the looked up or newly created Node Backend
+     * @throws std::runtime_error if the shard of view has no ids left
+     */
+    [[nodiscard]] backend_id_type lookup_or_insert(backend_view_type const &view) {
+        auto const hash = shards_[0].mapping.hash(view);
+        auto const shard_ix = shard_of(hash);
+        auto &shard = shards_[shard_ix];
+
+        {
+            std::shared_lock lock{shard.mutex};
+            if (auto const id = shard.mapping.lookup_id(view, hash); id != backend_id_type{}) {
+                return to_global_id(shard_ix, id);
+            }
+        }
+
+        std::unique_lock lock{shard.mutex};
+
+        // check again, might have changed between unlocking of shared_lock and locking of unique_lock
+        if (auto const id = shard.mapping.lookup_id(view, hash); id != backend_id_type{}) {
+            return to_global_id(shard_ix, id);
+        }
+
+        auto const id = shard.mapping.insert_assume_not_present(view, hash);
+        if (!has_global_id(shard_ix, id)) [[unlikely]] {
+            // the id was never handed out, so there cannot be any concurrent readers
+            shard.mapping.erase_assume_present(id);
+            throw std::runtime_error{"ShardedNodeTypeStorage: no ids left in shard"};
+        }
+
+        return to_global_id(shard_ix, id);
+    }
+
+    /**
+     * Look up the value corresponding to the given (global) id.
+     * Does not lock the shard (see BiDirFlatMap::lookup_value), erased values are only destroyed by shrink_to_fit().
+     *
+     * @param id id for value to look up
+     * @return if a value was found: a view to that value, otherwise nullopt
+     */
+    [[nodiscard]] std::optional<backend_view_type> lookup_value(backend_id_type const id) const noexcept {
+        if (id == backend_id_type{}) [[unlikely]] {
+            return std::nullopt;
+        }
+
+        auto const [shard_ix, local_id] = to_local_id(id);
+        return shards_[shard_ix].mapping.lookup_value(local_id);
+    }
+
+    /**
+     * Erase the value with the given (global) id.
+     * The value stays alive for concurrent calls to lookup_value() and its id is not reused until shrink_to_fit() is called.
+     *
+     * @param id id of the value to erase
+     * @return true if there was a value with the given id
+     */
+    bool erase(backend_id_type const id) {
+        if (id == backend_id_type{}) [[unlikely]] {
+            return false;
+        }
+
+        auto const [shard_ix, local_id] = to_local_id(id);
+        auto &shard = shards_[shard_ix];
+
+        std::unique_lock lock{shard.mutex};
+        if (!shard.mapping.contains(local_id)) {
+            return false;
+        }
+
+        shard.mapping.retire_assume_present(local_id);
+        return true;
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        size_t ret = 0;
+        for (size_t ix = 0; ix < shard_count(); ++ix) {
+            std::shared_lock lock{shards_[ix].mutex};
+            ret += shards_[ix].mapping.size();
+        }
+        return ret;
+    }
+
+    /**
+     * Requests the removal of unused capacity and destroys all erased values.
+     * Must not run concurrently with lookup_value().
+     */
+    void shrink_to_fit() {
+        for (size_t ix = 0; ix < shard_count(); ++ix) {
+            std::unique_lock lock{shards_[ix].mutex};
+            shards_[ix].shrink_to_fit();
+        }
+    }
+
+    /**
+     * Translates the given backend_id_type into a NodeBackendID
+     */
+    static identifier::NodeBackendID from_storage_id(backend_id_type const id, backend_view_type const &view) noexcept {
+        return shard_type::from_storage_id(id, view);
+    }
+
+    /**
+     * Translates the given NodeBackendID into a backend_id_type
+     */
+    static backend_id_type to_storage_id(identifier::NodeBackendID const id) noexcept {
+        return shard_type::to_storage_id(id);
+    }
+
+    /**
+     * Gets the default value for the view type of this backend
+     */
+    static backend_view_type get_default_view() noexcept {
+        return shard_type::get_default_view();
+    }
+};
+
+}  // namespace rdf4cpp::storage::reference_node_storage
+
+#endif  //RDF4CPP_SHARDEDNODETYPESTORAGE_HPP
@@ -1,11 +1,14 @@
 #ifndef RDF4CPP_REFERENCENODESTORAGE_COMMON_HPP
 #define RDF4CPP_REFERENCENODESTORAGE_COMMON_HPP
 
+#include <optional>
+#include <span>
 #include <tuple>
 #include <utility>
 #include <dice/template-library/tuple_algorithm.hpp>
 #include <rdf4cpp/datatypes/xsd.hpp>
 #include <rdf4cpp/storage/identifier/LiteralType.hpp>
+#include <rdf4cpp/storage/view/LiteralBackendView.hpp>
 
 namespace rdf4cpp::storage::reference_node_storage::specialization_detail {
 
@@ -86,6 +89,40 @@ decltype(auto) visit_specialized(S &&container, identifier::LiteralType const da
     }
 }
 
+/**
+ * Splits a batch of literal views into maximal runs of consecutive views that belong into the same storage
+ * (i.e. the fallback storage or one of the specialized storages) and calls f for every run.
+ *
+ * @param views the batch of literal views
+ * @param f function that is called as f(run_begin, run_end, datatype) for every run, where datatype is the datatype of the
+ *          specialized storage of the run or nullopt if the run belongs into the fallback storage
+ */
+template<typename F>
+void for_each_literal_storage_run(std::span<view::LiteralBackendView const> const views, F f) {
+    auto const storage_datatype_of = [](view::LiteralBackendView const &view) noexcept -> std::optional<identifier::LiteralType> {
+        return view.visit(
+                [](view::LexicalFormLiteralBackendView const &) noexcept -> std::optional<identifier::LiteralType> {
+                    return std::nullopt;
+                },
+                [](view::ValueLiteralBackendView const &any) noexcept -> std::optional<identifier::LiteralType> {
+                    return any.datatype;
+                });
+    };
+
+    size_t run_begin = 0;
+    while (run_begin < views.size()) {
+        auto const datatype = storage_datatype_of(views[run_begin]);
+
+        auto run_end = run_begin + 1;
+        while (run_end < views.size() && storage_datatype_of(views[run_end]) == datatype) {
+            ++run_end;
+        }
+
+        f(run_begin, run_end, datatype);
+        run_begin = run_end;
+    }
+}
+
 } // rdf4cpp::storage::reference_node_storage::specialization_detail
 
 #endif  //RDF4CPP_REFERENCENODESTORAGE_COMMON_HPP
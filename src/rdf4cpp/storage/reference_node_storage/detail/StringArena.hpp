@@ -0,0 +1,271 @@
+#ifndef RDF4CPP_RDF_REFERENCENODESTORAGE_STRINGARENA_HPP
+#define RDF4CPP_RDF_REFERENCENODESTORAGE_STRINGARENA_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace rdf4cpp::storage::reference_node_storage::detail {
+
+/**
+ * An append-only, chunked arena for string data.
+ *
+ * Small strings are bump-allocated from fixed-size chunks, which avoids one heap allocation per stored string.
+ * Large strings (see large_string_threshold) are allocated directly from the heap.
+ * Every chunk counts its live strings, chunks without any live strings are released by shrink_to_fit().
+ * Strings are never relocated, i.e. views into them stay valid until they are deallocated.
+ *
+ * Chunks are aligned to their size, so that deallocate() can find the chunk of a string without
+ * having access to the arena. This means strings do not need to store a pointer to their arena.
+ *
+ * Not thread-safe, all operations (including deallocate()) need to be externally synchronized.
+ */
+struct StringArena {
+    static constexpr size_t chunk_size = size_t{1} << 16;
+    static constexpr size_t large_string_threshold = chunk_size / 16;
+
+private:
+    struct chunk_header {
+        size_t live_strings; //< number of strings in this chunk that were not deallocated yet
+    };
+
+    static constexpr size_t chunk_data_offset = sizeof(chunk_header);
+    static constexpr std::align_val_t chunk_alignment{chunk_size};
+
+    std::vector<chunk_header *> chunks_; //< all chunks, the last one is the one currently allocated from
+    char *cursor_ = nullptr;             //< next free byte in the current chunk
+    char *end_ = nullptr;                //< end of the current chunk
+
+    [[nodiscard]] static chunk_header *chunk_of(char const *data) noexcept {
+        return reinterpret_cast<chunk_header *>(reinterpret_cast<uintptr_t>(data) & ~(chunk_size - 1));
+    }
+
+    static void deallocate_chunk(chunk_header *chunk) noexcept {
+        chunk->~chunk_header();
+        ::operator delete(chunk, chunk_size, chunk_alignment);
+    }
+
+    void allocate_chunk() {
+        chunks_.reserve(chunks_.size() + 1);
+
+        auto *mem = static_cast<char *>(::operator new(chunk_size, chunk_alignment));
+        chunks_.push_back(new (mem) chunk_header{.live_strings = 0});
+
+        cursor_ = mem + chunk_data_offset;
+        end_ = mem + chunk_size;
+    }
+
+public:
+    StringArena() noexcept = default;
+
+    // deleted because strings point into the arena
+    StringArena(StringArena const &) = delete;
+    StringArena(StringArena &&) = delete;
+    StringArena &operator=(StringArena const &) = delete;
+    StringArena &operator=(StringArena &&) = delete;
+
+    ~StringArena() {
+        for (auto *chunk : chunks_) {
+            deallocate_chunk(chunk);
+        }
+    }
+
+    /**
+     * Allocates a copy of the given string.
+     *
+     * @param sv string to copy into the arena
+     * @return pointer to the copy (nullptr if sv is empty). Needs to be deallocated with deallocate(ptr, sv.size()).
+     */
+    [[nodiscard]] char const *allocate(std::string_view const sv) {
+        if (sv.empty()) {
+            return nullptr;
+        }
+
+        char *data;
+        if (sv.size() >= large_string_threshold) {
+            data = new char[sv.size()];
+        } else {
+            if (static_cast<size_t>(end_ - cursor_) < sv.size()) {
+                allocate_chunk();
+            }
+
+            data = std::exchange(cursor_, cursor_ + sv.size());
+            ++chunks_.back()->live_strings;
+        }
+
+        memcpy(data, sv.data(), sv.size());
+        return data;
+    }
+
+    /**
+     * Deallocates a string previously allocated with allocate().
+     * The memory of chunks is only released by shrink_to_fit().
+     *
+     * @param data pointer returned by allocate()
+     * @param size size of the string
+     */
+    static void deallocate(char const *data, size_t const size) noexcept {
+        if (data == nullptr) {
+            return;
+        }
+
+        if (size >= large_string_threshold) {
+            delete[] data;
+            return;
+        }
+
+        auto *chunk = chunk_of(data);
+        assert(chunk->live_strings > 0);
+        --chunk->live_strings;
+    }
+
+    /**
+     * Releases all chunks that do not contain any live strings anymore.
+     */
+    void shrink_to_fit() {
+        auto const current = chunks_.empty() ? nullptr : chunks_.back();
+
+        auto const new_end = std::remove_if(chunks_.begin(), chunks_.end(), [current](chunk_header *chunk) noexcept {
+            if (chunk == current || chunk->live_strings > 0) {
+                return false;
+            }
+
+            deallocate_chunk(chunk);
+            return true;
+        });
+
+        chunks_.erase(new_end, chunks_.end());
+        chunks_.shrink_to_fit();
+    }
+
+    /**
+     * Number of chunks currently allocated
+     */
+    [[nodiscard]] size_t chunk_count() const noexcept {
+        return chunks_.size();
+    }
+};
+
+/**
+ * Allocator that allocates like std::allocator, but additionally carries a StringArena.
+ * Values that are constructed using uses-allocator construction (i.e. the Node Backends inside of a BiDirFlatMap)
+ * can place their string data into that arena.
+ */
+template<typename T>
+struct ArenaAllocator {
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+private:
+    template<typename>
+    friend struct ArenaAllocator;
+
+    StringArena *arena_;
+
+public:
+    explicit ArenaAllocator(StringArena &arena) noexcept : arena_{&arena} {
+    }
+
+    template<typename U>
+    ArenaAllocator(ArenaAllocator<U> const &other) noexcept : arena_{other.arena_} {
+    }
+
+    [[nodiscard]] T *allocate(size_t const n) {
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *ptr, size_t const n) noexcept {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    [[nodiscard]] StringArena &arena() const noexcept {
+        return *arena_;
+    }
+
+    template<typename U>
+    bool operator==(ArenaAllocator<U> const &other) const noexcept {
+        return arena_ == other.arena_;
+    }
+};
+
+/**
+ * A constant-size (i.e. non-growing) string that lives in a StringArena.
+ * In contrast to ConstString it does not need to store an allocator, it consists only of a pointer and a size.
+ */
+struct ArenaString {
+    using value_type = char;
+    using size_type = size_t;
+
+private:
+    char const *data_;
+    size_type size_;
+
+public:
+    ArenaString(std::string_view const sv, StringArena &arena) : data_{arena.allocate(sv)},
+                                                                 size_{sv.size()} {
+    }
+
+    // prevent copy constructors from being accidentally called
+    ArenaString(ArenaString const &) = delete;
+    ArenaString &operator=(ArenaString const &) = delete;
+
+    ArenaString(ArenaString &&other) noexcept : data_{std::exchange(other.data_, nullptr)},
+                                                size_{std::exchange(other.size_, 0)} {
+    }
+
+    ArenaString &operator=(ArenaString &&other) noexcept {
+        assert(this != &other);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+
+    ~ArenaString() {
+        StringArena::deallocate(data_, size_);
+    }
+
+    [[nodiscard]] char const *data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    operator std::string_view() const noexcept {
+        return {data_, size_};
+    }
+
+    bool operator==(ArenaString const &other) const noexcept {
+        return static_cast<std::string_view>(*this) == static_cast<std::string_view>(other);
+    }
+
+    std::strong_ordering operator<=>(ArenaString const &other) const noexcept {
+        return static_cast<std::string_view>(*this) <=> static_cast<std::string_view>(other);
+    }
+
+    friend bool operator==(ArenaString const &self, std::string_view const other) noexcept {
+        return static_cast<std::string_view>(self) == other;
+    }
+
+    friend std::strong_ordering operator<=>(ArenaString const &self, std::string_view const other) noexcept {
+        return static_cast<std::string_view>(self) <=> other;
+    }
+};
+
+} // namespace rdf4cpp::storage::reference_node_storage::detail
+
+#endif // RDF4CPP_RDF_REFERENCENODESTORAGE_STRINGARENA_HPP
@@ -5,6 +5,7 @@
 #include <dice/sparse-map/sparse_map.hpp>
 #include <rdf4cpp/storage/identifier/NodeID.hpp>
 #include <rdf4cpp/storage/reference_node_storage/detail/BiDirFlatMap.hpp>
+#include <rdf4cpp/storage/reference_node_storage/detail/StringArena.hpp>
 
 #include <memory>
 
@@ -91,7 +92,18 @@ public:
         }
     }
 
-    detail::BiDirFlatMap<backend_id_type, backend_type, backend_view_type, backend_hasher, backend_equal> mapping;
+    using allocator_type = detail::ArenaAllocator<backend_type>;
+
+    detail::StringArena arena; //< string data of the backends in mapping, must outlive mapping
+    detail::BiDirFlatMap<backend_id_type, backend_type, backend_view_type, backend_hasher, backend_equal, allocator_type> mapping{allocator_type{arena}};
+
+    /**
+     * Requests the removal of unused capacity, including chunks of the arena that do not contain live strings anymore
+     */
+    void shrink_to_fit() {
+        mapping.shrink_to_fit();
+        arena.shrink_to_fit();
+    }
 };
 
 }  // namespace rdf4cpp::storage::reference_node_storage
@@ -1,12 +1,12 @@
 #ifndef RDF4CPP_LITERALBACKENDHANDLE_HPP
 #define RDF4CPP_LITERALBACKENDHANDLE_HPP
 
+#include <rdf4cpp/datatypes/registry/AnyValue.hpp>
 #include <rdf4cpp/storage/identifier/NodeBackendID.hpp>
 
 #include <dice/hash.hpp>
 #include <dice/template-library/overloaded.hpp>
 
-#include <any>
 #include <string_view>
 
 namespace rdf4cpp::storage::view {
@@ -23,16 +23,16 @@ struct LexicalFormLiteralBackendView {
 
 struct ValueLiteralBackendView {
     identifier::LiteralType datatype;
-    std::any value;
+    datatypes::registry::AnyValue value;
 
     template<datatypes::FixedIdLiteralDatatype Contained>
     [[nodiscard]] bool eq(typename Contained::cpp_type const &other) const noexcept {
-        return *std::any_cast<typename Contained::cpp_type>(&value) == other;
+        return *datatypes::registry::any_cast<typename Contained::cpp_type>(&value) == other;
     }
 
     template<datatypes::FixedIdLiteralDatatype Contained>
     [[nodiscard]] size_t hash() const noexcept {
-        return dice::hash::dice_hash_templates<::dice::hash::Policies::wyhash>::dice_hash(*std::any_cast<typename Contained::cpp_type>(&value));
+        return dice::hash::dice_hash_templates<::dice::hash::Policies::wyhash>::dice_hash(*datatypes::registry::any_cast<typename Contained::cpp_type>(&value));
     }
 };
 
@@ -0,0 +1,282 @@
+#include "CompressingWriter.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <zlib.h>
+#include <zstd.h>
+
+namespace rdf4cpp::writer {
+
+namespace {
+
+/**
+ * Streaming encoder for one compression format
+ */
+struct Encoder {
+    virtual ~Encoder() = default;
+
+    /**
+     * Compresses in and writes the compressed output to file
+     *
+     * @param finish if true, ends the compressed stream
+     * @param scratch buffer for compressed output
+     * @return true on success
+     */
+    virtual bool compress(char const *in, size_t size, bool finish, FILE *file, std::vector<char> &scratch) noexcept = 0;
+};
+
+struct GzipEncoder final : Encoder {
+    z_stream z_{};
+
+    explicit GzipEncoder(std::optional<int> const level) {
+        // 16: write gzip header
+        if (deflateInit2(&z_, level.value_or(Z_DEFAULT_COMPRESSION), Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error{"unable to initialize gzip encoder"};
+        }
+    }
+
+    ~GzipEncoder() override {
+        deflateEnd(&z_);
+    }
+
+    bool compress(char const *in, size_t const size, bool const finish, FILE *file, std::vector<char> &scratch) noexcept override {
+        z_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(in));
+        z_.avail_in = static_cast<uInt>(size);
+
+        while (true) {
+            z_.next_out = reinterpret_cast<Bytef *>(scratch.data());
+            z_.avail_out = static_cast<uInt>(scratch.size());
+
+            auto const ret = deflate(&z_, finish ? Z_FINISH : Z_NO_FLUSH);
+            if (ret == Z_STREAM_ERROR) {
+                return false;
+            }
+
+            auto const have = scratch.size() - z_.avail_out;
+            if (fwrite(scratch.data(), 1, have, file) != have) {
+                return false;
+            }
+
+            // without finish all input is consumed as soon as deflate leaves output space unused
+            if (finish ? ret == Z_STREAM_END : z_.avail_out != 0) {
+                return true;
+            }
+        }
+    }
+};
+
+struct ZstdEncoder final : Encoder {
+    ZSTD_CCtx *z_;
+
+    explicit ZstdEncoder(std::optional<int> const level) : z_{ZSTD_createCCtx()} {
+        if (z_ == nullptr) {
+            throw std::runtime_error{"unable to initialize zstd encoder"};
+        }
+
+        if (level.has_value() && ZSTD_isError(ZSTD_CCtx_setParameter(z_, ZSTD_c_compressionLevel, *level))) {
+            ZSTD_freeCCtx(z_);
+            throw std::runtime_error{"invalid zstd compression level"};
+        }
+    }
+
+    ~ZstdEncoder() override {
+        ZSTD_freeCCtx(z_);
+    }
+
+    bool compress(char const *in, size_t const size, bool const finish, FILE *file, std::vector<char> &scratch) noexcept override {
+        ZSTD_inBuffer in_buf{.src = in, .size = size, .pos = 0};
+
+        while (true) {
+            ZSTD_outBuffer out_buf{.dst = scratch.data(), .size = scratch.size(), .pos = 0};
+
+            auto const remaining = ZSTD_compressStream2(z_, &out_buf, &in_buf, finish ? ZSTD_e_end : ZSTD_e_continue);
+            if (ZSTD_isError(remaining)) {
+                return false;
+            }
+
+            if (fwrite(scratch.data(), 1, out_buf.pos, file) != out_buf.pos) {
+                return false;
+            }
+
+            if (finish ? remaining == 0 : in_buf.pos == in_buf.size) {
+                return true;
+            }
+        }
+    }
+};
+
+} // namespace
+
+struct CompressingBuffer::Impl {
+    static constexpr size_t scratch_size = 1 << 17;
+
+    FILE *file;
+    std::unique_ptr<Encoder> encoder;
+    std::vector<char> scratch;
+    size_t buffer_size;
+    std::array<std::unique_ptr<char[]>, 2> buffers;
+    size_t active = 0; //< index of the buffer that is currently filled by the writer
+    bool finished = false;
+    bool background;
+
+    std::mutex mutex;
+    std::condition_variable_any cv;
+    // protected by mutex if background is set
+    bool pending = false;    //< the inactive buffer is waiting to be compressed by the background thread
+    size_t pending_size = 0; //< number of bytes in the inactive buffer
+    bool failed = false;
+
+    std::jthread worker; //< must be the last member, so that it is joined before everything else is destroyed
+
+    Impl(FILE *file, CompressionFormat const format, Options const &options)
+        : file{file},
+          scratch(scratch_size),
+          buffer_size{options.buffer_size},
+          background{options.background} {
+        if (buffer_size == 0 || buffer_size > std::numeric_limits<uint32_t>::max()) {
+            throw std::invalid_argument{"buffer size must be greater than 0 and representable in 32 bits"};
+        }
+
+        switch (format) {
+            case CompressionFormat::Gzip:
+                encoder = std::make_unique<GzipEncoder>(options.level);
+                break;
+            case CompressionFormat::Zstd:
+                encoder = std::make_unique<ZstdEncoder>(options.level);
+                break;
+            default:
+                throw std::invalid_argument{"unknown compression format"};
+        }
+
+        buffers[0] = std::make_unique_for_overwrite<char[]>(buffer_size);
+        if (background) {
+            buffers[1] = std::make_unique_for_overwrite<char[]>(buffer_size);
+            worker = std::jthread{[this](std::stop_token const &stop) {
+                run(stop);
+            }};
+        }
+    }
+
+    void run(std::stop_token const &stop) noexcept {
+        while (true) {
+            std::unique_lock lock{mutex};
+            if (!cv.wait(lock, stop, [this]() { return pending; })) {
+                return; // stop requested
+            }
+
+            // the writer does not touch the inactive buffer while it is pending
+            auto const *data = buffers[active ^ 1].get();
+            auto const size = pending_size;
+            lock.unlock();
+
+            auto const ok = encoder->compress(data, size, false, file, scratch);
+
+            lock.lock();
+            failed |= !ok;
+            pending = false;
+            lock.unlock();
+            cv.notify_all();
+        }
+    }
+
+    /**
+     * Waits until the background thread (if any) is idle
+     */
+    void wait_idle() noexcept {
+        if (background) {
+            std::unique_lock lock{mutex};
+            cv.wait(lock, [this]() { return !pending; });
+        }
+    }
+
+    /**
+     * Compresses the first filled bytes of the active buffer
+     *
+     * @return the start of the next buffer to fill, nullptr on failure
+     */
+    char *submit(size_t const filled) noexcept {
+        if (!background) {
+            failed |= !encoder->compress(buffers[active].get(), filled, false, file, scratch);
+            return failed ? nullptr : buffers[active].get();
+        }
+
+        std::unique_lock lock{mutex};
+        cv.wait(lock, [this]() { return !pending; });
+        if (failed) {
+            return nullptr;
+        }
+
+        pending = true;
+        pending_size = filled;
+        active ^= 1;
+        lock.unlock();
+        cv.notify_all();
+
+        return buffers[active].get();
+    }
+
+    /**
+     * Compresses the first filled bytes of the active buffer and ends the compressed stream
+     */
+    bool finish(size_t const filled) noexcept {
+        wait_idle(); // after this the background thread does not touch anything anymore
+
+        if (!finished && !failed) {
+            failed |= !encoder->compress(buffers[active].get(), filled, true, file, scratch);
+        }
+
+        finished = true;
+        return !failed;
+    }
+};
+
+CompressingBuffer::CompressingBuffer(FILE *file, CompressionFormat const format, Options const &options)
+    : impl_{std::make_unique<Impl>(file, format, options)} {
+}
+
+CompressingBuffer::CompressingBuffer(CompressingBuffer &&other) noexcept = default;
+CompressingBuffer &CompressingBuffer::operator=(CompressingBuffer &&other) noexcept = default;
+CompressingBuffer::~CompressingBuffer() = default;
+
+char *CompressingBuffer::data() const noexcept {
+    return impl_->buffers[impl_->active].get();
+}
+
+size_t CompressingBuffer::size() const noexcept {
+    return impl_->buffer_size;
+}
+
+BufCompressingFileWriter::BufCompressingFileWriter(FILE *file, CompressionFormat const format, Options const &options)
+    : BufWriterBase<BufCompressingFileWriter, CompressingBuffer>{file, format, options} {
+    write_area() = buffer().data();
+    write_area_size() = buffer().size();
+}
+
+bool BufCompressingFileWriter::finalize() noexcept {
+    auto const ok = buffer().impl_->finish(static_cast<size_t>(write_area() - buffer().data()));
+
+    // everything is written
+    write_area() = buffer().data();
+    write_area_size() = 0;
+    return ok;
+}
+
+void BufCompressingFileWriter::flush_impl(Buffer &buffer, char *&write_area, size_t &write_area_size, [[maybe_unused]] size_t additional_cap) noexcept {
+    auto *next = buffer.impl_->submit(static_cast<size_t>(write_area - buffer.data()));
+    if (next == nullptr) {
+        write_area_size = 0;
+        return;
+    }
+
+    write_area = next;
+    write_area_size = buffer.size();
+}
+
+}  // namespace rdf4cpp::writer
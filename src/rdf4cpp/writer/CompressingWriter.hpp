@@ -0,0 +1,92 @@
+#ifndef RDF4CPP_WRITER_COMPRESSINGWRITER_HPP
+#define RDF4CPP_WRITER_COMPRESSINGWRITER_HPP
+
+#include <rdf4cpp/writer/BufWriter.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+
+namespace rdf4cpp::writer {
+
+/**
+ * Output compression formats supported by BufCompressingFileWriter
+ */
+enum struct CompressionFormat : uint8_t {
+    Gzip,
+    Zstd,
+};
+
+struct CompressingBuffer {
+    struct Impl; //< implementation detail
+
+    std::unique_ptr<Impl> impl_;
+
+    struct Options {
+        std::optional<int> level;     //< compression level, the default level of the format if not set
+        size_t buffer_size = 1 << 20; //< size of the (uncompressed) buffer that is compressed at once
+        bool background = false;      //< if true, full buffers are compressed and written on a background thread while the next one is filled
+    };
+
+    CompressingBuffer(FILE *file, CompressionFormat format, Options const &options);
+    CompressingBuffer(CompressingBuffer &&other) noexcept;
+    CompressingBuffer &operator=(CompressingBuffer &&other) noexcept;
+    ~CompressingBuffer();
+
+    /**
+     * @return the start of the current (uncompressed) buffer
+     */
+    [[nodiscard]] char *data() const noexcept;
+
+    /**
+     * @return the size of each buffer
+     */
+    [[nodiscard]] size_t size() const noexcept;
+};
+
+/**
+ * A serializer that compresses its output and writes it to a C FILE.
+ * Each time the buffer is full it is compressed directly, i.e. without an intermediate uncompressed copy of the output.
+ * With Options::background the compression of a full buffer overlaps with filling the next one.
+ *
+ * finalize must be called to complete the compressed stream. It does not close the file.
+ *
+ * @example
+ * @code
+ * FILE *file = fopen("data.nt.zst", "w");
+ * BufCompressingFileWriter w{file, CompressionFormat::Zstd, {.background = true}};
+ * dataset.serialize(w);
+ * w.finalize();
+ * fclose(file);
+ * @endcode
+ *
+ * Implements `BufWriter`
+ */
+struct BufCompressingFileWriter : BufWriterBase<BufCompressingFileWriter, CompressingBuffer> {
+    using Buffer = CompressingBuffer;
+    using Options = CompressingBuffer::Options;
+
+    /**
+     * @param file file to write the compressed output to
+     * @param format compression format
+     * @param options see CompressingBuffer::Options
+     * @throws std::invalid_argument if the buffer size is 0 or not representable in 32 bits
+     * @throws std::runtime_error if the compressor cannot be initialized
+     */
+    BufCompressingFileWriter(FILE *file, CompressionFormat format, Options const &options = {});
+
+    /**
+     * Compresses and writes the remaining buffer contents and ends the compressed stream
+     *
+     * @return true if all output was successfully written
+     */
+    bool finalize() noexcept;
+
+    static void flush_impl(Buffer &buffer, char *&write_area, size_t &write_area_size, size_t additional_cap) noexcept;
+};
+
+}  // namespace rdf4cpp::writer
+
+#endif  //RDF4CPP_WRITER_COMPRESSINGWRITER_HPP
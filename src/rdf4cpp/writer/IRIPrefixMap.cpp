@@ -0,0 +1,182 @@
+#include "IRIPrefixMap.hpp"
+
+#include <rdf4cpp/util/CharMatcher.hpp>
+#include <rdf4cpp/writer/Prefixes.hpp>
+#include <rdf4cpp/writer/TryWrite.hpp>
+
+#include <uni_algo/all.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace rdf4cpp::writer {
+
+/**
+ * @return true if prefix matches PN_PREFIX (or is empty)
+ */
+static bool is_valid_prefix(std::string_view const prefix) noexcept {
+    using namespace util::char_matcher_detail;
+    static constexpr auto pn_matcher = PNCharsMatcher | ASCIIPatternMatcher{"."};
+
+    auto r = prefix | una::views::utf8;
+    auto it = r.begin();
+    if (it == r.end()) {
+        return true;
+    }
+
+    if (!PNCharsBaseMatcher.match(*it)) {
+        return false;
+    }
+
+    auto lastchar = *it;
+    for (++it; it != r.end(); ++it) {
+        if (!pn_matcher.match(*it)) {
+            return false;
+        }
+        lastchar = *it;
+    }
+
+    return lastchar != '.';
+}
+
+static constexpr bool is_hex(char const c) noexcept {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool IRIPrefixMap::is_valid_local(std::string_view const local) noexcept {
+    using namespace util::char_matcher_detail;
+    static constexpr auto first_matcher = PNCharsUMatcher | ASCIINumMatcher{} | ASCIIPatternMatcher{":"};
+    static constexpr auto matcher = PNCharsMatcher | ASCIIPatternMatcher{".:"};
+
+    for (size_t ix = 0; ix < local.size(); ++ix) {
+        auto const c = local[ix];
+
+        if (static_cast<unsigned char>(c) >= 0x80) {
+            return false;
+        }
+
+        if (c == '%') {
+            // PERCENT, valid anywhere
+            if (ix + 2 >= local.size() || !is_hex(local[ix + 1]) || !is_hex(local[ix + 2])) {
+                return false;
+            }
+            ix += 2;
+            continue;
+        }
+
+        if (ix == 0 ? !first_matcher.match(c) : !matcher.match(c)) {
+            return false;
+        }
+    }
+
+    return local.empty() || local.back() != '.';
+}
+
+IRIPrefixMap::IRIPrefixMap() {
+    for (auto const &p : iri_prefixes) {
+        namespaces_.emplace(p.prefix, p.shorthand);
+    }
+}
+
+IRIPrefixMap::IRIPrefixMap(IRIFactory const &factory) : IRIPrefixMap{} {
+    for (auto const &[prefix, namespace_iri] : factory) {
+        if (add(prefix, namespace_iri) != IRIFactoryError::Ok) {
+            throw std::invalid_argument{"invalid prefix: " + prefix};
+        }
+    }
+}
+
+IRIFactoryError IRIPrefixMap::add(std::string_view const prefix, std::string_view const namespace_iri) {
+    if (!is_valid_prefix(prefix)) {
+        return IRIFactoryError::InvalidPrefix;
+    }
+
+    // the fixed prefixes are always declared
+    for (auto const &p : iri_prefixes) {
+        if (p.shorthand == prefix) {
+            return p.prefix == namespace_iri ? IRIFactoryError::Ok : IRIFactoryError::InvalidPrefix;
+        }
+    }
+
+    if (auto const it = prefixes_.find(prefix); it != prefixes_.end()) {
+        return it->second == namespace_iri ? IRIFactoryError::Ok : IRIFactoryError::InvalidPrefix;
+    }
+
+    prefixes_.emplace(prefix, namespace_iri);
+    namespaces_.emplace(namespace_iri, prefix); // does not replace an existing namespace
+    return IRIFactoryError::Ok;
+}
+
+std::optional<IRIPrefixMap::CURIE> IRIPrefixMap::abbreviate(std::string_view const iri) const noexcept {
+    // a valid local part never contains '/' or '#', so only the namespaces ending at the last of them or at a ':' after it are candidates
+    for (auto pos = iri.size(); pos > 0; --pos) {
+        auto const c = iri[pos - 1];
+        if (c != '/' && c != '#' && c != ':') {
+            continue;
+        }
+
+        if (auto const it = namespaces_.find(iri.substr(0, pos)); it != namespaces_.end()) {
+            if (auto const local = iri.substr(pos); is_valid_local(local)) {
+                return CURIE{it->second, local};
+            }
+        }
+
+        if (c != ':') {
+            break;
+        }
+    }
+
+    return std::nullopt;
+}
+
+bool IRIPrefixMap::write_iri(std::string_view const iri, BufWriterParts const writer) const noexcept {
+    if (auto const curie = abbreviate(iri); curie.has_value()) {
+        RDF4CPP_DETAIL_TRY_WRITE_STR(curie->prefix);
+        RDF4CPP_DETAIL_TRY_WRITE_STR(":");
+        return write_str(curie->local, writer);
+    }
+
+    RDF4CPP_DETAIL_TRY_WRITE_STR("<");
+    RDF4CPP_DETAIL_TRY_WRITE_STR(iri);
+    return write_str(">", writer);
+}
+
+void PrefixDiscovery::sample(std::string_view const iri) {
+    auto const pos = iri.find_last_of("/#");
+    if (pos == std::string_view::npos || !IRIPrefixMap::is_valid_local(iri.substr(pos + 1))) {
+        return;
+    }
+
+    auto const namespace_iri = iri.substr(0, pos + 1);
+    for (auto const &p : iri_prefixes) {
+        if (p.prefix == namespace_iri) {
+            return;
+        }
+    }
+
+    ++counts_[std::string{namespace_iri}];
+}
+
+IRIPrefixMap PrefixDiscovery::finish(size_t const max_prefixes) const {
+    std::vector<std::pair<std::string_view, size_t>> frequent;
+    for (auto const &[namespace_iri, count] : counts_) {
+        if (count >= min_occurrences) {
+            frequent.emplace_back(namespace_iri, count);
+        }
+    }
+
+    // ties are broken by namespace to make the result deterministic
+    std::ranges::sort(frequent, [](auto const &a, auto const &b) noexcept {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+
+    IRIPrefixMap ret;
+    for (size_t ix = 0; ix < std::min(max_prefixes, frequent.size()); ++ix) {
+        (void) ret.add("ns" + std::to_string(ix), frequent[ix].first); // cannot fail, names are unique and valid
+    }
+
+    return ret;
+}
+
+}  // namespace rdf4cpp::writer
@@ -0,0 +1,116 @@
+#ifndef RDF4CPP_WRITER_IRIPREFIXMAP_HPP
+#define RDF4CPP_WRITER_IRIPREFIXMAP_HPP
+
+#include <rdf4cpp/IRIFactory.hpp>
+#include <rdf4cpp/writer/BufWriter.hpp>
+
+#include <boost/container/flat_map.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace rdf4cpp::writer {
+
+/**
+ * A prefix map used by the Turtle and TriG writers to abbreviate IRIs as prefixed names (CURIEs),
+ * see SerializationState::prefixes.
+ *
+ * An IRI is abbreviated if it can be split after a '/', '#' or ':' into a namespace that is in this map
+ * and a local part that is a valid PN_LOCAL (without escape sequences, non-ASCII local parts are not abbreviated).
+ * The fixed xsd and rdf prefixes (which are always declared by SerializationState::begin) are used for abbreviation
+ * but are not part of the declarations of this map.
+ */
+struct IRIPrefixMap {
+    using prefix_map_type = boost::container::flat_map<std::string, std::string, std::less<>>;
+
+    struct CURIE {
+        std::string_view prefix;
+        std::string_view local;
+    };
+
+private:
+    prefix_map_type prefixes_;   //< prefix -> namespace, the declarations in the order they are written
+    prefix_map_type namespaces_; //< namespace -> prefix, including the fixed prefixes
+
+public:
+    /**
+     * Creates a map that only contains the fixed xsd and rdf prefixes
+     */
+    IRIPrefixMap();
+
+    /**
+     * Creates a map containing all prefixes of factory
+     *
+     * @throws std::invalid_argument if one of the prefixes is invalid (see add)
+     */
+    explicit IRIPrefixMap(IRIFactory const &factory);
+
+    /**
+     * Adds a prefix. If multiple prefixes have the same namespace, the one added first is used for abbreviation.
+     *
+     * @param prefix prefix name, must be a valid PN_PREFIX (or empty)
+     * @param namespace_iri the IRI the prefix expands to
+     * @return IRIFactoryError::InvalidPrefix if prefix is not valid or already bound to a different namespace, IRIFactoryError::Ok otherwise
+     */
+    IRIFactoryError add(std::string_view prefix, std::string_view namespace_iri);
+
+    /**
+     * @return the declared prefixes (prefix -> namespace), excluding the fixed prefixes
+     */
+    [[nodiscard]] prefix_map_type const &declarations() const noexcept {
+        return prefixes_;
+    }
+
+    /**
+     * Splits iri into a prefix of this map and a local part
+     *
+     * @return the prefixed name for iri, or std::nullopt if it cannot be abbreviated
+     */
+    [[nodiscard]] std::optional<CURIE> abbreviate(std::string_view iri) const noexcept;
+
+    /**
+     * Writes the prefixed name for iri if it can be abbreviated, otherwise iri in full form (<...>)
+     *
+     * @return true if writing was successful, false if a call to flush was not able to make room
+     */
+    bool write_iri(std::string_view iri, BufWriterParts writer) const noexcept;
+
+    /**
+     * @return true if local is a PN_LOCAL that does not need escape sequences
+     */
+    [[nodiscard]] static bool is_valid_local(std::string_view local) noexcept;
+};
+
+/**
+ * Collects the namespaces of a sample of IRIs to build an IRIPrefixMap of the most frequent ones.
+ * The namespace of an IRI is everything up to and including its last '/' or '#'.
+ * Namespaces of the fixed prefixes are not collected.
+ */
+struct PrefixDiscovery {
+    /**
+     * Minimum number of occurrences of a namespace for it to get a prefix, declaring rarer namespaces does not pay off
+     */
+    static constexpr size_t min_occurrences = 2;
+
+private:
+    std::unordered_map<std::string, size_t> counts_;
+
+public:
+    /**
+     * Counts the namespace of iri if the rest of iri is a valid local part
+     */
+    void sample(std::string_view iri);
+
+    /**
+     * @param max_prefixes maximum number of prefixes in the result
+     * @return an IRIPrefixMap containing the max_prefixes most frequent namespaces, named ns0, ns1, ... in order of descending frequency
+     */
+    [[nodiscard]] IRIPrefixMap finish(size_t max_prefixes) const;
+};
+
+}  // namespace rdf4cpp::writer
+
+#endif  //RDF4CPP_WRITER_IRIPREFIXMAP_HPP
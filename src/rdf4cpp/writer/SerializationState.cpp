@@ -16,6 +16,22 @@ bool SerializationState::begin(BufWriterParts const writer) noexcept {
     return true;
 }
 
+bool SerializationState::begin(BufWriterParts const writer, IRIPrefixMap const &prefixes) noexcept {
+    if (!begin(writer)) {
+        return false;
+    }
+
+    for (auto const &[prefix, namespace_iri] : prefixes.declarations()) {
+        RDF4CPP_DETAIL_TRY_WRITE_STR("@prefix ");
+        RDF4CPP_DETAIL_TRY_WRITE_STR(prefix);
+        RDF4CPP_DETAIL_TRY_WRITE_STR(": <");
+        RDF4CPP_DETAIL_TRY_WRITE_STR(namespace_iri);
+        RDF4CPP_DETAIL_TRY_WRITE_STR("> .\n");
+    }
+
+    return true;
+}
+
 bool SerializationState::flush(BufWriterParts const writer) noexcept {
     if (!active_predicate.null() || !active_subject.null()) {
         RDF4CPP_DETAIL_TRY_WRITE_STR(" .\n");
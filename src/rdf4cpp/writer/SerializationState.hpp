@@ -2,6 +2,7 @@
 #define RDF4CPP_SERIALIZATIONSTATE_HPP
 
 #include <rdf4cpp/Node.hpp>
+#include <rdf4cpp/writer/IRIPrefixMap.hpp>
 
 namespace rdf4cpp::writer {
 
@@ -10,7 +11,22 @@ struct SerializationState {
     Node active_subject;
     Node active_predicate;
 
+    /**
+     * If not null, IRIs are abbreviated using these prefixes, which must have been declared by begin(writer, *prefixes).
+     * Otherwise, IRIs are written in full form (except for the fixed xsd and rdf datatype IRIs of literals).
+     */
+    IRIPrefixMap const *prefixes = nullptr;
+
+    /**
+     * Writes the declarations of the fixed xsd and rdf prefixes
+     */
     static bool begin(BufWriterParts writer) noexcept;
+
+    /**
+     * Writes the declarations of the fixed xsd and rdf prefixes and of all prefixes in prefixes
+     */
+    static bool begin(BufWriterParts writer, IRIPrefixMap const &prefixes) noexcept;
+
     bool flush(BufWriterParts writer) noexcept;
 };
 
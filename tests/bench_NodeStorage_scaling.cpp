@@ -0,0 +1,83 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include <rdf4cpp.hpp>
+#include <rdf4cpp/storage/reference_node_storage/ShardedReferenceNodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rdf4cpp;
+
+static constexpr size_t iris_per_thread = 100'000;
+static constexpr size_t overlap_percent = 25; //< percentage of IRIs that every thread shares with all others
+
+/**
+ * Generates the IRIs that thread thread_ix inserts.
+ * Some of them are shared between all threads to also exercise the lookup path.
+ */
+static std::vector<std::string> make_iris(size_t const thread_ix) {
+    std::vector<std::string> ret;
+    ret.reserve(iris_per_thread);
+
+    for (size_t ix = 0; ix < iris_per_thread; ++ix) {
+        if (ix % 100 < overlap_percent) {
+            ret.push_back("http://example.com/shared/" + std::to_string(ix));
+        } else {
+            ret.push_back("http://example.com/" + std::to_string(thread_ix) + "/" + std::to_string(ix));
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * Inserts the IRIs of every thread concurrently into ns
+ */
+static void insert_concurrently(storage::DynNodeStoragePtr ns, std::vector<std::vector<std::string>> const &iris) {
+    std::vector<std::thread> threads;
+    threads.reserve(iris.size());
+
+    for (auto const &thread_iris : iris) {
+        threads.emplace_back([ns, &thread_iris]() mutable {
+            for (auto const &iri : thread_iris) {
+                ankerl::nanobench::doNotOptimizeAway(ns.find_or_make_id(storage::view::IRIBackendView{.identifier = iri}));
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+int main() {
+    size_t const max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t n_threads = 1; n_threads <= max_threads; n_threads *= 2) {
+        std::vector<std::vector<std::string>> iris;
+        for (size_t t = 0; t < n_threads; ++t) {
+            iris.push_back(make_iris(t));
+        }
+
+        ankerl::nanobench::Bench bench;
+        bench.title("IRI insertion with " + std::to_string(n_threads) + " threads")
+                .unit("IRI")
+                .batch(n_threads * iris_per_thread)
+                .relative(true);
+
+        bench.run("SyncReferenceNodeStorage", [&]() {
+            storage::reference_node_storage::SyncReferenceNodeStorage ns{};
+            insert_concurrently(ns, iris);
+        });
+
+        for (size_t shard_count : {4, 16, 64}) {
+            bench.run("ShardedReferenceNodeStorage (" + std::to_string(shard_count) + " shards)", [&]() {
+                storage::reference_node_storage::ShardedReferenceNodeStorage ns{shard_count};
+                insert_concurrently(ns, iris);
+            });
+        }
+    }
+}
@@ -0,0 +1,470 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include "bench_SyntheticRDF.hpp"
+
+#include <rdf4cpp.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/UnsyncReferenceNodeStorage.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <bzlib.h>
+#include <zlib.h>
+#include <zstd.h>
+
+/**
+ * Self-contained benchmark suite that does not need any external data.
+ * All inputs are generated by generate_synthetic_dataset.
+ *
+ * Usage: bench_Suite [scale] [output directory]
+ *  - scale: multiplies the size of the generated dataset (default 1)
+ *  - output directory: if given, the results of every suite are written to <output directory>/<suite>.json
+ */
+
+using namespace rdf4cpp;
+
+namespace {
+
+struct SerializedInput {
+    std::string name;
+    parser::ParsingFlags flags;
+    std::string data;
+};
+
+std::vector<Node> collect_nodes(Dataset const &ds) {
+    std::vector<Node> nodes;
+    for (auto const &quad : ds) {
+        nodes.push_back(quad.subject());
+        nodes.push_back(quad.predicate());
+        nodes.push_back(quad.object());
+    }
+    return nodes;
+}
+
+std::vector<SerializedInput> serialize_inputs(Dataset const &ds) {
+    std::vector<SerializedInput> inputs;
+
+    inputs.push_back(SerializedInput{"N-Triples", parser::ParsingFlag::NTriples, writer::StringWriter::oneshot([&](auto &w) {
+                                         return ds.find_graph()->serialize(w);
+                                     })});
+    inputs.push_back(SerializedInput{"Turtle", parser::ParsingFlag::Turtle, writer::StringWriter::oneshot([&](auto &w) {
+                                         return ds.find_graph()->serialize_turtle(w);
+                                     })});
+    inputs.push_back(SerializedInput{"N-Quads", parser::ParsingFlag::NQuads, writer::StringWriter::oneshot([&](auto &w) {
+                                         return ds.serialize(w);
+                                     })});
+    inputs.push_back(SerializedInput{"TriG", parser::ParsingFlag::TriG, writer::StringWriter::oneshot([&](auto &w) {
+                                         return ds.serialize_trig(w);
+                                     })});
+
+    return inputs;
+}
+
+void bench_parsing(ankerl::nanobench::Bench &bench, std::vector<SerializedInput> const &inputs) {
+    for (auto const &input : inputs) {
+        for (bool const trusted : {false, true}) {
+            auto const name = input.name + (trusted ? " (trusted)" : " (validating)");
+            auto const flags = trusted ? input.flags | parser::ParsingFlag::Trusted : input.flags;
+
+            bench.batch(input.data.size()).unit("byte").run(name, [&]() {
+                storage::reference_node_storage::UnsyncReferenceNodeStorage ns{};
+                parser::IStreamQuadIterator::state_type state{.node_storage = ns};
+
+                std::istringstream in{input.data};
+                size_t n = 0;
+                for (parser::IStreamQuadIterator qit{in, flags, &state}; qit != std::default_sentinel; ++qit) {
+                    n += qit->has_value();
+                }
+                ankerl::nanobench::doNotOptimizeAway(n);
+            });
+        }
+    }
+}
+
+void bench_file_input(ankerl::nanobench::Bench &bench, std::vector<SerializedInput> const &inputs) {
+    auto const base = std::filesystem::temp_directory_path() / "rdf4cpp-bench-file-input";
+    std::filesystem::create_directories(base);
+
+    for (auto const &input : inputs) {
+        auto const path = base / input.name;
+        std::ofstream{path} << input.data;
+
+        for (auto const mode : {parser::RDFFileParser::InputMode::Stream, parser::RDFFileParser::InputMode::MMap, parser::RDFFileParser::InputMode::Prefetch}) {
+            auto const name = input.name + [mode]() {
+                switch (mode) {
+                    case parser::RDFFileParser::InputMode::MMap:
+                        return " (mmap)";
+                    case parser::RDFFileParser::InputMode::Prefetch:
+                        return " (prefetch)";
+                    default:
+                        return " (fread)";
+                }
+            }();
+
+            bench.batch(input.data.size()).unit("byte").run(name, [&]() {
+                storage::reference_node_storage::UnsyncReferenceNodeStorage ns{};
+                parser::IStreamQuadIterator::state_type state{.node_storage = ns};
+
+                size_t n = 0;
+                for (auto const &quad : parser::RDFFileParser{path.string(), input.flags, &state, mode}) {
+                    n += quad.has_value();
+                }
+                ankerl::nanobench::doNotOptimizeAway(n);
+            });
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::remove_all(base, ec);
+    // ignore ec
+}
+
+std::string compress(parser::Compression const compression, std::string const &data) {
+    std::string out;
+
+    switch (compression) {
+        case parser::Compression::Gzip: {
+            z_stream z{};
+            deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY); // 16: write gzip header
+            out.resize(deflateBound(&z, data.size()));
+            z.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+            z.avail_in = static_cast<uInt>(data.size());
+            z.next_out = reinterpret_cast<Bytef *>(out.data());
+            z.avail_out = static_cast<uInt>(out.size());
+            deflate(&z, Z_FINISH);
+            out.resize(z.total_out);
+            deflateEnd(&z);
+            break;
+        }
+        case parser::Compression::Zstd: {
+            out.resize(ZSTD_compressBound(data.size()));
+            out.resize(ZSTD_compress(out.data(), out.size(), data.data(), data.size(), 3));
+            break;
+        }
+        case parser::Compression::BZip2: {
+            auto n = static_cast<unsigned>(data.size() + data.size() / 100 + 600);
+            out.resize(n);
+            BZ2_bzBuffToBuffCompress(out.data(), &n, const_cast<char *>(data.data()), static_cast<unsigned>(data.size()), 9, 0, 0);
+            out.resize(n);
+            break;
+        }
+        default: {
+            out = data;
+            break;
+        }
+    }
+
+    return out;
+}
+
+/**
+ * Measures decompression and parsing of compressed files separately
+ */
+void bench_compressed_input(ankerl::nanobench::Bench &bench, std::vector<SerializedInput> const &inputs) {
+    auto const base = std::filesystem::temp_directory_path() / "rdf4cpp-bench-compressed-input";
+    std::filesystem::create_directories(base);
+
+    std::string scratch;
+    scratch.resize(1 << 16);
+
+    for (auto const &input : inputs) {
+        for (auto const [compression, extension] : {std::pair{parser::Compression::Gzip, ".gz"},
+                                                    std::pair{parser::Compression::Zstd, ".zst"},
+                                                    std::pair{parser::Compression::BZip2, ".bz2"}}) {
+            auto const path = base / (input.name + extension);
+            {
+                auto const compressed = compress(compression, input.data);
+                std::ofstream{path, std::ios::binary}.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+            }
+
+            // batch is always the uncompressed size, so that throughputs are comparable
+            bench.batch(input.data.size()).unit("byte").run(input.name + extension + " (decompress)", [&]() {
+                FILE *file = parser::fopen_fastseq(path.c_str(), "r");
+                parser::DecompressingReader reader{file, reinterpret_cast<parser::ReadFunc>(&fread), reinterpret_cast<parser::ErrorFunc>(&ferror)};
+
+                size_t n = 0;
+                while (auto const m = parser::DecompressingReader::read(scratch.data(), 1, scratch.size(), &reader)) {
+                    n += m;
+                }
+                fclose(file);
+                ankerl::nanobench::doNotOptimizeAway(n);
+            });
+
+            for (auto const mode : {parser::RDFFileParser::InputMode::Stream, parser::RDFFileParser::InputMode::Prefetch}) {
+                auto const name = input.name + extension + (mode == parser::RDFFileParser::InputMode::Prefetch ? " (decompress + parse, prefetch)" : " (decompress + parse)");
+
+                bench.batch(input.data.size()).unit("byte").run(name, [&]() {
+                    storage::reference_node_storage::UnsyncReferenceNodeStorage ns{};
+                    parser::IStreamQuadIterator::state_type state{.node_storage = ns};
+
+                    size_t n = 0;
+                    for (auto const &quad : parser::RDFFileParser{path.string(), input.flags, &state, mode}) {
+                        n += quad.has_value();
+                    }
+                    ankerl::nanobench::doNotOptimizeAway(n);
+                });
+            }
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::remove_all(base, ec);
+    // ignore ec
+}
+
+void bench_serialization(ankerl::nanobench::Bench &bench, Dataset const &ds) {
+    std::string buf;
+    buf.resize(1 << 20);
+
+    auto const run = [&](std::string const &name, size_t const batch, auto &&ser) {
+        bench.batch(batch).unit("statement").run(name, [&]() {
+            writer::StringWriter w{buf};
+            ser(w);
+            w.finalize();
+            ankerl::nanobench::doNotOptimizeAway(w.view().size());
+            buf.resize(buf.capacity());
+        });
+    };
+
+    auto const &default_graph = *ds.find_graph();
+    run("N-Triples", default_graph.size(), [&](auto &w) { return default_graph.serialize(w); });
+    run("Turtle", default_graph.size(), [&](auto &w) { return default_graph.serialize_turtle(w); });
+    run("N-Quads", ds.size(), [&](auto &w) { return ds.serialize(w); });
+    run("TriG", ds.size(), [&](auto &w) { return ds.serialize_trig(w); });
+    run("Turtle (grouped)", default_graph.size(), [&](auto &w) { return default_graph.serialize_turtle_grouped(w); });
+    run("TriG (grouped)", ds.size(), [&](auto &w) { return ds.serialize_trig_grouped(w); });
+    run("Turtle (discovered prefixes)", default_graph.size(), [&](auto &w) { return default_graph.serialize_turtle(w, default_graph.discover_prefixes()); });
+    run("TriG (discovered prefixes)", ds.size(), [&](auto &w) { return ds.serialize_trig(w, ds.discover_prefixes()); });
+    run("N-Triples (parallel)", default_graph.size(), [&](auto &w) { return default_graph.serialize_parallel(w); });
+    run("N-Quads (parallel)", ds.size(), [&](auto &w) { return ds.serialize_parallel(w); });
+
+    // compressed output, compression cost dominates, so the file is discarded
+    FILE *null_file = fopen("/dev/null", "w");
+    for (auto const [format, format_name] : {std::pair{writer::CompressionFormat::Gzip, "gzip"}, std::pair{writer::CompressionFormat::Zstd, "zstd"}}) {
+        for (bool const background : {false, true}) {
+            auto const name = std::string{"N-Quads ("} + format_name + (background ? ", background)" : ")");
+
+            bench.batch(ds.size()).unit("statement").run(name, [&]() {
+                writer::BufCompressingFileWriter w{null_file, format, {.background = background}};
+                ds.serialize(w);
+                ankerl::nanobench::doNotOptimizeAway(w.finalize());
+            });
+        }
+    }
+    fclose(null_file);
+}
+
+template<typename NodeStorage>
+void bench_node_storage(ankerl::nanobench::Bench &bench, std::string const &name, std::vector<Node> const &nodes) {
+    bench.batch(nodes.size()).unit("node");
+
+    bench.run(name + " insert", [&]() {
+        NodeStorage ns{};
+        for (auto const &node : nodes) {
+            ankerl::nanobench::doNotOptimizeAway(node.to_node_storage(ns));
+        }
+    });
+
+    NodeStorage filled_ns{};
+    for (auto const &node : nodes) {
+        (void) node.to_node_storage(filled_ns);
+    }
+
+    bench.run(name + " lookup", [&]() {
+        for (auto const &node : nodes) {
+            ankerl::nanobench::doNotOptimizeAway(node.try_get_in_node_storage(filled_ns));
+        }
+    });
+}
+
+void bench_graph(ankerl::nanobench::Bench &bench, Dataset const &ds, storage::DynNodeStoragePtr ns) {
+    std::vector<Statement> statements;
+    for (auto const &quad : ds) {
+        statements.emplace_back(quad.subject(), quad.predicate(), quad.object());
+    }
+
+    bench.batch(statements.size()).unit("triple");
+
+    for (bool const indexed : {false, true}) {
+        std::string const suffix = indexed ? " (indexed)" : "";
+
+        bench.run("add" + suffix, [&]() {
+            Graph g{ns, indexed};
+            for (auto const &stmt : statements) {
+                g.add(stmt);
+            }
+        });
+
+        Graph g{ns, indexed};
+        for (auto const &stmt : statements) {
+            g.add(stmt);
+        }
+
+        bench.run("contains" + suffix, [&]() {
+            for (auto const &stmt : statements) {
+                ankerl::nanobench::doNotOptimizeAway(g.contains(stmt));
+            }
+        });
+
+        query::Variable const s{"s", false, ns};
+        query::Variable const o{"o", false, ns};
+        IRI const type{"http://www.w3.org/1999/02/22-rdf-syntax-ns#type", ns};
+        IRI const label{"http://www.w3.org/2000/01/rdf-schema#label", ns};
+
+        // the unindexed graph scans all triples for every pattern, so only a few patterns are used
+        std::vector<query::TriplePattern> patterns;
+        patterns.emplace_back(s, type, o);
+        patterns.emplace_back(s, label, o);
+        for (size_t ix = 0; ix < statements.size(); ix += statements.size() / 8 + 1) {
+            patterns.emplace_back(statements[ix].subject(), s, o);
+        }
+
+        bench.batch(patterns.size()).unit("pattern").run("match" + suffix, [&]() {
+            size_t n = 0;
+            for (auto const &pat : patterns) {
+                for ([[maybe_unused]] auto const &solution : g.match(pat)) {
+                    ++n;
+                }
+            }
+            ankerl::nanobench::doNotOptimizeAway(n);
+        });
+        bench.batch(statements.size()).unit("triple");
+    }
+}
+
+void bench_dataset(ankerl::nanobench::Bench &bench, Dataset const &ds) {
+    bench.batch(ds.size()).unit("quad").run("iteration", [&]() {
+        size_t n = 0;
+        for ([[maybe_unused]] auto const &quad : ds) {
+            ++n;
+        }
+        ankerl::nanobench::doNotOptimizeAway(n);
+    });
+}
+
+void bench_literal_ops(ankerl::nanobench::Bench &bench) {
+    static constexpr size_t num_values = 1 << 12;
+
+    std::vector<Literal> ints;
+    std::vector<Literal> doubles;
+    std::vector<Literal> dates;
+    for (size_t ix = 0; ix < num_values; ++ix) {
+        ints.push_back(Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int32_t>(ix)));
+        doubles.push_back(Literal::make_typed_from_value<datatypes::xsd::Double>(static_cast<double>(ix) / 4));
+        auto const day = std::to_string(ix % 19 + 10); // always two digits
+        dates.push_back(Literal::make_typed(std::to_string(1900 + ix % 200) + "-01-" + day, IRI{datatypes::xsd::Date::identifier}));
+    }
+
+    bench.batch(num_values - 1).unit("op");
+
+    auto const run_binop = [&](std::string const &name, std::vector<Literal> const &values, auto const &op) {
+        bench.run(name, [&]() {
+            for (size_t ix = 1; ix < values.size(); ++ix) {
+                ankerl::nanobench::doNotOptimizeAway(op(values[ix - 1], values[ix]));
+            }
+        });
+    };
+
+    run_binop("int add", ints, std::plus<>{});
+    run_binop("int mul", ints, std::multiplies<>{});
+    run_binop("double add", doubles, std::plus<>{});
+    run_binop("double div", doubles, std::divides<>{});
+    run_binop("int compare", ints, [](auto const &lhs, auto const &rhs) { return lhs.compare(rhs); });
+    run_binop("date compare", dates, [](auto const &lhs, auto const &rhs) { return lhs.compare(rhs); });
+}
+
+void write_results(std::filesystem::path const &out_dir, std::string const &suite, ankerl::nanobench::Bench const &bench) {
+    if (out_dir.empty()) {
+        return;
+    }
+
+    std::ofstream out{out_dir / (suite + ".json")};
+    ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, out);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    size_t const scale = argc > 1 ? std::stoull(argv[1]) : 1;
+    std::filesystem::path const out_dir = argc > 2 ? argv[2] : "";
+    if (!out_dir.empty()) {
+        std::filesystem::create_directories(out_dir);
+    }
+
+    bench::SyntheticConfig config{};
+    config.universities *= scale;
+    config.products *= scale;
+
+    storage::reference_node_storage::UnsyncReferenceNodeStorage ns{};
+    Dataset ds{ns};
+    bench::generate_synthetic_dataset(config, ds, ns);
+    std::cerr << "generated " << ds.size() << " quads\n";
+
+    auto const inputs = serialize_inputs(ds);
+    auto const nodes = collect_nodes(ds);
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("parsing");
+        bench_parsing(bench, inputs);
+        write_results(out_dir, "parsing", bench);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("file input");
+        bench_file_input(bench, inputs);
+        write_results(out_dir, "file_input", bench);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("compressed input");
+        bench_compressed_input(bench, inputs);
+        write_results(out_dir, "compressed_input", bench);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("serialization");
+        bench_serialization(bench, ds);
+        write_results(out_dir, "serialization", bench);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("node storage");
+        bench_node_storage<storage::reference_node_storage::UnsyncReferenceNodeStorage>(bench, "UnsyncReferenceNodeStorage", nodes);
+        bench_node_storage<storage::reference_node_storage::SyncReferenceNodeStorage>(bench, "SyncReferenceNodeStorage", nodes);
+        write_results(out_dir, "node_storage", bench);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("graph");
+        bench_graph(bench, ds, ns);
+        write_results(out_dir, "graph", bench);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("dataset");
+        bench_dataset(bench, ds);
+        write_results(out_dir, "dataset", bench);
+    }
+
+    {
+        ankerl::nanobench::Bench bench;
+        bench.title("literal ops");
+        bench_literal_ops(bench);
+        write_results(out_dir, "literal_ops", bench);
+    }
+}
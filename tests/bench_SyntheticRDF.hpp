@@ -0,0 +1,185 @@
+#ifndef RDF4CPP_TESTS_BENCH_SYNTHETICRDF_HPP
+#define RDF4CPP_TESTS_BENCH_SYNTHETICRDF_HPP
+
+#include <rdf4cpp.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rdf4cpp::bench {
+
+/**
+ * Configuration of the synthetic data generator
+ */
+struct SyntheticConfig {
+    size_t universities = 2;             //< number of LUBM-like universities, each with departments, professors, students and courses
+    size_t products = 2'000;             //< number of BSBM-like products, each with a producer, features and reviews
+    size_t named_graphs = 4;             //< quads are distributed over this many named graphs plus the default graph
+    uint32_t bnode_percent = 10;         //< percentage of entities (students, reviews) that are identified by blank nodes instead of IRIs
+    uint32_t long_literal_percent = 20;  //< percentage of textual literals that are too long to be inlined
+    uint64_t seed = 42;
+};
+
+namespace detail {
+
+/**
+ * Deterministic (across platforms and standard library implementations) pseudo random number generator (splitmix64)
+ */
+struct SplitMix64 {
+    uint64_t state;
+
+    uint64_t operator()() noexcept {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @return a number in [0, n)
+     */
+    uint64_t below(uint64_t const n) noexcept {
+        return (*this)() % n;
+    }
+
+    bool percent(uint32_t const p) noexcept {
+        return below(100) < p;
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Deterministically generates a synthetic dataset with LUBM (universities) and BSBM (products) like shapes.
+ * The same config always produces the same dataset.
+ *
+ * @param config generator configuration
+ * @param ds dataset to add the generated quads to
+ * @param node_storage node storage to create the nodes in
+ */
+inline void generate_synthetic_dataset(SyntheticConfig const &config, Dataset &ds, storage::DynNodeStoragePtr node_storage) {
+    using namespace datatypes;
+
+    detail::SplitMix64 rng{config.seed};
+
+    std::string const ub = "http://swat.lehigh.edu/onto/univ-bench.owl#";
+    std::string const bsbm = "http://www4.wiwiss.fu-berlin.de/bizer/bsbm/v01/vocabulary/";
+    std::string const inst = "http://example.com/instances/";
+
+    auto const iri = [&](std::string const &base, std::string const &local) {
+        return IRI{base + local, node_storage};
+    };
+
+    auto const entity = [&](std::string const &local) -> Node {
+        if (rng.percent(config.bnode_percent)) {
+            return BlankNode{local, node_storage};
+        }
+        return IRI{inst + local, node_storage};
+    };
+
+    auto const text = [&](std::string const &prefix, uint64_t const ix) {
+        auto s = prefix + " " + std::to_string(ix);
+        if (rng.percent(config.long_literal_percent)) {
+            s += " is described at length by a sentence that is much too long to be inlined into a node id";
+        }
+        return s;
+    };
+
+    auto const graph_for = [&](uint64_t const ix) -> Node {
+        auto const g = ix % (config.named_graphs + 1);
+        if (g == 0) {
+            return IRI::default_graph(node_storage);
+        }
+        return IRI{inst + "graph" + std::to_string(g), node_storage};
+    };
+
+    auto const rdf_type = IRI{"http://www.w3.org/1999/02/22-rdf-syntax-ns#type", node_storage};
+    auto const rdfs_label = IRI{"http://www.w3.org/2000/01/rdf-schema#label", node_storage};
+
+    // LUBM-like
+    for (uint64_t u = 0; u < config.universities; ++u) {
+        auto const g = graph_for(u);
+        auto const univ = iri(inst, "University" + std::to_string(u));
+        ds.add(Quad{g, univ, rdf_type, iri(ub, "University")});
+        ds.add(Quad{g, univ, iri(ub, "name"), Literal::make_simple(text("University", u), node_storage)});
+
+        for (uint64_t d = 0; d < 15; ++d) {
+            auto const dep_name = "University" + std::to_string(u) + "/Department" + std::to_string(d);
+            auto const dep = iri(inst, dep_name);
+            ds.add(Quad{g, dep, rdf_type, iri(ub, "Department")});
+            ds.add(Quad{g, dep, iri(ub, "subOrganizationOf"), univ});
+
+            std::vector<IRI> courses;
+            for (uint64_t c = 0; c < 20; ++c) {
+                courses.push_back(iri(inst, dep_name + "/Course" + std::to_string(c)));
+                ds.add(Quad{g, courses.back(), rdf_type, iri(ub, "Course")});
+                ds.add(Quad{g, courses.back(), iri(ub, "name"), Literal::make_lang_tagged(text("Course", c), "en", node_storage)});
+            }
+
+            std::vector<IRI> professors;
+            for (uint64_t p = 0; p < 10; ++p) {
+                professors.push_back(iri(inst, dep_name + "/Professor" + std::to_string(p)));
+                auto const &prof = professors.back();
+                ds.add(Quad{g, prof, rdf_type, iri(ub, "FullProfessor")});
+                ds.add(Quad{g, prof, iri(ub, "worksFor"), dep});
+                ds.add(Quad{g, prof, iri(ub, "name"), Literal::make_simple(text("Professor", p), node_storage)});
+                ds.add(Quad{g, prof, iri(ub, "emailAddress"), Literal::make_simple("professor" + std::to_string(p) + "@department" + std::to_string(d) + ".university" + std::to_string(u) + ".edu", node_storage)});
+                ds.add(Quad{g, prof, iri(ub, "teacherOf"), courses[rng.below(courses.size())]});
+            }
+
+            for (uint64_t s = 0; s < 100; ++s) {
+                auto const student = entity(dep_name + "/Student" + std::to_string(s));
+                ds.add(Quad{g, student, rdf_type, iri(ub, "UndergraduateStudent")});
+                ds.add(Quad{g, student, iri(ub, "memberOf"), dep});
+                ds.add(Quad{g, student, iri(ub, "name"), Literal::make_simple(text("Student", s), node_storage)});
+                ds.add(Quad{g, student, iri(ub, "age"), Literal::make_typed_from_value<xsd::Int>(static_cast<int32_t>(18 + rng.below(10)), node_storage)});
+                ds.add(Quad{g, student, iri(ub, "advisor"), professors[rng.below(professors.size())]});
+
+                for (uint64_t c = 0; c < 3; ++c) {
+                    ds.add(Quad{g, student, iri(ub, "takesCourse"), courses[rng.below(courses.size())]});
+                }
+            }
+        }
+    }
+
+    // BSBM-like
+    std::vector<IRI> producers;
+    std::vector<IRI> features;
+    for (uint64_t ix = 0; ix < config.products / 50 + 1; ++ix) {
+        producers.push_back(iri(inst, "Producer" + std::to_string(ix)));
+        ds.add(Quad{producers.back(), rdf_type, iri(bsbm, "Producer")});
+        ds.add(Quad{producers.back(), rdfs_label, Literal::make_simple(text("Producer", ix), node_storage)});
+    }
+    for (uint64_t ix = 0; ix < config.products / 10 + 1; ++ix) {
+        features.push_back(iri(inst, "ProductFeature" + std::to_string(ix)));
+        ds.add(Quad{features.back(), rdf_type, iri(bsbm, "ProductFeature")});
+        ds.add(Quad{features.back(), rdfs_label, Literal::make_simple(text("Feature", ix), node_storage)});
+    }
+
+    for (uint64_t p = 0; p < config.products; ++p) {
+        auto const g = graph_for(p);
+        auto const product = iri(inst, "Product" + std::to_string(p));
+        ds.add(Quad{g, product, rdf_type, iri(bsbm, "Product")});
+        ds.add(Quad{g, product, rdfs_label, Literal::make_simple(text("Product", p), node_storage)});
+        ds.add(Quad{g, product, iri(bsbm, "producer"), producers[rng.below(producers.size())]});
+        ds.add(Quad{g, product, iri(bsbm, "productPropertyNumeric1"), Literal::make_typed_from_value<xsd::Integer>(xsd::Integer::cpp_type{rng.below(2000)}, node_storage)});
+        ds.add(Quad{g, product, iri(bsbm, "productPropertyNumeric2"), Literal::make_typed_from_value<xsd::Double>(static_cast<double>(rng.below(100'000)) / 100.0, node_storage)});
+
+        for (uint64_t f = 0; f < 5; ++f) {
+            ds.add(Quad{g, product, iri(bsbm, "productFeature"), features[rng.below(features.size())]});
+        }
+
+        for (uint64_t r = 0; r < 3; ++r) {
+            auto const review = entity("Product" + std::to_string(p) + "/Review" + std::to_string(r));
+            ds.add(Quad{g, review, rdf_type, iri(bsbm, "Review")});
+            ds.add(Quad{g, review, iri(bsbm, "reviewFor"), product});
+            ds.add(Quad{g, review, iri(bsbm, "rating1"), Literal::make_typed_from_value<xsd::Int>(static_cast<int32_t>(1 + rng.below(10)), node_storage)});
+            ds.add(Quad{g, review, iri(bsbm, "text"), Literal::make_lang_tagged(text("Review", r), rng.percent(50) ? "en" : "de", node_storage)});
+        }
+    }
+}
+
+}  // namespace rdf4cpp::bench
+
+#endif  //RDF4CPP_TESTS_BENCH_SYNTHETICRDF_HPP
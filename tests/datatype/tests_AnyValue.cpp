@@ -0,0 +1,129 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp.hpp>
+
+#include <any>
+#include <array>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <type_traits>
+
+using namespace rdf4cpp;
+using namespace datatypes::registry;
+
+namespace {
+size_t num_allocations = 0;
+}  // namespace
+
+void *operator new(size_t const size) {
+    ++num_allocations;
+    if (void *p = std::malloc(size); p != nullptr) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+
+struct LargeValue {
+    std::array<char, 2 * AnyValue::inline_capacity> data;
+    std::string str;
+};
+
+TEST_CASE("AnyValue") {
+    static_assert(!std::is_constructible_v<AnyValue, std::any>);
+    static_assert(!std::is_constructible_v<AnyValue, std::any const &>);
+    static_assert(!std::is_convertible_v<std::any, AnyValue>);
+
+    SUBCASE("empty") {
+        AnyValue v;
+        CHECK(!v.has_value());
+        CHECK(v.type() == typeid(void));
+        CHECK(any_cast<int>(&v) == nullptr);
+        CHECK_THROWS_AS((void) any_cast<int>(v), std::bad_any_cast);
+    }
+
+    SUBCASE("inline") {
+        static_assert(AnyValue::stores_inline<datatypes::xsd::Decimal::cpp_type>);
+
+        AnyValue v{datatypes::xsd::Integer::cpp_type{42}};
+        CHECK(v.has_value());
+        CHECK(v.type() == typeid(datatypes::xsd::Integer::cpp_type));
+        CHECK(any_cast<datatypes::xsd::Integer::cpp_type>(v) == 42);
+        CHECK(any_cast<int>(&v) == nullptr);
+        CHECK_THROWS_AS((void) any_cast<int>(v), std::bad_any_cast);
+
+        AnyValue copy = v;
+        AnyValue moved = std::move(v);
+        CHECK(!v.has_value());
+        CHECK(any_cast<datatypes::xsd::Integer::cpp_type const &>(copy) == 42);
+        CHECK(any_cast<datatypes::xsd::Integer::cpp_type const &>(moved) == 42);
+
+        copy.emplace<std::string_view>("abc");
+        CHECK(any_cast<std::string_view>(copy) == "abc");
+
+        copy = moved;
+        CHECK(any_cast<datatypes::xsd::Integer::cpp_type const &>(copy) == 42);
+
+        copy.reset();
+        CHECK(!copy.has_value());
+    }
+
+    SUBCASE("heap") {
+        static_assert(!AnyValue::stores_inline<LargeValue>);
+
+        AnyValue v{LargeValue{.data = {}, .str = std::string(100, 'x')}};
+        AnyValue copy = v;
+        AnyValue moved = std::move(v);
+        CHECK(!v.has_value());
+        CHECK(any_cast<LargeValue const &>(copy).str == std::string(100, 'x'));
+        CHECK(any_cast<LargeValue const &>(moved).str == std::string(100, 'x'));
+
+        moved = copy;
+        copy = AnyValue{1};
+        CHECK(any_cast<LargeValue const &>(moved).str == std::string(100, 'x'));
+        CHECK(any_cast<int>(copy) == 1);
+    }
+}
+
+TEST_CASE("AnyValue - registry ops do not allocate") {
+    using datatypes::xsd::Decimal;
+    using datatypes::xsd::DateTime;
+    using datatypes::xsd::Duration;
+
+    auto const &decimal_ops = DatatypeRegistry::get_numerical_ops(Decimal::datatype_id)->get_impl();
+    auto const decimal_compare = DatatypeRegistry::get_compare(Decimal::datatype_id);
+    auto const *timepoint_ops = DatatypeRegistry::get_timepoint_ops(DateTime::datatype_id);
+    REQUIRE(decimal_compare != nullptr);
+    REQUIRE(timepoint_ops != nullptr);
+
+    AnyValue const lhs{Decimal::cpp_type{"1.5"}};
+    AnyValue const rhs{Decimal::cpp_type{"2.25"}};
+    AnyValue const tp{DateTime::from_string("2024-01-01T00:00:00Z")};
+    AnyValue const dur{Duration::from_string("PT1H")};
+
+    auto const before = num_allocations;
+
+    auto const sum = decimal_ops.add_fptr(lhs, rhs);
+    auto const product = decimal_ops.mul_fptr(lhs, rhs);
+    auto const cmp = decimal_compare(lhs, rhs);
+    auto const later = timepoint_ops->timepoint_duration_add(tp, dur);
+
+    CHECK(num_allocations == before);
+
+    REQUIRE(sum.result_value.has_value());
+    REQUIRE(product.result_value.has_value());
+    REQUIRE(later.result_value.has_value());
+    CHECK(any_cast<Decimal::cpp_type const &>(*sum.result_value) == Decimal::cpp_type{"3.75"});
+    CHECK(any_cast<Decimal::cpp_type const &>(*product.result_value) == Decimal::cpp_type{"3.375"});
+    CHECK(cmp == std::partial_ordering::less);
+    CHECK(any_cast<DateTime::cpp_type const &>(*later.result_value) == DateTime::from_string("2024-01-01T01:00:00Z"));
+}
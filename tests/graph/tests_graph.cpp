@@ -0,0 +1,126 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <rdf4cpp.hpp>
+
+using namespace rdf4cpp;
+
+static size_t count_solutions(Graph const &g, query::TriplePattern const &pat) {
+    size_t n = 0;
+    for ([[maybe_unused]] auto const &sol : g.match(pat)) {
+        ++n;
+    }
+    return n;
+}
+
+TEST_CASE("match with and without index") {
+    IRI const s1{"http://example.com/s1"};
+    IRI const s2{"http://example.com/s2"};
+    IRI const p1{"http://example.com/p1"};
+    IRI const p2{"http://example.com/p2"};
+    IRI const o1{"http://example.com/o1"};
+    Literal const o2 = Literal::make_simple("o2");
+
+    auto fill = [&](Graph &g) {
+        g.add({s1, p1, o1});
+        g.add({s1, p1, o2});
+        g.add({s1, p2, o1});
+        g.add({s2, p1, o1});
+        g.add({s2, p2, o2});
+        g.add({s2, p2, o2}); // duplicate
+    };
+
+    Graph scan_graph;
+    fill(scan_graph);
+    CHECK(!scan_graph.is_indexed());
+
+    Graph indexed_graph{storage::default_node_storage, true};
+    fill(indexed_graph);
+    CHECK(indexed_graph.is_indexed());
+
+    Graph late_indexed_graph;
+    fill(late_indexed_graph);
+    late_indexed_graph.build_index();
+    CHECK(late_indexed_graph.is_indexed());
+
+    query::Variable const x{"x"};
+    query::Variable const y{"y"};
+    query::Variable const z{"z"};
+
+    std::vector<std::pair<query::TriplePattern, size_t>> const patterns{
+            {{x, y, z}, 5},
+            {{s1, y, z}, 3},
+            {{s1, p1, z}, 2},
+            {{s1, p1, o1}, 1},
+            {{s1, p2, o2}, 0},
+            {{x, p1, z}, 3},
+            {{x, p2, o2}, 1},
+            {{x, y, o1}, 3},
+            {{s2, y, o2}, 1},
+            {{x, IRI{"http://example.com/not-in-graph"}, z}, 0},
+    };
+
+    for (auto const &[pat, expected] : patterns) {
+        CHECK_EQ(count_solutions(scan_graph, pat), expected);
+        CHECK_EQ(count_solutions(indexed_graph, pat), expected);
+        CHECK_EQ(count_solutions(late_indexed_graph, pat), expected);
+    }
+
+    SUBCASE("bindings") {
+        query::TriplePattern const pat{s2, x, o2};
+        for (auto const &sol : indexed_graph.match(pat)) {
+            CHECK_EQ(sol.bound_count(), 1);
+            CHECK_EQ(sol[0], p2);
+        }
+    }
+}
+
+TEST_CASE("match with index over many runs") {
+    // enough triples that the indices consist of multiple merged runs
+    IRI const p{"http://example.com/p"};
+    std::vector<IRI> subjects;
+    for (size_t ix = 0; ix < 50; ++ix) {
+        subjects.emplace_back("http://example.com/s" + std::to_string(ix));
+    }
+
+    Graph indexed_graph{storage::default_node_storage, true};
+    Graph late_indexed_graph;
+    for (size_t ix = 0; ix < 5000; ++ix) {
+        Statement const stmt{subjects[(ix * 7) % subjects.size()], p, Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int32_t>(ix))};
+        indexed_graph.add(stmt);
+        late_indexed_graph.add(stmt);
+    }
+    late_indexed_graph.build_index();
+
+    // added after the index was built
+    late_indexed_graph.add({subjects[0], p, Literal::make_simple("late")});
+    indexed_graph.add({subjects[0], p, Literal::make_simple("late")});
+
+    query::Variable const x{"x"};
+    query::Variable const z{"z"};
+
+    for (auto const &g : {&indexed_graph, &late_indexed_graph}) {
+        CHECK_EQ(count_solutions(*g, {x, p, z}), 5001);
+        CHECK_EQ(count_solutions(*g, {subjects[0], p, z}), 101);
+        CHECK_EQ(count_solutions(*g, {subjects[1], x, z}), 100);
+        CHECK_EQ(count_solutions(*g, {x, p, Literal::make_typed_from_value<datatypes::xsd::Int>(4999)}), 1);
+        CHECK_EQ(count_solutions(*g, {subjects[0], p, Literal::make_simple("late")}), 1);
+    }
+}
+
+TEST_CASE("indexed dataset") {
+    Dataset ds{storage::default_node_storage, true};
+    ds.add(Quad{IRI{"http://example.com/g"}, IRI{"http://example.com/s"}, IRI{"http://example.com/p"}, IRI{"http://example.com/o"}});
+    ds.add(Quad{IRI{"http://example.com/s"}, IRI{"http://example.com/p"}, Literal::make_simple("o")});
+
+    CHECK(ds.graph().is_indexed());
+    CHECK(ds.graph(IRI{"http://example.com/g"}).is_indexed());
+
+    query::QuadPattern const pat{query::Variable{"g"}, IRI{"http://example.com/s"}, query::Variable{"p"}, query::Variable{"o"}};
+    size_t n = 0;
+    for (auto const &sol : ds.match(pat)) {
+        CHECK_EQ(sol.bound_count(), 3);
+        ++n;
+    }
+    CHECK_EQ(n, 2);
+}
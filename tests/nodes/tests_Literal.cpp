@@ -146,6 +146,15 @@ TEST_CASE("Literal - Check for lexical form with language tag") {
     CHECK_EQ(std::string(lit1), "\"Bunny\"@en");
 }
 
+TEST_CASE("Literal - unchecked construction") {
+    auto const simple = Literal::make_simple_unchecked("Bunny \"Hops\"", storage::default_node_storage);
+    CHECK_EQ(simple, Literal::make_simple("Bunny \"Hops\""));
+
+    auto const lang_tagged = Literal::make_lang_tagged_unchecked("Bunny", "en", storage::default_node_storage);
+    CHECK_EQ(lang_tagged, Literal::make_lang_tagged("Bunny", "en"));
+    CHECK_EQ(lang_tagged.language_tag(), "en");
+}
+
 TEST_CASE("Literal - ctor edge-case") {
     IRI const iri{"http://www.w3.org/2001/XMLSchema#int"};
     auto const lit1 = Literal::make_typed("1", iri);
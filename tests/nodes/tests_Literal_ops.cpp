@@ -5,6 +5,7 @@
 
 #include <charconv>
 #include <limits>
+#include <vector>
 
 using namespace rdf4cpp;
 
@@ -486,3 +487,164 @@ TEST_CASE("null ops") {
     CHECK((+n).null());
     CHECK((-n).null());
 }
+
+TEST_CASE("Literal - inlined fast path") {
+    using namespace datatypes::xsd;
+
+    SUBCASE("integer") {
+        auto const a = Literal::make_typed_from_value<Int>(40);
+        auto const b = Literal::make_typed_from_value<Short>(2);
+        auto const c = Literal::make_typed_from_value<Integer>(5);
+        REQUIRE(a.is_inlined());
+        REQUIRE(b.is_inlined());
+        REQUIRE(c.is_inlined());
+
+        CHECK((a + b) == Literal::make_typed_from_value<Integer>(42));
+        CHECK((a + b).datatype_eq<Integer>());
+        CHECK((a - c) == Literal::make_typed_from_value<Integer>(35));
+        CHECK((c * b) == Literal::make_typed_from_value<Integer>(10));
+
+        // integer division results in a decimal
+        auto const q = a / Literal::make_typed_from_value<Int>(16);
+        CHECK(q.datatype_eq<Decimal>());
+        CHECK(q == Literal::make_typed_from_value<Decimal>(Decimal::cpp_type{"2.5"}));
+        CHECK((a / Literal::make_typed_from_value<Int>(0)).null());
+    }
+
+    SUBCASE("integer overflow") {
+        auto const big = Literal::make_typed_from_value<Integer>(Integer::cpp_type{1} << 40);
+        REQUIRE(big.is_inlined());
+
+        // result does not fit into the inlined representation
+        auto const medium = Literal::make_typed_from_value<Integer>(Integer::cpp_type{1} << 30);
+        auto const prod = medium * medium;
+        CHECK(!prod.is_inlined());
+        CHECK(prod == Literal::make_typed_from_value<Integer>(Integer::cpp_type{1} << 60));
+
+        // result does not fit into int64_t
+        auto const huge = big * big;
+        CHECK(!huge.is_inlined());
+        CHECK(huge == Literal::make_typed_from_value<Integer>(Integer::cpp_type{1} << 80));
+
+        auto const min = Literal::make_typed_from_value<Integer>(-(Integer::cpp_type{1} << 41));
+        REQUIRE(min.is_inlined());
+        CHECK((min - big) == Literal::make_typed_from_value<Integer>(-(Integer::cpp_type{1} << 41) - (Integer::cpp_type{1} << 40)));
+    }
+
+    SUBCASE("floating point") {
+        auto const d1 = Literal::make_typed_from_value<Double>(1.5);
+        auto const d2 = Literal::make_typed_from_value<Double>(2.0);
+        REQUIRE(d1.is_inlined());
+        REQUIRE(d2.is_inlined());
+        CHECK((d1 + d2) == Literal::make_typed_from_value<Double>(3.5));
+        CHECK((d1 * d2) == Literal::make_typed_from_value<Double>(3.0));
+        CHECK((d1 / d2) == Literal::make_typed_from_value<Double>(0.75));
+
+        auto const f1 = Literal::make_typed_from_value<Float>(1.5f);
+        auto const f2 = Literal::make_typed_from_value<Float>(0.25f);
+        REQUIRE(f1.is_inlined());
+        CHECK((f1 - f2) == Literal::make_typed_from_value<Float>(1.25f));
+        CHECK((f1 - f2).datatype_eq<Float>());
+
+        // different types are promoted by the general path
+        CHECK((f1 + d2) == Literal::make_typed_from_value<Double>(3.5));
+        CHECK((Literal::make_typed_from_value<Int>(1) + d1) == Literal::make_typed_from_value<Double>(2.5));
+    }
+
+    SUBCASE("compare") {
+        auto const i1 = Literal::make_typed_from_value<Integer>(-3);
+        auto const i2 = Literal::make_typed_from_value<Integer>(7);
+        CHECK(i1.compare(i2) == std::partial_ordering::less);
+        CHECK(i2.compare(i1) == std::partial_ordering::greater);
+
+        auto const d1 = Literal::make_typed("2024-01-31", IRI{Date::identifier});
+        auto const d2 = Literal::make_typed("2024-02-01", IRI{Date::identifier});
+        REQUIRE(d1.is_inlined());
+        REQUIRE(d2.is_inlined());
+        CHECK(d1.compare(d2) == std::partial_ordering::less);
+        CHECK(d2.compare(d1) == std::partial_ordering::greater);
+    }
+
+    SUBCASE("order of inlined ids") {
+        auto const check_ordered = [](std::vector<Literal> const &values) {
+            for (size_t ix = 1; ix < values.size(); ++ix) {
+                auto const &lhs = values[ix - 1];
+                auto const &rhs = values[ix];
+                REQUIRE(lhs.is_inlined());
+                REQUIRE(rhs.is_inlined());
+                CHECK(lhs.backend_handle().node_id().literal_id() < rhs.backend_handle().node_id().literal_id());
+                CHECK(lhs.compare(rhs) == std::partial_ordering::less);
+                CHECK(lhs.order(rhs) == std::strong_ordering::less);
+                CHECK(rhs.order(lhs) == std::strong_ordering::greater);
+            }
+        };
+
+        check_ordered({Literal::make_typed_from_value<Integer>(-(Integer::cpp_type{1} << 41)),
+                       Literal::make_typed_from_value<Integer>(-1),
+                       Literal::make_typed_from_value<Integer>(0),
+                       Literal::make_typed_from_value<Integer>((Integer::cpp_type{1} << 41) - 1)});
+        check_ordered({Literal::make_typed_from_value<Int>(std::numeric_limits<int32_t>::min()),
+                       Literal::make_typed_from_value<Int>(-5),
+                       Literal::make_typed_from_value<Int>(5),
+                       Literal::make_typed_from_value<Int>(std::numeric_limits<int32_t>::max())});
+        check_ordered({Literal::make_typed_from_value<NegativeInteger>(-(NegativeInteger::cpp_type{1} << 42)),
+                       Literal::make_typed_from_value<NegativeInteger>(-2),
+                       Literal::make_typed_from_value<NegativeInteger>(-1)});
+        check_ordered({Literal::make_typed_from_value<NonPositiveInteger>(-(NonPositiveInteger::cpp_type{1} << 42) + 1),
+                       Literal::make_typed_from_value<NonPositiveInteger>(-1),
+                       Literal::make_typed_from_value<NonPositiveInteger>(0)});
+        check_ordered({Literal::make_typed_from_value<Double>(-std::numeric_limits<double>::infinity()),
+                       Literal::make_typed_from_value<Double>(-2.5),
+                       Literal::make_typed_from_value<Double>(0.0),
+                       Literal::make_typed_from_value<Double>(1.0),
+                       Literal::make_typed_from_value<Double>(std::numeric_limits<double>::infinity())});
+        check_ordered({Literal::make_typed_from_value<Float>(-1.5f),
+                       Literal::make_typed_from_value<Float>(0.0f),
+                       Literal::make_typed_from_value<Float>(1.5f)});
+        check_ordered({Literal::make_typed("-0001-12-31", IRI{Date::identifier}),
+                       Literal::make_typed("1969-12-31", IRI{Date::identifier}),
+                       Literal::make_typed("1970-01-01", IRI{Date::identifier}),
+                       Literal::make_typed("2024-02-29", IRI{Date::identifier})});
+        check_ordered({Literal::make_typed("1969-12-31T23:59:59", IRI{DateTime::identifier}),
+                       Literal::make_typed("1970-01-01T00:00:00", IRI{DateTime::identifier}),
+                       Literal::make_typed("1970-01-01T00:00:01", IRI{DateTime::identifier})});
+        check_ordered({Literal::make_typed("-PT1S", IRI{DayTimeDuration::identifier}),
+                       Literal::make_typed("PT0S", IRI{DayTimeDuration::identifier}),
+                       Literal::make_typed("P1D", IRI{DayTimeDuration::identifier})});
+
+        // round trip through the inlined representation
+        CHECK(Literal::make_typed_from_value<NegativeInteger>(-7).value<NegativeInteger>() == -7);
+        CHECK(Literal::make_typed_from_value<NonPositiveInteger>(-7).value<NonPositiveInteger>() == -7);
+        CHECK(Literal::make_typed_from_value<Double>(-2.5).value<Double>() == -2.5);
+        CHECK(Literal::make_typed_from_value<Float>(-1.5f).value<Float>() == -1.5f);
+        CHECK(Literal::make_typed_from_value<Long>(-42).value<Long>() == -42);
+    }
+}
+
+TEST_CASE("Literal - mixed type numeric promotion") {
+    using namespace datatypes::xsd;
+
+    // operands of different builtin numeric types use the compile-time promotion table
+    auto const i = Literal::make_typed_from_value<Int>(3);
+    auto const d = Literal::make_typed_from_value<Decimal>(Decimal::cpp_type{"1.5"});
+    auto const f = Literal::make_typed_from_value<Float>(0.5f);
+    auto const db = Literal::make_typed_from_value<Double>(0.25);
+    auto const ub = Literal::make_typed_from_value<UnsignedByte>(2);
+    auto const neg = Literal::make_typed_from_value<NegativeInteger>(-4);
+
+    CHECK((i + d).datatype_eq<Decimal>());
+    CHECK((i + d) == Literal::make_typed_from_value<Decimal>(Decimal::cpp_type{"4.5"}));
+    CHECK((d + i) == Literal::make_typed_from_value<Decimal>(Decimal::cpp_type{"4.5"}));
+
+    CHECK((d * f).datatype_eq<Float>());
+    CHECK((d * f) == Literal::make_typed_from_value<Float>(0.75f));
+
+    CHECK((ub - db).datatype_eq<Double>());
+    CHECK((ub - db) == Literal::make_typed_from_value<Double>(1.75));
+
+    CHECK((neg + ub).datatype_eq<Integer>());
+    CHECK((neg + ub) == Literal::make_typed_from_value<Integer>(-2));
+
+    CHECK((i / ub).datatype_eq<Decimal>());
+    CHECK((i / ub) == Literal::make_typed_from_value<Decimal>(Decimal::cpp_type{"1.5"}));
+}
@@ -8,6 +8,8 @@
 #include <rdf4cpp.hpp>
 #include <rdf4cpp/storage/reference_node_storage/UnsyncReferenceNodeStorage.hpp>
 #include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/ShardedReferenceNodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/FrozenReferenceNodeStorage.hpp>
 
 using namespace rdf4cpp;
 using namespace rdf4cpp::storage;
@@ -301,7 +303,7 @@ TEST_CASE("BlankNode validity") {
     CHECK(n == BlankNode{});
 }
 
-TEST_CASE_TEMPLATE("NodeStorage erase IRI", T, reference_node_storage::SyncReferenceNodeStorage, reference_node_storage::UnsyncReferenceNodeStorage) {
+TEST_CASE_TEMPLATE("NodeStorage erase IRI", T, reference_node_storage::SyncReferenceNodeStorage, reference_node_storage::UnsyncReferenceNodeStorage, reference_node_storage::ShardedReferenceNodeStorage) {
     static constexpr std::string_view example = "https://example.com";
     T ns{};
 
@@ -319,6 +321,163 @@ TEST_CASE_TEMPLATE("NodeStorage erase IRI", T, reference_node_storage::SyncRefer
     CHECK(IRI::find(rdf4cpp::datatypes::xsd::Int::identifier, ns) != IRI());
 }
 
+TEST_CASE_TEMPLATE("NodeStorage find_or_make_ids", T, reference_node_storage::SyncReferenceNodeStorage, reference_node_storage::UnsyncReferenceNodeStorage, reference_node_storage::ShardedReferenceNodeStorage) {
+    T ns_impl{};
+    DynNodeStoragePtr ns = ns_impl;
+
+    std::vector<std::string> iri_strs;
+    for (size_t ix = 0; ix < 1000; ++ix) {
+        iri_strs.push_back("http://example.com/" + std::to_string(ix % 700)); // contains duplicates
+    }
+
+    std::vector<view::IRIBackendView> iris;
+    for (auto const &iri : iri_strs) {
+        iris.push_back(view::IRIBackendView{.identifier = iri});
+    }
+
+    auto const existing = ns.find_or_make_id(iris[42]);
+
+    std::vector<identifier::NodeBackendID> iri_ids(iris.size());
+    ns.find_or_make_ids(iris, iri_ids);
+
+    CHECK_EQ(iri_ids[42], existing);
+    for (size_t ix = 0; ix < iris.size(); ++ix) {
+        CHECK_EQ(iri_ids[ix], ns.find_id(iris[ix]));
+        CHECK_EQ(ns.find_iri_backend(iri_ids[ix]).identifier, iri_strs[ix]);
+    }
+
+    auto const string_id = identifier::literal_type_to_iri_node_id(datatypes::xsd::String::fixed_id);
+    std::vector<view::LiteralBackendView> literals{
+            view::LexicalFormLiteralBackendView{.datatype_id = string_id, .lexical_form = "a", .language_tag = "", .needs_escape = false},
+            view::LexicalFormLiteralBackendView{.datatype_id = string_id, .lexical_form = "b", .language_tag = "", .needs_escape = false},
+            view::ValueLiteralBackendView{.datatype = datatypes::xsd::Integer::fixed_id, .value = datatypes::xsd::Integer::cpp_type{42}},
+            view::ValueLiteralBackendView{.datatype = datatypes::xsd::Double::fixed_id, .value = 1.5},
+            view::ValueLiteralBackendView{.datatype = datatypes::xsd::Double::fixed_id, .value = 2.5},
+            view::LexicalFormLiteralBackendView{.datatype_id = string_id, .lexical_form = "a", .language_tag = "", .needs_escape = false}};
+
+    std::vector<identifier::NodeBackendID> literal_ids(literals.size());
+    ns.find_or_make_ids(literals, literal_ids);
+
+    CHECK_EQ(literal_ids[0], literal_ids[5]);
+    for (size_t ix = 0; ix < literals.size(); ++ix) {
+        CHECK_EQ(literal_ids[ix], ns.find_id(literals[ix]));
+    }
+    CHECK_EQ(ns.find_literal_backend(literal_ids[1]).get_lexical().lexical_form, "b");
+}
+
+TEST_CASE_TEMPLATE("FrozenReferenceNodeStorage", T, reference_node_storage::SyncReferenceNodeStorage, reference_node_storage::UnsyncReferenceNodeStorage) {
+    T ns_impl{};
+
+    std::vector<IRI> iris;
+    for (size_t ix = 0; ix < 1000; ++ix) {
+        iris.emplace_back("http://example.com/" + std::to_string(ix), ns_impl);
+    }
+    CHECK(ns_impl.erase_iri(iris[500].backend_handle().id())); // leaves a hole in the ids
+
+    auto const simple = Literal::make_simple("hello", ns_impl);
+    auto const lang = Literal::make_lang_tagged("hallo", "de", ns_impl);
+    auto const dbl = Literal::make_typed_from_value<datatypes::xsd::Double>(1.5, ns_impl);
+    auto const bnode = BlankNode{"b1", ns_impl};
+    auto const var = query::Variable{"x", false, ns_impl};
+
+    reference_node_storage::FrozenReferenceNodeStorage frozen_impl{ns_impl};
+    DynNodeStoragePtr frozen = frozen_impl;
+
+    for (size_t ix = 0; ix < iris.size(); ++ix) {
+        if (ix == 500) {
+            CHECK(IRI::find("http://example.com/500", frozen).null());
+            continue;
+        }
+
+        auto const str = "http://example.com/" + std::to_string(ix);
+        CHECK_EQ(IRI::find(str, frozen).backend_handle().id(), iris[ix].backend_handle().id());
+        CHECK_EQ(frozen.find_iri_backend(iris[ix].backend_handle().id()).identifier, str);
+    }
+
+    // reserved datatype IRIs
+    CHECK_EQ(IRI::find(datatypes::xsd::String::identifier, frozen).backend_handle().id(),
+             identifier::literal_type_to_iri_node_id(datatypes::xsd::String::fixed_id));
+
+    CHECK_EQ(Literal::make_simple("hello", frozen).backend_handle().id(), simple.backend_handle().id());
+    CHECK_EQ(Literal::make_lang_tagged("hallo", "de", frozen).backend_handle().id(), lang.backend_handle().id());
+    CHECK_EQ(Literal::make_typed_from_value<datatypes::xsd::Double>(1.5, frozen).backend_handle().id(), dbl.backend_handle().id());
+    CHECK_EQ(BlankNode{"b1", frozen}.backend_handle().id(), bnode.backend_handle().id());
+    CHECK_EQ(query::Variable{"x", false, frozen}.backend_handle().id(), var.backend_handle().id());
+
+    auto const frozen_dbl = Literal::make_typed_from_value<datatypes::xsd::Double>(1.5, frozen);
+    CHECK_EQ(frozen_dbl.value<datatypes::xsd::Double>(), 1.5);
+    CHECK_EQ(Literal::make_lang_tagged("hallo", "de", frozen).language_tag(), "de");
+
+    CHECK_THROWS_AS(IRI("http://example.com/new", frozen), std::runtime_error);
+    CHECK(IRI::find("http://example.com/new", frozen).null());
+}
+
+TEST_CASE("FrozenReferenceNodeStorage lexical id order") {
+    reference_node_storage::UnsyncReferenceNodeStorage ns_impl{};
+
+    std::vector<std::string> strs;
+    for (size_t ix = 0; ix < 200; ++ix) {
+        strs.push_back(std::to_string((ix * 7919) % 200)); // inserted out of order
+    }
+
+    std::vector<Node> nodes;
+    for (auto const &str : strs) {
+        nodes.push_back(IRI{"http://example.com/" + str, ns_impl});
+        nodes.push_back(BlankNode{"b" + str + "_with_a_label_that_is_too_long_to_be_inlined", ns_impl});
+        nodes.push_back(Literal::make_simple(str, ns_impl));
+    }
+    nodes.push_back(IRI{datatypes::xsd::Int::identifier, ns_impl}); // reserved
+
+    CHECK_FALSE(ns_impl.has_lexically_ordered_ids(identifier::RDFNodeType::IRI));
+    CHECK_FALSE(reference_node_storage::FrozenReferenceNodeStorage{ns_impl}.has_lexically_ordered_ids(identifier::RDFNodeType::IRI));
+
+    reference_node_storage::FrozenReferenceNodeStorage frozen_impl{ns_impl, reference_node_storage::FrozenReferenceNodeStorage::IdAssignment::LexicalOrder};
+    DynNodeStoragePtr frozen = frozen_impl;
+    CHECK(frozen.has_lexically_ordered_ids(identifier::RDFNodeType::IRI));
+    CHECK(frozen.has_lexically_ordered_ids(identifier::RDFNodeType::BNode));
+    CHECK(frozen.has_lexically_ordered_ids(identifier::RDFNodeType::Literal));
+
+    std::vector<Node> frozen_nodes;
+    for (auto const &node : nodes) {
+        frozen_nodes.push_back(node.to_node_storage(frozen));
+        CHECK_EQ(frozen_nodes.back(), node.to_node_storage(frozen)); // lookup is stable
+    }
+
+    CHECK_EQ(IRI{frozen_nodes.back().backend_handle()}.identifier(), datatypes::xsd::Int::identifier);
+
+    for (size_t ix = 0; ix < nodes.size(); ++ix) {
+        for (size_t jx = 0; jx < nodes.size(); ++jx) {
+            CHECK_EQ(frozen_nodes[ix].order(frozen_nodes[jx]), nodes[ix].order(nodes[jx]));
+        }
+    }
+}
+
+TEST_CASE("FrozenReferenceNodeStorage lexical id order with custom datatypes") {
+    reference_node_storage::UnsyncReferenceNodeStorage ns_impl{};
+
+    // inserted before the datatype IRI, so that its id changes when reassigned in lexical order
+    IRI const z{"http://example.org/z", ns_impl};
+    IRI const y{"http://example.org/y", ns_impl};
+    auto const custom = Literal::make_typed("x", IRI{"http://example.org/custom", ns_impl}, ns_impl);
+    IRI const a{"http://example.org/a", ns_impl};
+
+    reference_node_storage::FrozenReferenceNodeStorage frozen_impl{ns_impl, reference_node_storage::FrozenReferenceNodeStorage::IdAssignment::LexicalOrder};
+    DynNodeStoragePtr frozen = frozen_impl;
+
+    auto const frozen_custom = custom.to_node_storage(frozen);
+    REQUIRE_FALSE(frozen_custom.null());
+    CHECK_EQ(frozen_custom.datatype().identifier(), "http://example.org/custom");
+    CHECK_EQ(frozen_custom.lexical_form(), "x");
+    CHECK_EQ(frozen_custom.datatype().backend_handle(), IRI::find("http://example.org/custom", frozen).backend_handle());
+
+    view::LexicalFormLiteralBackendView const expected{.datatype_id = IRI::find("http://example.org/custom", frozen).backend_handle().id(),
+                                                       .lexical_form = "x",
+                                                       .language_tag = "",
+                                                       .needs_escape = false};
+    CHECK_EQ(frozen_impl.find_id(view::LiteralBackendView{expected}), frozen_custom.backend_handle().id());
+    CHECK_EQ(frozen_impl.find_id(frozen.find_literal_backend(frozen_custom.backend_handle().id())), frozen_custom.backend_handle().id());
+}
+
 TEST_CASE("null nodes") {
     Node n1{};
     Literal n2{};
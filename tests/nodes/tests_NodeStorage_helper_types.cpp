@@ -2,7 +2,16 @@
 
 #include <doctest/doctest.h>
 #include <rdf4cpp.hpp>
+#include <rdf4cpp/storage/reference_node_storage/FrozenReferenceNodeStorage.hpp>
 #include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
+#include <rdf4cpp/storage/reference_node_storage/ShardedReferenceNodeStorage.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <random>
+#include <set>
+#include <thread>
 
 TEST_SUITE("NodeStorage helper types") {
     using namespace rdf4cpp::storage::reference_node_storage::detail;
@@ -58,6 +67,199 @@ TEST_SUITE("NodeStorage helper types") {
         CHECK_EQ(freelist.occupy_next_available(), 71);
     }
 
+    TEST_CASE("SegmentedVector") {
+        SegmentedVector<size_t> vec;
+        CHECK(vec.empty());
+
+        std::vector<size_t const *> addrs;
+        for (size_t ix = 0; ix < 10'000; ++ix) {
+            addrs.push_back(&vec.emplace_back(ix));
+        }
+        CHECK_EQ(vec.size(), 10'000);
+
+        for (size_t ix = 0; ix < vec.size(); ++ix) {
+            CHECK_EQ(vec[ix], ix);
+            CHECK_EQ(&vec[ix], addrs[ix]); // elements never move
+        }
+
+        vec.resize(300);
+        vec.shrink_to_fit();
+        CHECK_EQ(vec.size(), 300);
+        CHECK_EQ(vec[299], 299);
+
+        vec.resize(310);
+        CHECK_EQ(vec[309], 0);
+
+        vec.clear();
+        CHECK(vec.empty());
+    }
+
+    TEST_CASE("StringArena") {
+        StringArena arena;
+
+        std::vector<std::optional<ArenaString>> strings;
+        for (size_t ix = 0; ix < 20'000; ++ix) {
+            strings.emplace_back(std::in_place, std::to_string(ix), arena);
+        }
+        strings.emplace_back(std::in_place, std::string(StringArena::large_string_threshold, 'x'), arena); // not placed in a chunk
+        strings.emplace_back(std::in_place, "", arena);
+
+        auto const chunks = arena.chunk_count();
+        CHECK_GT(chunks, 1);
+
+        for (size_t ix = 0; ix < 20'000; ++ix) {
+            CHECK_EQ(*strings[ix], std::to_string(ix));
+        }
+        CHECK_EQ(strings[20'000]->size(), StringArena::large_string_threshold);
+        CHECK_EQ(*strings[20'001], "");
+
+        // chunks that still contain live strings are kept
+        for (size_t ix = 0; ix < 20'000; ix += 2) {
+            strings[ix].reset();
+        }
+        arena.shrink_to_fit();
+        CHECK_EQ(arena.chunk_count(), chunks);
+
+        for (size_t ix = 1; ix < 20'000; ix += 2) {
+            CHECK_EQ(*strings[ix], std::to_string(ix));
+        }
+
+        // chunks without live strings are released in bulk
+        strings.clear();
+        arena.shrink_to_fit();
+        CHECK_EQ(arena.chunk_count(), 1);
+    }
+
+    TEST_CASE("MinimalPerfectHash") {
+        std::mt19937_64 rng{42};
+        std::set<uint64_t> hash_set;
+        while (hash_set.size() < 10'000) {
+            hash_set.insert(rng());
+        }
+
+        std::vector<uint64_t> const hashes(hash_set.begin(), hash_set.end());
+        MinimalPerfectHash const mph{hashes};
+        REQUIRE_EQ(mph.size(), hashes.size());
+
+        std::vector<bool> seen(hashes.size());
+        for (auto const hash : hashes) {
+            auto const slot = mph(hash);
+            REQUIRE_LT(slot, hashes.size());
+            CHECK_FALSE(seen[slot]);
+            seen[slot] = true;
+        }
+
+        // colliding hashes are resolved by the holds_value check
+        FrozenIdIndex const index{{{5, 1}, {5, 2}, {7, 3}}};
+        CHECK_EQ(index.lookup(5, [](auto const id) { return id == 2; }), 2);
+        CHECK_EQ(index.lookup(5, [](auto const id) { return id == 1; }), 1);
+        CHECK_EQ(index.lookup(7, [](auto const id) { return id == 3; }), 3);
+        CHECK_EQ(index.lookup(8, [](auto) { return false; }), 0);
+        CHECK_EQ(FrozenIdIndex{}.lookup(5, [](auto) { return true; }), 0);
+    }
+
+    TEST_CASE("sharded id space exhaustion") {
+        using namespace rdf4cpp;
+        using namespace rdf4cpp::storage;
+        using storage_type = reference_node_storage::ShardedNodeTypeStorage<reference_node_storage::IRIBackend>;
+
+        // with the maximum number of shards, every shard can only assign ids_per_shard ids
+        static constexpr size_t shard_count = storage_type::max_shard_count;
+        static constexpr uint64_t ids_per_shard = 2;
+        auto const min_id = identifier::NodeID::min_iri_id.to_underlying();
+        auto const max_id = min_id + shard_count * ids_per_shard - 1;
+        storage_type storage{shard_count, identifier::NodeID::min_iri_id, identifier::NodeID{max_id}};
+
+        std::vector<std::string> iris;
+        std::vector<identifier::NodeID> ids;
+        CHECK_THROWS_AS(([&]() {
+                            while (true) {
+                                auto const &iri = iris.emplace_back("http://example.com/" + std::to_string(iris.size()));
+                                ids.push_back(storage.lookup_or_insert(view::IRIBackendView{.identifier = iri}));
+                            }
+                        }()),
+                        std::runtime_error);
+
+        REQUIRE_EQ(ids.size(), iris.size() - 1);
+        CHECK_LE(ids.size(), shard_count * ids_per_shard);
+
+        std::set<identifier::NodeID> const unique_ids(ids.begin(), ids.end());
+        CHECK_EQ(unique_ids.size(), ids.size());
+        for (size_t ix = 0; ix < ids.size(); ++ix) {
+            CHECK_GE(ids[ix].to_underlying(), min_id);
+            CHECK_LE(ids[ix].to_underlying(), max_id);
+            CHECK_EQ(storage.lookup_value(ids[ix])->identifier, iris[ix]);
+        }
+
+        // the value that did not fit anymore was not inserted
+        CHECK_EQ(storage.lookup(view::IRIBackendView{.identifier = iris.back()}), identifier::NodeID{});
+    }
+
+    TEST_CASE("concurrent find_backend during insertion") {
+        using namespace rdf4cpp;
+        using namespace rdf4cpp::storage;
+
+        reference_node_storage::SyncReferenceNodeStorage ns{};
+
+        static constexpr size_t n_iris = 10'000;
+        std::vector<identifier::NodeBackendID> ids(n_iris);
+        std::atomic<size_t> published = 0;
+
+        std::thread writer{[&]() {
+            for (size_t ix = 0; ix < n_iris; ++ix) {
+                ids[ix] = ns.find_or_make_id(view::IRIBackendView{.identifier = "http://example.com/" + std::to_string(ix)});
+                published.store(ix + 1, std::memory_order_release);
+            }
+        }};
+
+        size_t checked = 0;
+        while (checked < n_iris) {
+            auto const n = published.load(std::memory_order_acquire);
+            for (; checked < n; ++checked) {
+                CHECK_EQ(ns.find_iri_backend(ids[checked]).identifier, "http://example.com/" + std::to_string(checked));
+            }
+        }
+
+        writer.join();
+    }
+
+    TEST_CASE("concurrent find_backend during erasure") {
+        using namespace rdf4cpp;
+        using namespace rdf4cpp::storage;
+
+        reference_node_storage::SyncReferenceNodeStorage ns{};
+
+        static constexpr size_t n_iris = 10'000;
+        std::vector<identifier::NodeBackendID> ids;
+        for (size_t ix = 0; ix < n_iris; ++ix) {
+            ids.push_back(ns.find_or_make_id(view::IRIBackendView{.identifier = "http://example.com/" + std::to_string(ix)}));
+        }
+
+        std::thread writer{[&]() {
+            for (size_t ix = 0; ix < n_iris; ix += 2) {
+                CHECK(ns.erase_iri(ids[ix]));
+            }
+        }};
+
+        // erased values stay alive until shrink_to_fit
+        for (size_t ix = 0; ix < n_iris; ++ix) {
+            CHECK_EQ(ns.find_iri_backend(ids[ix]).identifier, "http://example.com/" + std::to_string(ix));
+        }
+
+        writer.join();
+
+        CHECK(!ns.erase_iri(ids[0]));
+        CHECK_EQ(ns.find_id(view::IRIBackendView{.identifier = "http://example.com/0"}), identifier::NodeBackendID{});
+
+        // ids of erased values are not reused before shrink_to_fit
+        auto const fresh = ns.find_or_make_id(view::IRIBackendView{.identifier = "http://example.com/fresh"});
+        CHECK(std::ranges::find(ids, fresh) == ids.end());
+
+        ns.shrink_to_fit();
+        auto const reused = ns.find_or_make_id(view::IRIBackendView{.identifier = "http://example.com/reused"});
+        CHECK_EQ(reused, ids[0]);
+    }
+
     TEST_CASE("integration test") {
         using namespace rdf4cpp;
         using namespace rdf4cpp::storage;
@@ -87,6 +289,8 @@ TEST_SUITE("NodeStorage helper types") {
         CHECK_EQ(l3.backend_handle(), l4.backend_handle());
         CHECK_EQ(l4.lexical_form(), "Hello World");
 
+        ns.shrink_to_fit(); // ids of erased nodes are only reused after shrink_to_fit
+
         auto l5 = Literal::make_simple("Not yet named", ns);
         CHECK_NE(l3, l5);
         CHECK_EQ(l5.backend_handle().node_id().literal_id().to_underlying(), 1);
@@ -95,4 +299,53 @@ TEST_SUITE("NodeStorage helper types") {
         auto l6 = Literal::make_typed_from_value<datatypes::xsd::Long>(std::numeric_limits<datatypes::xsd::Long::cpp_type>::max(), ns); // different storage
         CHECK_EQ(l6.backend_handle().node_id().literal_id().to_underlying(), 1);
     }
+
+    TEST_CASE("sharded integration test") {
+        using namespace rdf4cpp;
+        using namespace rdf4cpp::storage;
+
+        reference_node_storage::ShardedReferenceNodeStorage ns{8};
+        CHECK_THROWS_AS(reference_node_storage::ShardedReferenceNodeStorage{3}, std::invalid_argument);
+
+        // reserved ids are not affected by sharding
+        CHECK_EQ(IRI::find(datatypes::xsd::Int::identifier, ns).backend_handle().id(), identifier::literal_type_to_iri_node_id(datatypes::xsd::Int::fixed_id));
+        CHECK_EQ(IRI::make(datatypes::xsd::Int::identifier, ns).backend_handle().id(), identifier::literal_type_to_iri_node_id(datatypes::xsd::Int::fixed_id));
+
+        static constexpr size_t n_threads = 4;
+        static constexpr size_t n_iris = 1000;
+
+        std::vector<std::vector<IRI>> iris(n_threads);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < n_threads; ++t) {
+            threads.emplace_back([&ns, &out = iris[t]]() {
+                for (size_t ix = 0; ix < n_iris; ++ix) {
+                    out.push_back(IRI::make("http://example.com/" + std::to_string(ix), ns));
+                }
+            });
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        std::set<identifier::NodeBackendID> ids;
+        for (size_t ix = 0; ix < n_iris; ++ix) {
+            auto const expected = "http://example.com/" + std::to_string(ix);
+            for (size_t t = 0; t < n_threads; ++t) {
+                CHECK_EQ(iris[t][ix].identifier(), expected);
+                CHECK_EQ(iris[t][ix].backend_handle(), iris[0][ix].backend_handle());
+            }
+            ids.insert(iris[0][ix].backend_handle().id());
+        }
+        CHECK_EQ(ids.size(), n_iris);
+
+        auto const l = Literal::make_simple("Spherical Cow", ns);
+        CHECK_EQ(l.lexical_form(), "Spherical Cow");
+        CHECK(ns.erase_literal(l.backend_handle().id()));
+        CHECK_EQ(Literal::find_simple("Spherical Cow", ns), Literal{});
+
+        auto const i = iris[0][42];
+        CHECK(ns.erase_iri(i.backend_handle().id()));
+        CHECK_EQ(IRI::find("http://example.com/42", ns), IRI{});
+    }
 }
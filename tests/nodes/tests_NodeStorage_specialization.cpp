@@ -69,14 +69,14 @@ void check_specialized_storage_usage(NS &node_storage, std::array<typename T::cp
             CHECK(backend2.datatype == backend3.datatype);
             CHECK(backend3.datatype == T::fixed_id);
 
-            CHECK(value == std::any_cast<typename T::cpp_type>(backend1.value));
-            CHECK(std::any_cast<typename T::cpp_type>(backend1.value) == std::any_cast<typename T::cpp_type>(backend2.value));
-            CHECK(std::any_cast<typename T::cpp_type>(backend2.value) == std::any_cast<typename T::cpp_type>(backend3.value));
-            CHECK(std::any_cast<typename T::cpp_type>(backend3.value) == value);
-
-            auto const value1 = std::any_cast<typename T::cpp_type>(lit1.value());
-            auto const value2 = std::any_cast<typename T::cpp_type>(lit2.value());
-            auto const value3 = std::any_cast<typename T::cpp_type>(lit3.value());
+            CHECK(value == datatypes::registry::any_cast<typename T::cpp_type>(backend1.value));
+            CHECK(datatypes::registry::any_cast<typename T::cpp_type>(backend1.value) == datatypes::registry::any_cast<typename T::cpp_type>(backend2.value));
+            CHECK(datatypes::registry::any_cast<typename T::cpp_type>(backend2.value) == datatypes::registry::any_cast<typename T::cpp_type>(backend3.value));
+            CHECK(datatypes::registry::any_cast<typename T::cpp_type>(backend3.value) == value);
+
+            auto const value1 = datatypes::registry::any_cast<typename T::cpp_type>(lit1.value());
+            auto const value2 = datatypes::registry::any_cast<typename T::cpp_type>(lit2.value());
+            auto const value3 = datatypes::registry::any_cast<typename T::cpp_type>(lit3.value());
             auto const value4 = lit1.template value<T>();
             auto const value5 = lit2.template value<T>();
             auto const value6 = lit3.template value<T>();
@@ -208,10 +208,10 @@ void test_xsd_string_non_specialization(NS &ns) {
         CHECK(backend3.lexical_form == backend4.lexical_form);
         CHECK(backend4.lexical_form == value);
 
-        auto const value1 = std::any_cast<xsd::String::cpp_type>(lit1.value());
-        auto const value2 = std::any_cast<xsd::String::cpp_type>(lit2.value());
-        auto const value3 = std::any_cast<xsd::String::cpp_type>(lit3.value());
-        auto const value4 = std::any_cast<xsd::String::cpp_type>(lit4.value());
+        auto const value1 = datatypes::registry::any_cast<xsd::String::cpp_type>(lit1.value());
+        auto const value2 = datatypes::registry::any_cast<xsd::String::cpp_type>(lit2.value());
+        auto const value3 = datatypes::registry::any_cast<xsd::String::cpp_type>(lit3.value());
+        auto const value4 = datatypes::registry::any_cast<xsd::String::cpp_type>(lit4.value());
         auto const value5 = lit1.template value<xsd::String>();
         auto const value6 = lit2.template value<xsd::String>();
         auto const value7 = lit3.template value<xsd::String>();
@@ -306,8 +306,8 @@ void test_rdf_lang_string_non_specialization(NS &ns) {
         CHECK(backend1.lexical_form == backend2.lexical_form);
         CHECK(backend2.lexical_form == value.lexical_form);
 
-        auto const value1 = std::any_cast<rdf::LangString::cpp_type>(lit1.value());
-        auto const value2 = std::any_cast<rdf::LangString::cpp_type>(lit2.value());
+        auto const value1 = datatypes::registry::any_cast<rdf::LangString::cpp_type>(lit1.value());
+        auto const value2 = datatypes::registry::any_cast<rdf::LangString::cpp_type>(lit2.value());
         auto const value3 = lit1.template value<rdf::LangString>();
         auto const value4 = lit2.template value<rdf::LangString>();
 
@@ -0,0 +1,134 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <rdf4cpp.hpp>
+#include <rdf4cpp/storage/persistent_node_storage/PersistentNodeStorage.hpp>
+#include <rdf4cpp/storage/persistent_node_storage/detail/PersistentHash.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include <unistd.h>
+
+using namespace rdf4cpp;
+using namespace rdf4cpp::storage;
+using namespace rdf4cpp::storage::persistent_node_storage;
+
+struct TempDir {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("rdf4cpp_tests_PersistentNodeStorage_" + std::to_string(::getpid()));
+
+    TempDir() {
+        std::filesystem::remove_all(path);
+    }
+
+    ~TempDir() {
+        std::filesystem::remove_all(path);
+    }
+};
+
+TEST_CASE("PersistentNodeStorage") {
+    TempDir dir;
+
+    identifier::NodeBackendID iri_id;
+    identifier::NodeBackendID simple_id;
+    identifier::NodeBackendID lang_id;
+    identifier::NodeBackendID double_id;
+    identifier::NodeBackendID bnode_id;
+    identifier::NodeBackendID var_id;
+
+    {
+        PersistentNodeStorage ns_impl{dir.path};
+        DynNodeStoragePtr ns = ns_impl;
+
+        CHECK_EQ(IRI::find(datatypes::xsd::String::identifier, ns).backend_handle().id(),
+                 identifier::literal_type_to_iri_node_id(datatypes::xsd::String::fixed_id));
+
+        auto const iri = IRI{"http://example.com/a", ns};
+        auto const simple = Literal::make_simple("hello", ns);
+        auto const lang = Literal::make_lang_tagged("hallo", "de", ns);
+        auto const dbl = Literal::make_typed_from_value<datatypes::xsd::Double>(1.5, ns);
+        auto const bnode = BlankNode{"b1", ns};
+        auto const var = query::Variable{"x", false, ns};
+
+        CHECK_EQ(IRI{"http://example.com/a", ns}, iri);
+        CHECK_EQ(Literal::make_simple("hello", ns), simple);
+
+        iri_id = iri.backend_handle().id();
+        simple_id = simple.backend_handle().id();
+        lang_id = lang.backend_handle().id();
+        double_id = dbl.backend_handle().id();
+        bnode_id = bnode.backend_handle().id();
+        var_id = var.backend_handle().id();
+
+        ns_impl.sync();
+    }
+
+    SUBCASE("reopen preserves ids") {
+        PersistentNodeStorage ns_impl{dir.path};
+        DynNodeStoragePtr ns = ns_impl;
+
+        auto const iri = IRI::find("http://example.com/a", ns);
+        REQUIRE_FALSE(iri.null());
+        CHECK_EQ(iri.backend_handle().id(), iri_id);
+        CHECK_EQ(iri.identifier(), "http://example.com/a");
+
+        CHECK_EQ(Literal::make_simple("hello", ns).backend_handle().id(), simple_id);
+        CHECK_EQ(Literal::make_lang_tagged("hallo", "de", ns).backend_handle().id(), lang_id);
+        CHECK_EQ(Literal::make_typed_from_value<datatypes::xsd::Double>(1.5, ns).backend_handle().id(), double_id);
+        CHECK_EQ(BlankNode{"b1", ns}.backend_handle().id(), bnode_id);
+        CHECK_EQ(query::Variable{"x", false, ns}.backend_handle().id(), var_id);
+
+        auto const dbl = Literal::make_typed_from_value<datatypes::xsd::Double>(1.5, ns);
+        CHECK_EQ(dbl.value<datatypes::xsd::Double>(), 1.5);
+        CHECK_EQ(Literal::make_lang_tagged("hallo", "de", ns).language_tag(), "de");
+
+        // appending after reopening
+        auto const size_before = ns_impl.size();
+        auto const iri2 = IRI{"http://example.com/b", ns};
+        CHECK_NE(iri2.backend_handle().id(), iri_id);
+        CHECK_EQ(ns_impl.size(), size_before + 1);
+    }
+
+    SUBCASE("hash function mismatch") {
+        {
+            // overwrite file_header::hash_function of one of the files
+            std::fstream file{dir.path / "iri.ids", std::ios::in | std::ios::out | std::ios::binary};
+            REQUIRE(file.is_open());
+            uint32_t const other_hash_function = detail::persistent_hash_id + 1;
+            file.seekp(32);
+            file.write(reinterpret_cast<char const *>(&other_hash_function), sizeof(other_hash_function));
+        }
+
+        CHECK_THROWS_AS(PersistentNodeStorage{dir.path}, std::runtime_error);
+    }
+
+    SUBCASE("many nodes") {
+        std::vector<identifier::NodeBackendID> ids;
+
+        {
+            PersistentNodeStorage ns_impl{dir.path};
+            for (size_t ix = 0; ix < 10'000; ++ix) {
+                auto const str = "http://example.com/many/" + std::to_string(ix);
+                ids.push_back(ns_impl.find_or_make_id(view::IRIBackendView{.identifier = str}));
+            }
+        }
+
+        PersistentNodeStorage ns_impl{dir.path};
+        for (size_t ix = 0; ix < ids.size(); ++ix) {
+            auto const str = "http://example.com/many/" + std::to_string(ix);
+            CHECK_EQ(ns_impl.find_id(view::IRIBackendView{.identifier = str}), ids[ix]);
+            CHECK_EQ(ns_impl.find_iri_backend(ids[ix]).identifier, str);
+        }
+    }
+}
+
+TEST_CASE("PersistentNodeStorage - persistent_hash is pinned") {
+    // the hashes are persisted, if these values change persistent_hash_id needs to be changed as well
+    auto const hash = [](char const *str) {
+        return detail::persistent_hash(str, strlen(str));
+    };
+
+    CHECK_EQ(hash(""), 0xe9e0033e3badaf36);
+    CHECK_EQ(hash("a"), 0xddcc03e67dcd04a4);
+    CHECK_EQ(hash("http://example.com/a"), 0x0a26d687f0ef4be1);
+}
@@ -739,4 +739,227 @@ TEST_SUITE("IStreamQuadIterator") {
             }
         }
     }
-}
\ No newline at end of file
+
+    TEST_CASE("push parsing into sink") {
+        constexpr char const *quads = "<http://example.com/s> <http://example.com/p> \"a\" <http://example.com/g1> .\n"
+                                      "<http://example.com/s> <http://example.com/p> \"b\" .\n"
+                                      "<http://example.com/s> <http://example.com/p> .\n" // error
+                                      "_:b1 <http://example.com/p> <http://example.com/o> <http://example.com/g2> .\n";
+
+        struct CollectingSink final : QuadSink {
+            std::vector<Quad> quads;
+            std::vector<ParsingError> errors;
+            size_t begin_calls = 0;
+            size_t end_calls = 0;
+            size_t quads_at_end = 0;
+            storage::DynNodeStoragePtr node_storage;
+
+            void on_begin(storage::DynNodeStoragePtr ns) override {
+                ++begin_calls;
+                node_storage = ns;
+            }
+
+            void on_quad(storage::identifier::NodeBackendID g,
+                         storage::identifier::NodeBackendID s,
+                         storage::identifier::NodeBackendID p,
+                         storage::identifier::NodeBackendID o) override {
+                auto const ns = storage::default_node_storage;
+                quads.emplace_back(Node{storage::identifier::NodeBackendHandle{g, ns}},
+                                   Node{storage::identifier::NodeBackendHandle{s, ns}},
+                                   Node{storage::identifier::NodeBackendHandle{p, ns}},
+                                   Node{storage::identifier::NodeBackendHandle{o, ns}});
+            }
+
+            void on_error(ParsingError const &error) override {
+                errors.push_back(error);
+            }
+
+            void on_end() override {
+                ++end_calls;
+                quads_at_end = quads.size();
+            }
+        };
+
+        std::vector<Quad> expected_quads;
+        std::vector<ParsingError> expected_errors;
+        {
+            std::istringstream iss{quads};
+            for (IStreamQuadIterator qit{iss, ParsingFlag::NQuads}; qit != std::default_sentinel; ++qit) {
+                if (qit->has_value()) {
+                    expected_quads.push_back(qit->value());
+                } else {
+                    expected_errors.push_back(qit->error());
+                }
+            }
+        }
+        REQUIRE_EQ(expected_quads.size(), 3);
+        REQUIRE_EQ(expected_errors.size(), 1);
+
+        CollectingSink sink;
+        std::istringstream iss{quads};
+        IStreamQuadIterator::parse_into(sink, iss, ParsingFlag::NQuads);
+
+        CHECK_EQ(sink.quads, expected_quads);
+        REQUIRE_EQ(sink.errors.size(), expected_errors.size());
+        CHECK_EQ(sink.errors[0].line, expected_errors[0].line);
+
+        CHECK_EQ(sink.begin_calls, 1);
+        CHECK(sink.node_storage == storage::default_node_storage);
+        CHECK_EQ(sink.end_calls, 1);
+        CHECK_EQ(sink.quads_at_end, expected_quads.size());
+
+        SUBCASE("exceptions from sink are propagated") {
+            struct ThrowingSink final : QuadSink {
+                void on_quad(storage::identifier::NodeBackendID, storage::identifier::NodeBackendID, storage::identifier::NodeBackendID, storage::identifier::NodeBackendID) override {
+                    throw std::runtime_error{"sink full"};
+                }
+                void on_error(ParsingError const &) override {
+                }
+            };
+
+            ThrowingSink throwing_sink;
+            std::istringstream iss2{quads};
+            CHECK_THROWS_AS(IStreamQuadIterator::parse_into(throwing_sink, iss2, ParsingFlag::NQuads), std::runtime_error);
+        }
+
+        SUBCASE("batched ids") {
+            std::vector<std::vector<BatchingQuadSink::id_quad>> batches;
+            std::vector<size_t> error_positions; // number of batches received before each error
+
+            BatchingQuadSink batching_sink{[&](std::span<BatchingQuadSink::id_quad const> batch) {
+                                               batches.emplace_back(batch.begin(), batch.end());
+                                           },
+                                           [&](ParsingError const &) {
+                                               error_positions.push_back(batches.size());
+                                           },
+                                           2};
+            CHECK(batching_sink.node_storage() == storage::DynNodeStoragePtr{});
+
+            std::istringstream iss2{quads};
+            IStreamQuadIterator::parse_into(batching_sink, iss2, ParsingFlag::NQuads);
+            CHECK(batching_sink.node_storage() == storage::default_node_storage);
+
+            // the error flushes the first batch early
+            REQUIRE_EQ(batches.size(), 2);
+            CHECK_EQ(batches[0].size(), 2);
+            CHECK_EQ(batches[1].size(), 1);
+            CHECK_EQ(error_positions, std::vector<size_t>{1});
+
+            std::vector<Quad> actual;
+            for (auto const &batch : batches) {
+                for (auto const &[g, s, p, o] : batch) {
+                    auto const ns = batching_sink.node_storage();
+                    actual.emplace_back(Node{storage::identifier::NodeBackendHandle{g, ns}},
+                                        Node{storage::identifier::NodeBackendHandle{s, ns}},
+                                        Node{storage::identifier::NodeBackendHandle{p, ns}},
+                                        Node{storage::identifier::NodeBackendHandle{o, ns}});
+                }
+            }
+            CHECK_EQ(actual, expected_quads);
+
+            CHECK_THROWS_AS(BatchingQuadSink([](auto) {}, [](auto const &) {}, 0), std::invalid_argument);
+        }
+
+        SUBCASE("Dataset::load_rdf_data") {
+            Dataset ds;
+            size_t n_errors = 0;
+            std::istringstream iss2{quads};
+            ds.load_rdf_data(iss2, ParsingFlag::NQuads, nullptr, [&](ParsingError const &) { ++n_errors; });
+
+            CHECK_EQ(ds.size(), 3);
+            CHECK_EQ(n_errors, 1);
+            for (auto const &quad : expected_quads) {
+                CHECK(ds.contains(quad));
+            }
+            CHECK_EQ(ds.size(IRI{"http://example.com/g1"}), 1);
+            CHECK_EQ(ds.size(IRI{"http://example.com/g2"}), 1);
+        }
+    }
+
+    TEST_CASE("redefining prefixes and base") {
+        // the same tokens must resolve differently after the prefix or base changes
+        constexpr char const *turtle = "@prefix ex: <http://example.com/a/> .\n"
+                                       "@base <http://example.com/base1/> .\n"
+                                       "ex:s ex:p <rel> .\n"
+                                       "@prefix ex: <http://example.com/b/> .\n"
+                                       "ex:s ex:p <rel> .\n"
+                                       "@base <http://example.com/base2/> .\n"
+                                       "ex:s ex:p <rel> .\n";
+
+        std::istringstream iss{turtle};
+        std::vector<Quad> quads;
+        for (IStreamQuadIterator qit{iss}; qit != std::default_sentinel; ++qit) {
+            REQUIRE(qit->has_value());
+            quads.push_back(qit->value());
+        }
+
+        REQUIRE_EQ(quads.size(), 3);
+        CHECK_EQ(quads[0].subject(), IRI{"http://example.com/a/s"});
+        CHECK_EQ(quads[0].object(), IRI{"http://example.com/base1/rel"});
+        CHECK_EQ(quads[1].subject(), IRI{"http://example.com/b/s"});
+        CHECK_EQ(quads[1].predicate(), IRI{"http://example.com/b/p"});
+        CHECK_EQ(quads[1].object(), IRI{"http://example.com/base1/rel"});
+        CHECK_EQ(quads[2].subject(), IRI{"http://example.com/b/s"});
+        CHECK_EQ(quads[2].object(), IRI{"http://example.com/base2/rel"});
+    }
+
+    TEST_CASE("trusted input") {
+        constexpr char const *turtle = "@prefix ex: <http://example.com/> .\n"
+                                       "@prefix xsd: <http://www.w3.org/2001/XMLSchema#> .\n"
+                                       "@base <http://example.com/base/> .\n"
+                                       "ex:s ex:p \"42\"^^xsd:int .\n"
+                                       "ex:s ex:p \"0042\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n"
+                                       "ex:s ex:p \"simple\" .\n"
+                                       "ex:s ex:p \"typed simple\"^^xsd:string .\n"
+                                       "ex:s ex:p \"tagged\"@en .\n"
+                                       "ex:s ex:p \"upper tagged\"@EN-GB .\n"
+                                       "ex:s ex:p \"unknown\"^^ex:dt .\n"
+                                       "<rel> ex:p <../other> .\n"
+                                       "ex:s ex:p \"not an int\"^^xsd:int .\n";
+
+        auto const parse = [&](ParsingFlags const flags) {
+            std::istringstream iss{turtle};
+            std::vector<Quad> quads;
+            size_t n_errors = 0;
+            for (IStreamQuadIterator qit{iss, flags}; qit != std::default_sentinel; ++qit) {
+                if (qit->has_value()) {
+                    quads.push_back(qit->value());
+                } else {
+                    ++n_errors;
+                }
+            }
+            return std::make_pair(quads, n_errors);
+        };
+
+        auto const [expected, expected_errors] = parse(ParsingFlag::Turtle);
+        auto const [actual, actual_errors] = parse(ParsingFlag::Turtle | ParsingFlag::Trusted);
+
+        CHECK_EQ(actual, expected);
+        CHECK_EQ(expected_errors, 1);
+        CHECK_EQ(actual_errors, 1); // typed literals are still parsed by their datatype
+
+        REQUIRE_EQ(actual.size(), 8);
+        CHECK(actual[0].object().as_literal().is_inlined()); // typed literals are still inlined
+        CHECK_EQ(actual[1].object().as_literal().lexical_form(), "42"); // and canonicalized
+        CHECK_EQ(actual[5].object().as_literal().language_tag(), "en-gb");
+        CHECK_EQ(actual[7].subject(), IRI{"http://example.com/base/rel"});
+        CHECK_EQ(actual[7].object(), IRI{"http://example.com/other"});
+
+        SUBCASE("N-Triples") {
+            constexpr char const *ntriples = "<http://example.com/s> <http://example.com/p> \"1.5\"^^<http://www.w3.org/2001/XMLSchema#double> .\n"
+                                             "<http://example.com/s> <http://example.com/p> \"x\"@de .\n";
+
+            std::istringstream iss{ntriples};
+            std::vector<Quad> quads;
+            for (IStreamQuadIterator qit{iss, ParsingFlag::NTriples | ParsingFlag::Trusted}; qit != std::default_sentinel; ++qit) {
+                REQUIRE(qit->has_value());
+                quads.push_back(qit->value());
+            }
+
+            REQUIRE_EQ(quads.size(), 2);
+            CHECK_EQ(quads[0].subject(), IRI{"http://example.com/s"});
+            CHECK_EQ(quads[0].object(), Literal::make_typed_from_value<datatypes::xsd::Double>(1.5));
+            CHECK_EQ(quads[1].object(), Literal::make_lang_tagged("x", "de"));
+        }
+    }
+}
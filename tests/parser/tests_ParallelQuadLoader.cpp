@@ -0,0 +1,97 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp.hpp>
+#include <rdf4cpp/parser/ParallelQuadLoader.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+using namespace rdf4cpp;
+
+static std::filesystem::path write_test_file(std::string const &name, std::string const &content) {
+    auto const path = std::filesystem::temp_directory_path() / ("rdf4cpp-tests-" + std::to_string(getpid()) + "-" + name);
+    std::ofstream out{path};
+    out << content;
+    return path;
+}
+
+TEST_SUITE("ParallelQuadLoader") {
+    TEST_CASE("only line based syntaxes") {
+        CHECK_THROWS_AS(parser::ParallelQuadLoader("x.ttl", parser::ParsingFlag::Turtle), std::invalid_argument);
+        CHECK_THROWS_AS(parser::ParallelQuadLoader("x.trig", parser::ParsingFlag::TriG), std::invalid_argument);
+    }
+
+    TEST_CASE("not existing file") {
+        parser::ParallelQuadLoader loader{"shouldnotexist.nt"};
+        CHECK_THROWS_AS(loader.load([](auto &&) {}), std::system_error);
+    }
+
+    TEST_CASE("same result as sequential parsing") {
+        std::string content;
+        for (size_t ix = 0; ix < 2000; ++ix) {
+            content += "<http://example.com/s" + std::to_string(ix % 100) + "> <http://example.com/p> \"" + std::to_string(ix) + "\" <http://example.com/g" + std::to_string(ix % 3) + "> .\n";
+            if (ix % 500 == 250) {
+                content += "<http://example.com/broken> <http://example.com/p> .\n"; // bad syntax on line (ix + 2 + ix / 500)
+            }
+            if (ix % 7 == 0) {
+                content += "_:b" + std::to_string(ix) + " <http://example.com/p> <http://example.com/o> .\n";
+            }
+        }
+        content += "<http://example.com/last> <http://example.com/p> <http://example.com/o> ."; // no trailing newline
+
+        auto const path = write_test_file("parallel.nq", content);
+
+        storage::reference_node_storage::SyncReferenceNodeStorage ns{};
+
+        Dataset expected{ns};
+        std::vector<uint64_t> expected_error_lines;
+        {
+            std::ifstream in{path};
+            parser::ParsingState state{.node_storage = ns};
+            expected.load_rdf_data(in, parser::ParsingFlag::NQuads, &state, [&](parser::ParsingError const &e) {
+                expected_error_lines.push_back(e.line);
+            });
+        }
+        REQUIRE_EQ(expected_error_lines.size(), 4);
+
+        for (size_t num_threads : {1, 2, 8}) {
+            Dataset ds{ns};
+            std::vector<uint64_t> error_lines;
+
+            parser::ParsingState state{.node_storage = ns};
+            parser::ParallelQuadLoader loader{path.string(), parser::ParsingFlag::NQuads, &state, num_threads, 1024};
+            loader.load([&](parser::ParallelQuadLoader::Chunk &&chunk) {
+                for (auto const &quad : chunk.quads) {
+                    ds.add(quad);
+                }
+                for (auto const &error : chunk.errors) {
+                    error_lines.push_back(error.line);
+                }
+            });
+
+            CHECK_EQ(ds.size(), expected.size());
+            for (auto const &quad : expected) {
+                CHECK(ds.contains(quad));
+            }
+            CHECK_EQ(error_lines, expected_error_lines);
+        }
+
+        SUBCASE("Dataset::load_rdf_data_parallel") {
+            Dataset ds{ns};
+            size_t n_errors = 0;
+            ds.load_rdf_data_parallel(path.string(), parser::ParsingFlag::NQuads, nullptr, 4, [&](parser::ParsingError const &) {
+                ++n_errors;
+            });
+
+            CHECK_EQ(ds.size(), expected.size());
+            CHECK_EQ(n_errors, expected_error_lines.size());
+        }
+
+        std::filesystem::remove(path);
+    }
+}
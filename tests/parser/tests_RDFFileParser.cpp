@@ -4,6 +4,60 @@
 #include <rdf4cpp.hpp>
 #include <rdf4cpp/parser/RDFFileParser.hpp>
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <bzlib.h>
+#include <zlib.h>
+#include <zstd.h>
+
+static std::string read_file(std::filesystem::path const &path) {
+    std::ifstream ifs{path, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+}
+
+static void write_file(std::filesystem::path const &path, std::string_view data) {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+static std::string gzip_compress(std::string const &data) {
+    z_stream z{};
+    REQUIRE_EQ(deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY), Z_OK); // 16: write gzip header
+
+    std::string out;
+    out.resize(deflateBound(&z, data.size()));
+    z.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data()));
+    z.avail_in = static_cast<uInt>(data.size());
+    z.next_out = reinterpret_cast<Bytef *>(out.data());
+    z.avail_out = static_cast<uInt>(out.size());
+    REQUIRE_EQ(deflate(&z, Z_FINISH), Z_STREAM_END);
+    out.resize(z.total_out);
+    deflateEnd(&z);
+    return out;
+}
+
+static std::string zstd_compress(std::string const &data) {
+    std::string out;
+    out.resize(ZSTD_compressBound(data.size()));
+    auto const n = ZSTD_compress(out.data(), out.size(), data.data(), data.size(), 3);
+    REQUIRE_FALSE(ZSTD_isError(n));
+    out.resize(n);
+    return out;
+}
+
+static std::string bzip2_compress(std::string const &data) {
+    std::string out;
+    auto n = static_cast<unsigned>(data.size() + data.size() / 100 + 600);
+    out.resize(n);
+    REQUIRE_EQ(BZ2_bzBuffToBuffCompress(out.data(), &n, const_cast<char *>(data.data()), static_cast<unsigned>(data.size()), 9, 0, 0), BZ_OK);
+    out.resize(n);
+    return out;
+}
+
 TEST_SUITE("RDFFileParser") {
     TEST_CASE("not existing file") {
         rdf4cpp::parser::RDFFileParser parse{"shouldnotexist.ttl"};
@@ -53,5 +107,134 @@ TEST_SUITE("RDFFileParser") {
         ++it;
         CHECK(it != pars.end());
     }
+    TEST_CASE("mmap and prefetch input") {
+        using InputMode = rdf4cpp::parser::RDFFileParser::InputMode;
+
+        std::vector<rdf4cpp::parser::RDFFileParser::iterator::value_type> streamed;
+        for (auto const &v : rdf4cpp::parser::RDFFileParser{"./tests_RDFFileParser_simple.ttl", rdf4cpp::parser::ParsingFlags::none(), nullptr, InputMode::Stream}) {
+            streamed.push_back(v);
+        }
+
+        for (auto const mode : {InputMode::MMap, InputMode::Prefetch}) {
+            std::vector<rdf4cpp::parser::RDFFileParser::iterator::value_type> other;
+            for (auto const &v : rdf4cpp::parser::RDFFileParser{"./tests_RDFFileParser_simple.ttl", rdf4cpp::parser::ParsingFlags::none(), nullptr, mode}) {
+                other.push_back(v);
+            }
+
+            REQUIRE_EQ(other.size(), streamed.size());
+            for (size_t ix = 0; ix < other.size(); ++ix) {
+                REQUIRE_EQ(other[ix].has_value(), streamed[ix].has_value());
+                if (other[ix].has_value()) {
+                    CHECK_EQ(other[ix].value(), streamed[ix].value());
+                } else {
+                    CHECK_EQ(other[ix].error().line, streamed[ix].error().line);
+                }
+            }
+
+            CHECK_THROWS_AS((rdf4cpp::parser::RDFFileParser{"shouldnotexist.ttl", rdf4cpp::parser::ParsingFlags::none(), nullptr, mode}.begin()), std::system_error);
+        }
+    }
+
+    TEST_CASE("compressed input") {
+        using namespace rdf4cpp::parser;
+
+        auto const plain = read_file("./tests_RDFFileParser_simple.ttl");
+
+        std::vector<RDFFileParser::iterator::value_type> expected;
+        for (auto const &v : RDFFileParser{"./tests_RDFFileParser_simple.ttl"}) {
+            expected.push_back(v);
+        }
+        REQUIRE_FALSE(expected.empty());
+
+        struct Case {
+            char const *file_name;
+            Compression compression;
+            std::string data;
+        };
+
+        auto const gz = gzip_compress(plain);
+        Case const cases[]{{"./tests_RDFFileParser_simple.ttl.gz", Compression::Gzip, gz},
+                           {"./tests_RDFFileParser_simple_multi.ttl.gz", Compression::Gzip, gz + gzip_compress("")}, // concatenated gzip members
+                           {"./tests_RDFFileParser_simple.ttl.zst", Compression::Zstd, zstd_compress(plain)},
+                           {"./tests_RDFFileParser_simple.ttl.bz2", Compression::BZip2, bzip2_compress(plain)}};
+
+        for (auto const &c : cases) {
+            CAPTURE(c.file_name);
+            CHECK_EQ(detect_compression(c.data), c.compression);
+            write_file(c.file_name, c.data);
+
+            for (auto const mode : {RDFFileParser::InputMode::Stream, RDFFileParser::InputMode::MMap, RDFFileParser::InputMode::Prefetch}) {
+                std::vector<RDFFileParser::iterator::value_type> actual;
+                for (auto const &v : RDFFileParser{c.file_name, ParsingFlags::none(), nullptr, mode}) {
+                    actual.push_back(v);
+                }
+
+                REQUIRE_EQ(actual.size(), expected.size());
+                for (size_t ix = 0; ix < actual.size(); ++ix) {
+                    REQUIRE_EQ(actual[ix].has_value(), expected[ix].has_value());
+                    if (actual[ix].has_value()) {
+                        CHECK_EQ(actual[ix].value(), expected[ix].value());
+                    }
+                }
+            }
+
+            // truncated input is reported as stream error
+            write_file(c.file_name, std::string_view{c.data}.substr(0, c.data.size() / 2));
+            {
+                FILE *file = fopen(c.file_name, "r");
+                REQUIRE(file != nullptr);
+
+                DecompressingReader reader{file, reinterpret_cast<ReadFunc>(&fread), reinterpret_cast<ErrorFunc>(&ferror)};
+                CHECK_EQ(reader.compression(), c.compression);
+
+                char buf[256];
+                while (DecompressingReader::read(buf, 1, sizeof(buf), &reader) > 0) {
+                }
+                CHECK_NE(DecompressingReader::error(&reader), 0);
+                fclose(file);
+            }
+
+            std::filesystem::remove(c.file_name);
+        }
+
+        CHECK_EQ(detect_compression(plain), Compression::None);
+        CHECK_EQ(detect_compression(""), Compression::None);
+    }
+
+    TEST_CASE("prefetching reader") {
+        using rdf4cpp::parser::PrefetchingReader;
+
+        std::string expected;
+        {
+            std::ifstream ifs{"./tests_RDFFileParser_simple.ttl"};
+            expected.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+        }
+        REQUIRE_FALSE(expected.empty());
+
+        // tiny buffers to cross buffer boundaries in all possible ways
+        for (size_t const buffer_size : {1, 3, 64}) {
+            for (size_t const depth : {1, 2, 4}) {
+                FILE *file = fopen("./tests_RDFFileParser_simple.ttl", "r");
+                REQUIRE(file != nullptr);
+
+                std::string actual;
+                {
+                    PrefetchingReader reader{file, reinterpret_cast<rdf4cpp::parser::ReadFunc>(&fread), reinterpret_cast<rdf4cpp::parser::ErrorFunc>(&ferror), buffer_size, depth};
+
+                    char buf[5];
+                    while (auto const n = PrefetchingReader::read(buf, 1, sizeof(buf), &reader)) {
+                        actual.append(buf, n);
+                    }
+                    CHECK_EQ(PrefetchingReader::error(&reader), 0);
+                }
+
+                CHECK_EQ(actual, expected);
+                fclose(file);
+            }
+        }
+
+        CHECK_THROWS_AS(PrefetchingReader(nullptr, nullptr, nullptr, 0, 1), std::invalid_argument);
+        CHECK_THROWS_AS(PrefetchingReader(nullptr, nullptr, nullptr, 1, 0), std::invalid_argument);
+    }
     // only testing basic iterator functionality here, see tests for IStreamQuadIterator for more parsing tests
 }
@@ -1,7 +1,13 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 #include <rdf4cpp.hpp>
+#include <rdf4cpp/storage/reference_node_storage/SyncReferenceNodeStorage.hpp>
 #include <rdf4cpp/storage/reference_node_storage/UnsyncReferenceNodeStorage.hpp>
+#include <rdf4cpp/writer/CompressingWriter.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
 
 enum struct OutputFormat {
     NTriples,
@@ -384,5 +390,254 @@ TEST_CASE("extended") {
     extended_tests<OutputFormat::TriG, parser::ParsingFlag::TriG>();
 }
 
+TEST_CASE("IRI prefix map") {
+    writer::IRIPrefixMap prefixes{IRIFactory{IRIFactory::prefix_map_type{{"ex", "http://ex/"}, {"urn", "urn:isbn:"}}}};
+    CHECK(prefixes.add("ex", "http://ex/") == IRIFactoryError::Ok);
+    CHECK(prefixes.add("ex", "http://other/") == IRIFactoryError::InvalidPrefix);
+    CHECK(prefixes.add("xsd", "http://other/") == IRIFactoryError::InvalidPrefix);
+    CHECK(prefixes.add("in valid", "http://other/") == IRIFactoryError::InvalidPrefix);
+    CHECK(prefixes.add("", "http://empty/") == IRIFactoryError::Ok);
+
+    auto const abbreviate = [&](std::string_view iri) {
+        return writer::StringWriter::oneshot([&](auto &w) noexcept {
+            return prefixes.write_iri(iri, w);
+        });
+    };
+
+    CHECK_EQ(abbreviate("http://ex/sub"), "ex:sub");
+    CHECK_EQ(abbreviate("http://ex/"), "ex:");
+    CHECK_EQ(abbreviate("http://ex/a:b.c"), "ex:a:b.c");
+    CHECK_EQ(abbreviate("http://ex/1%20x"), "ex:1%20x");
+    CHECK_EQ(abbreviate("urn:isbn:123"), "urn:123");
+    CHECK_EQ(abbreviate("http://empty/x"), ":x");
+    CHECK_EQ(abbreviate("http://www.w3.org/2001/XMLSchema#string"), "xsd:string");
+    CHECK_EQ(abbreviate("http://ex/path/sub"), "<http://ex/path/sub>");
+    CHECK_EQ(abbreviate("http://ex/sub."), "<http://ex/sub.>");
+    CHECK_EQ(abbreviate("http://ex/-sub"), "<http://ex/-sub>");
+    CHECK_EQ(abbreviate("http://ex/%2"), "<http://ex/%2>");
+    CHECK_EQ(abbreviate("http://ex/sub?q"), "<http://ex/sub?q>");
+    CHECK_EQ(abbreviate("http://other/sub"), "<http://other/sub>");
+
+    CHECK_THROWS_AS(writer::IRIPrefixMap(IRIFactory{IRIFactory::prefix_map_type{{"in valid", "http://ex/"}}}), std::invalid_argument);
+}
+
+TEST_CASE("turtle and trig with prefixes") {
+    storage::reference_node_storage::UnsyncReferenceNodeStorage ns{};
+
+    Dataset ds{ns};
+    for (size_t ix = 0; ix < 1000; ++ix) {
+        ds.add(Quad{ix % 2 == 0 ? IRI::default_graph(ns) : IRI{"http://ex/graphs#g" + std::to_string(ix % 3), ns},
+                    IRI{"http://ex/data/sub" + std::to_string(ix % 100), ns},
+                    IRI{"http://ex/vocab/pred" + std::to_string(ix % 7), ns},
+                    ix == 0 ? Node{IRI{"http://rare/obj", ns}} : Node{Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int>(ix), ns)}});
+    }
+
+    auto const check_roundtrip = [&](std::string const &data, parser::ParsingFlag flag, Dataset const &expected) {
+        std::istringstream in{data};
+        parser::ParsingState state{.node_storage = ns};
+        Dataset actual{ns};
+        size_t n_errors = 0;
+        actual.load_rdf_data(in, flag, &state, [&](parser::ParsingError const &) { ++n_errors; });
+
+        CHECK_EQ(n_errors, 0);
+        CHECK_EQ(actual.size(), expected.size());
+        for (auto const &quad : expected) {
+            CHECK(actual.contains(quad));
+        }
+    };
+
+    auto const &graph = *ds.find_graph();
+    Dataset default_graph_only{ns};
+    for (auto const &stmt : graph) {
+        default_graph_only.add(Quad{stmt.subject(), stmt.predicate(), stmt.object()});
+    }
+
+    SUBCASE("discovered") {
+        auto const prefixes = ds.discover_prefixes();
+        CHECK_EQ(prefixes.declarations().size(), 3); // graphs, data and vocab, but not the namespace that occurs only once
+
+        auto const trig = writer::StringWriter::oneshot([&](auto &w) noexcept { return ds.serialize_trig(w, prefixes); });
+        CHECK(trig.starts_with("@prefix xsd: <http://www.w3.org/2001/XMLSchema#> .\n@prefix rdf: <http://www.w3.org/1999/02/22-rdf-syntax-ns#> .\n@prefix ns0: "));
+        CHECK(trig.find("<http://ex/data/") == std::string::npos);
+        CHECK_LT(trig.size(), writer::StringWriter::oneshot([&](auto &w) noexcept { return ds.serialize_trig(w); }).size());
+        check_roundtrip(trig, parser::ParsingFlag::TriG, ds);
+
+        auto const turtle = writer::StringWriter::oneshot([&](auto &w) noexcept { return graph.serialize_turtle(w, graph.discover_prefixes()); });
+        CHECK(turtle.find("<http://ex/vocab/") == std::string::npos);
+        check_roundtrip(turtle, parser::ParsingFlag::Turtle, default_graph_only);
+    }
+
+    SUBCASE("from IRIFactory") {
+        writer::IRIPrefixMap const prefixes{IRIFactory{IRIFactory::prefix_map_type{{"data", "http://ex/data/"}, {"voc", "http://ex/vocab/"}}}};
+
+        auto const turtle = writer::StringWriter::oneshot([&](auto &w) noexcept { return graph.serialize_turtle(w, prefixes); });
+        CHECK(turtle.starts_with("@prefix xsd: <http://www.w3.org/2001/XMLSchema#> .\n"
+                                 "@prefix rdf: <http://www.w3.org/1999/02/22-rdf-syntax-ns#> .\n"
+                                 "@prefix data: <http://ex/data/> .\n"
+                                 "@prefix voc: <http://ex/vocab/> .\n"));
+        CHECK(turtle.find("data:sub") != std::string::npos);
+        CHECK(turtle.find("voc:pred") != std::string::npos);
+        CHECK(turtle.find("<http://rare/obj") != std::string::npos);
+        check_roundtrip(turtle, parser::ParsingFlag::Turtle, default_graph_only);
+    }
+}
+
+TEST_CASE("grouped turtle and trig") {
+    storage::reference_node_storage::UnsyncReferenceNodeStorage ns{};
+
+    Dataset ds{ns};
+    for (size_t ix = 0; ix < 2000; ++ix) {
+        ds.add(Quad{ix % 4 == 0 ? IRI::default_graph(ns) : IRI{"http://ex/graph" + std::to_string(ix % 2), ns},
+                    IRI{"http://ex/sub" + std::to_string(ix % 50), ns},
+                    IRI{"http://ex/pred" + std::to_string(ix % 3), ns},
+                    Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int>(ix), ns)});
+    }
+
+    auto const count = [](std::string_view haystack, std::string_view needle) {
+        size_t n = 0;
+        for (auto pos = haystack.find(needle); pos != std::string_view::npos; pos = haystack.find(needle, pos + 1)) {
+            ++n;
+        }
+        return n;
+    };
+
+    auto const check_parsed = [&](std::string const &data, parser::ParsingFlag flag, auto const &expected) {
+        std::istringstream in{data};
+        parser::ParsingState state{.node_storage = ns};
+        Dataset actual{ns};
+        size_t n_errors = 0;
+        actual.load_rdf_data(in, flag, &state, [&](parser::ParsingError const &) { ++n_errors; });
+
+        CHECK_EQ(n_errors, 0);
+        CHECK_EQ(actual.size(), expected.size());
+        return actual;
+    };
+
+    SUBCASE("turtle") {
+        auto const &graph = *ds.find_graph();
+        auto const turtle = writer::StringWriter::oneshot([&](auto &w) { return graph.serialize_turtle_grouped(w); });
+
+        // every subject is written once, every predicate once per subject
+        for (size_t ix = 0; ix < 50; ix += 2) {
+            CHECK_EQ(count(turtle, "<http://ex/sub" + std::to_string(ix) + "> "), 1);
+        }
+        CHECK_EQ(count(turtle, "<http://ex/pred"), 25 * 3);
+        CHECK_LT(turtle.size(), writer::StringWriter::oneshot([&](auto &w) noexcept { return graph.serialize_turtle(w); }).size());
+
+        auto const actual = check_parsed(turtle, parser::ParsingFlag::Turtle, graph);
+        for (auto const &stmt : graph) {
+            CHECK(actual.contains(Quad{stmt.subject(), stmt.predicate(), stmt.object()}));
+        }
+
+        writer::IRIPrefixMap const prefixes{IRIFactory{IRIFactory::prefix_map_type{{"ex", "http://ex/"}}}};
+        auto const prefixed = writer::StringWriter::oneshot([&](auto &w) { return graph.serialize_turtle_grouped(w, prefixes); });
+        CHECK_EQ(count(prefixed, "ex:sub0 "), 1);
+        check_parsed(prefixed, parser::ParsingFlag::Turtle, graph);
+    }
+
+    SUBCASE("trig") {
+        auto const trig = writer::StringWriter::oneshot([&](auto &w) { return ds.serialize_trig_grouped(w); });
+
+        // every graph is opened once
+        CHECK_EQ(count(trig, "<http://ex/graph0> {"), 1);
+        CHECK_EQ(count(trig, "<http://ex/graph1> {"), 1);
+
+        auto const actual = check_parsed(trig, parser::ParsingFlag::TriG, ds);
+        for (auto const &quad : ds) {
+            CHECK(actual.contains(quad));
+        }
+    }
+}
+
+TEST_CASE("compressed output") {
+    storage::reference_node_storage::UnsyncReferenceNodeStorage ns{};
+
+    Dataset ds{ns};
+    for (size_t ix = 0; ix < 10000; ++ix) {
+        ds.add(Quad{IRI{"http://ex/graph" + std::to_string(ix % 3), ns},
+                    IRI{"http://ex/sub" + std::to_string(ix % 100), ns},
+                    IRI{"http://ex/pred", ns},
+                    Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int>(ix), ns)});
+    }
+
+    auto const path = std::filesystem::temp_directory_path() / "rdf4cpp-tests-compressed-output.nq";
+
+    for (auto const format : {writer::CompressionFormat::Gzip, writer::CompressionFormat::Zstd}) {
+        for (bool const background : {false, true}) {
+            {
+                FILE *file = fopen(path.c_str(), "w");
+                REQUIRE(file != nullptr);
+
+                // small buffer to get many flushes
+                writer::BufCompressingFileWriter w{file, format, {.buffer_size = 4096, .background = background}};
+                REQUIRE(ds.serialize(w));
+                REQUIRE(w.finalize());
+                fclose(file);
+            }
+
+            {
+                FILE *file = fopen(path.c_str(), "r");
+                REQUIRE(file != nullptr);
+                parser::DecompressingReader reader{file, reinterpret_cast<parser::ReadFunc>(&fread), reinterpret_cast<parser::ErrorFunc>(&ferror)};
+                CHECK_EQ(reader.compression(), format == writer::CompressionFormat::Gzip ? parser::Compression::Gzip : parser::Compression::Zstd);
+                fclose(file);
+            }
+
+            parser::ParsingState state{.node_storage = ns};
+            Dataset actual{ns};
+            size_t n_errors = 0;
+            for (auto const &quad : parser::RDFFileParser{path.string(), parser::ParsingFlag::NQuads, &state}) {
+                if (quad.has_value()) {
+                    actual.add(*quad);
+                } else {
+                    ++n_errors;
+                }
+            }
+
+            CHECK_EQ(n_errors, 0);
+            CHECK_EQ(actual.size(), ds.size());
+            for (auto const &quad : ds) {
+                CHECK(actual.contains(quad));
+            }
+        }
+    }
+
+    std::filesystem::remove(path);
+
+    CHECK_THROWS_AS(writer::BufCompressingFileWriter(stdout, writer::CompressionFormat::Gzip, {.buffer_size = 0}), std::invalid_argument);
+}
+
+TEST_CASE("parallel ntriple and nquad") {
+    storage::reference_node_storage::SyncReferenceNodeStorage ns{};
+
+    // more than one chunk, with the chunk boundaries falling into different graphs
+    Dataset ds{ns};
+    for (size_t ix = 0; ix < 100000; ++ix) {
+        auto const graph = ix % 5 == 0 ? IRI::default_graph(ns) : IRI{"http://ex/graph" + std::to_string(ix % 5), ns};
+        ds.add(Quad{graph,
+                    IRI{"http://ex/sub" + std::to_string(ix % 100), ns},
+                    IRI{"http://ex/pred", ns},
+                    Literal::make_simple("value \"" + std::to_string(ix) + "\"\n", ns)});
+    }
+    ds.graph(IRI{"http://ex/empty", ns}); // empty graphs are skipped
+
+    auto const &default_graph = *ds.find_graph();
+    auto const expected_nt = writer::StringWriter::oneshot([&](auto &w) noexcept { return default_graph.serialize(w); });
+    auto const expected_nq = writer::StringWriter::oneshot([&](auto &w) noexcept { return ds.serialize(w); });
+
+    for (size_t const num_threads : {0, 1, 3, 16}) {
+        CHECK_EQ(writer::StringWriter::oneshot([&](auto &w) { return default_graph.serialize_parallel(w, num_threads); }), expected_nt);
+        CHECK_EQ(writer::StringWriter::oneshot([&](auto &w) { return ds.serialize_parallel(w, num_threads); }), expected_nq);
+    }
+
+    SUBCASE("small inputs") {
+        Dataset small{ns};
+        small.add(Quad{IRI{"http://ex/sub", ns}, IRI{"http://ex/pred", ns}, IRI{"http://ex/obj", ns}});
+        CHECK_EQ(writer::StringWriter::oneshot([&](auto &w) { return small.serialize_parallel(w); }),
+                 "<http://ex/sub> <http://ex/pred> <http://ex/obj> .\n");
+        CHECK_EQ(writer::StringWriter::oneshot([&](auto &w) { return Dataset{ns}.serialize_parallel(w); }), "");
+    }
+}
+
 static_assert(datatypes::registry::util::ConstexprString("abc")+datatypes::registry::util::ConstexprString("def") == datatypes::registry::util::ConstexprString("abcdef"));
 static_assert((datatypes::registry::util::ConstexprString("abc")+datatypes::registry::util::ConstexprString("def")).size() == 7);
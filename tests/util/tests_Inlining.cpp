@@ -3,6 +3,8 @@
 #include <doctest/doctest.h>
 #include <rdf4cpp.hpp>
 
+#include <array>
+#include <bit>
 #include <limits>
 
 using namespace rdf4cpp;
@@ -107,4 +109,69 @@ TEST_SUITE("inlining util") {
             CHECK(!not_packed_pos.has_value());
         }
     }
+
+    TEST_CASE("pack integral ordered") {
+        SUBCASE("signed") {
+            std::array<int64_t, 7> const values{-(1l << 41), -(1l << 20), -1, 0, 1, 1l << 20, (1l << 41) - 1};
+
+            for (size_t ix = 0; ix < values.size(); ++ix) {
+                auto const packed = try_pack_integral_ordered<uint64_t, 42>(values[ix]);
+                REQUIRE(packed.has_value());
+                CHECK(*packed < (1ul << 42));
+                CHECK(unpack_integral_ordered<int64_t, 42>(*packed) == values[ix]);
+
+                if (ix > 0) {
+                    CHECK(*try_pack_integral_ordered<uint64_t, 42>(values[ix - 1]) < *packed);
+                }
+            }
+
+            CHECK(*try_pack_integral_ordered<uint64_t, 42>(-(1l << 41)) == 0);
+            CHECK(*try_pack_integral_ordered<uint64_t, 42>((1l << 41) - 1) == (1ul << 42) - 1);
+            CHECK(!try_pack_integral_ordered<uint64_t, 42>(1l << 41).has_value());
+            CHECK(!try_pack_integral_ordered<uint64_t, 42>(-(1l << 41) - 1).has_value());
+        }
+
+        SUBCASE("signed smaller into bigger") {
+            for (int32_t i = -1000; i < 1000; ++i) {
+                auto const packed = try_pack_integral_ordered<uint64_t, 42>(i);
+                REQUIRE(packed.has_value());
+                REQUIRE(unpack_integral_ordered<int32_t, 42>(*packed) == i);
+                REQUIRE(*try_pack_integral_ordered<uint64_t, 42>(i + 1) > *packed);
+            }
+
+            auto const min = try_pack_integral_ordered<uint64_t, 42>(std::numeric_limits<int8_t>::min());
+            auto const max = try_pack_integral_ordered<uint64_t, 42>(std::numeric_limits<int8_t>::max());
+            CHECK(*min < *max);
+            CHECK(unpack_integral_ordered<int8_t, 42>(*min) == std::numeric_limits<int8_t>::min());
+            CHECK(unpack_integral_ordered<int8_t, 42>(*max) == std::numeric_limits<int8_t>::max());
+        }
+
+        SUBCASE("unsigned") {
+            auto const packed = try_pack_integral_ordered<uint64_t, 42>(std::numeric_limits<uint32_t>::max());
+            REQUIRE(packed.has_value());
+            CHECK(*packed == std::numeric_limits<uint32_t>::max());
+            CHECK(!try_pack_integral_ordered<uint64_t, 42>(uint64_t{1} << 42).has_value());
+        }
+    }
+
+    TEST_CASE("sign magnitude ordered") {
+        std::array<double, 9> const values{-std::numeric_limits<double>::infinity(), -1e300, -1.5, -std::numeric_limits<double>::denorm_min(),
+                                           -0.0, 0.0, std::numeric_limits<double>::denorm_min(), 2.0, std::numeric_limits<double>::infinity()};
+
+        for (size_t ix = 0; ix < values.size(); ++ix) {
+            auto const bits = std::bit_cast<uint64_t>(values[ix]);
+            auto const ordered = sign_magnitude_to_ordered<64>(bits);
+            CHECK(ordered_to_sign_magnitude<64>(ordered) == bits);
+
+            if (ix > 0) {
+                CHECK(sign_magnitude_to_ordered<64>(std::bit_cast<uint64_t>(values[ix - 1])) < ordered);
+            }
+        }
+
+        auto const neg = sign_magnitude_to_ordered<32>(std::bit_cast<uint32_t>(-1.0f));
+        auto const pos = sign_magnitude_to_ordered<32>(std::bit_cast<uint32_t>(1.0f));
+        CHECK(neg < pos);
+        CHECK(pos < (1ul << 32));
+        CHECK(std::bit_cast<float>(static_cast<uint32_t>(ordered_to_sign_magnitude<32>(neg))) == -1.0f);
+    }
 }